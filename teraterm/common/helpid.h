@@ -395,6 +395,7 @@
 #define HlpMacroCommandSetsync          92084
 #define HlpMacroCommandSettime          92085
 #define HlpMacroCommandSettitle         92086
+#define HlpMacroCommandSftpcmd          92224
 #define HlpMacroCommandShow             92087
 #define HlpMacroCommandShowtt           92088
 #define HlpMacroCommandSprintf          92117
@@ -0,0 +1,253 @@
+/*
+ * Copyright (C) 2026- TeraTerm Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <string.h>
+#ifndef _CRTDBG_MAP_ALLOC
+#define _CRTDBG_MAP_ALLOC
+#endif
+#include <stdlib.h>
+#include <crtdbg.h>
+#include <assert.h>
+
+#include "spsc_ring.h"
+
+/*
+ *	read_pos, write_pos ͑JE^
+ *	size 2ׂ̂ƂA(pos & mask) Ńobt@̈ʒu𓾂
+ *	write_pos - read_pos i[ĂoCg
+ *	write_pos ͏ݑAread_pos ͓ǂݏoXV
+ */
+typedef struct SpscRingTag {
+	BYTE *buf;
+	ULONG size;
+	ULONG mask;
+	volatile LONG write_pos;
+	volatile LONG read_pos;
+} SpscRing;
+
+/**
+ *	̃XbhXVJE^ǂ
+ *	ǂ񂾒lOɏꂽf[^悤ɂ
+ */
+static ULONG LoadAcquire(volatile LONG *p)
+{
+	ULONG v = (ULONG)*p;
+	MemoryBarrier();
+	return v;
+}
+
+/**
+ *	XVJE^
+ *	f[^ĂJE^XV
+ */
+static void StoreRelease(volatile LONG *p, ULONG v)
+{
+	MemoryBarrier();
+	*p = (LONG)v;
+}
+
+/**
+ *	Oobt@쐬
+ *
+ *	@param	size	obt@TCYA2ׂ̂ɐ؂グ
+ *	@return			svɂȂ SpscRingDestroy() 邱
+ */
+SpscRing *SpscRingCreate(size_t size)
+{
+	SpscRing *r;
+	ULONG s = 16;
+
+	if (size > 0x40000000) {
+		return NULL;
+	}
+	while (s < size) {
+		s <<= 1;
+	}
+
+	r = (SpscRing *)calloc(1, sizeof(*r));
+	if (r == NULL) {
+		return NULL;
+	}
+	r->buf = (BYTE *)malloc(s);
+	if (r->buf == NULL) {
+		free(r);
+		return NULL;
+	}
+	r->size = s;
+	r->mask = s - 1;
+	r->write_pos = 0;
+	r->read_pos = 0;
+	return r;
+}
+
+void SpscRingDestroy(SpscRing *r)
+{
+	if (r == NULL) {
+		return;
+	}
+	free(r->buf);
+	free(r);
+}
+
+size_t SpscRingGetSize(const SpscRing *r)
+{
+	return r->size;
+}
+
+/**
+ *	i[ĂoCg
+ *	ǂ̃XbhĂׂ(XVȂÂlɂȂ)
+ */
+size_t SpscRingGetCount(const SpscRing *r)
+{
+	SpscRing *w = (SpscRing *)r;
+	ULONG wp = LoadAcquire(&w->write_pos);
+	ULONG rp = LoadAcquire(&w->read_pos);
+	return (size_t)(wp - rp);
+}
+
+size_t SpscRingGetFree(const SpscRing *r)
+{
+	return r->size - SpscRingGetCount(r);
+}
+
+/**
+ *	݉\ȘÄ𓾂 (producer)
+ *
+ *	@param[out]	ptr		݈ʒu
+ *	@return				߂oCgA0̂Ƃ͖t
+ */
+size_t SpscRingWriteSpan(SpscRing *r, BYTE **ptr)
+{
+	ULONG wp = (ULONG)r->write_pos;
+	ULONG rp = LoadAcquire(&r->read_pos);
+	ULONG free_len = r->size - (wp - rp);
+	ULONG offset = wp & r->mask;
+	ULONG span = r->size - offset;
+
+	*ptr = &r->buf[offset];
+	return (size_t)(span < free_len ? span : free_len);
+}
+
+/**
+ *	SpscRingWriteSpan() œ̈ɏoCgm肷 (producer)
+ */
+void SpscRingCommitWrite(SpscRing *r, size_t len)
+{
+	ULONG wp = (ULONG)r->write_pos;
+	assert(len <= SpscRingGetFree(r));
+	StoreRelease(&r->write_pos, wp + (ULONG)len);
+}
+
+/**
+ *	f[^ (producer)
+ *
+ *	@return	񂾃oCgA󂫂ȂƂ len 菬Ȃ
+ */
+size_t SpscRingWrite(SpscRing *r, const void *data, size_t len)
+{
+	const BYTE *p = (const BYTE *)data;
+	size_t total = 0;
+	while (total < len) {
+		BYTE *ptr;
+		size_t span = SpscRingWriteSpan(r, &ptr);
+		if (span == 0) {
+			break;
+		}
+		if (span > len - total) {
+			span = len - total;
+		}
+		memcpy(ptr, p + total, span);
+		SpscRingCommitWrite(r, span);
+		total += span;
+	}
+	return total;
+}
+
+/**
+ *	ǂݏo\ȘÄ𓾂 (consumer)
+ *
+ *	@param[out]	ptr		ǂݏoʒu
+ *	@return				ǂݏooCgA0̂Ƃ͋
+ */
+size_t SpscRingReadSpan(SpscRing *r, const BYTE **ptr)
+{
+	ULONG rp = (ULONG)r->read_pos;
+	ULONG wp = LoadAcquire(&r->write_pos);
+	ULONG count = wp - rp;
+	ULONG offset = rp & r->mask;
+	ULONG span = r->size - offset;
+
+	*ptr = &r->buf[offset];
+	return (size_t)(span < count ? span : count);
+}
+
+/**
+ *	SpscRingReadSpan() œ̈悩ǂ񂾃oCgm肷 (consumer)
+ */
+void SpscRingCommitRead(SpscRing *r, size_t len)
+{
+	ULONG rp = (ULONG)r->read_pos;
+	assert(len <= SpscRingGetCount(r));
+	StoreRelease(&r->read_pos, rp + (ULONG)len);
+}
+
+/**
+ *	f[^ǂݏo (consumer)
+ *
+ *	@return	ǂݏooCg
+ */
+size_t SpscRingRead(SpscRing *r, void *data, size_t len)
+{
+	BYTE *p = (BYTE *)data;
+	size_t total = 0;
+	while (total < len) {
+		const BYTE *ptr;
+		size_t span = SpscRingReadSpan(r, &ptr);
+		if (span == 0) {
+			break;
+		}
+		if (span > len - total) {
+			span = len - total;
+		}
+		memcpy(p + total, ptr, span);
+		SpscRingCommitRead(r, span);
+		total += span;
+	}
+	return total;
+}
+
+/**
+ *	i[Ăf[^̂Ă (consumer)
+ */
+void SpscRingClear(SpscRing *r)
+{
+	ULONG wp = LoadAcquire(&r->write_pos);
+	StoreRelease(&r->read_pos, wp);
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2026- TeraTerm Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#pragma once
+
+#include <windows.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ *	Single-producer/single-consumer ̃Oobt@
+ *	݃Xbh1AǂݏoXbh1̊ԂŃbNȂŎgpł
+ *	ݑAǂݏoꂼÄ(span)PʂŃANZX
+ */
+typedef struct SpscRingTag SpscRing;
+
+SpscRing *SpscRingCreate(size_t size);
+void SpscRingDestroy(SpscRing *r);
+size_t SpscRingGetSize(const SpscRing *r);
+size_t SpscRingGetCount(const SpscRing *r);
+size_t SpscRingGetFree(const SpscRing *r);
+
+// producer
+size_t SpscRingWriteSpan(SpscRing *r, BYTE **ptr);
+void SpscRingCommitWrite(SpscRing *r, size_t len);
+size_t SpscRingWrite(SpscRing *r, const void *data, size_t len);
+
+// consumer
+size_t SpscRingReadSpan(SpscRing *r, const BYTE **ptr);
+void SpscRingCommitRead(SpscRing *r, size_t len);
+size_t SpscRingRead(SpscRing *r, void *data, size_t len);
+void SpscRingClear(SpscRing *r);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,228 @@
+/*
+ * spsc_ring_test
+ *	spsc_ring.c stress test and benchmark of the deferred log writer path
+ *
+ *	A producer thread pushes synthetic terminal output in random sized
+ *	chunks through a 4MB SpscRing, the same way LogToFile() does, and a
+ *	consumer thread drains it span by span like DeferredLogWriteThread().
+ *	The consumer checks every byte and optionally writes it to a file.
+ *
+ *	usage: spsc_ring_test.exe [MB [file]]   (default 1024MB, no file)
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <process.h>
+#include <windows.h>
+
+#include "spsc_ring.h"
+
+#define RING_SIZE	(4*1024*1024)	// LOG_RING_SIZE
+#define CHUNK_MAX	(64*1024)
+
+typedef struct {
+	SpscRing *ring;
+	HANDLE data_event;		// data was written to ring
+	HANDLE space_event;		// space was freed in ring
+	unsigned long long total;
+	HANDLE file;
+	volatile LONG done;		// producer finished
+	unsigned long long errors;
+	unsigned long long spans;
+} Context;
+
+static char *pattern;		// synthetic output, repeated
+static size_t pattern_len;
+
+static void MakePattern(void)
+{
+	static const char *lines[] = {
+		"\x1b[01;34mdrwxr-xr-x\x1b[0m  2 user group     4096 Jan  1 00:00 \x1b[01;34mdir\x1b[0m\r\n",
+		"-rw-r--r--  1 user group   123456 Jan  1 00:00 file.txt\r\n",
+		"\x1b[7m top - 12:34:56 up 3 days, load average: 0.00, 0.01, 0.05 \x1b[m\r\n",
+		"[  123.456789] usb 1-1: new high-speed USB device number 2 using ehci-pci\r\n",
+		"\xe3\x83\xad\xe3\x82\xb0\xe3\x81\xae\xe5\x87\xba\xe5\x8a\x9b UTF-8 text\r\n",
+	};
+	size_t n = 0;
+	size_t i;
+
+	// a prime number of lines so chunk boundaries do not line up with the pattern
+	pattern = (char *)malloc(CHUNK_MAX * 2 + 4096);
+	for (i = 0; n < CHUNK_MAX * 2; i = (i + 1) % (sizeof(lines) / sizeof(lines[0]))) {
+		size_t len = strlen(lines[i]);
+		memcpy(pattern + n, lines[i], len);
+		n += len;
+	}
+	pattern_len = n;
+}
+
+static unsigned __stdcall Producer(void *arg)
+{
+	Context *c = (Context *)arg;
+	unsigned long long pos = 0;
+	unsigned int seed = 1;
+
+	while (pos < c->total) {
+		size_t off = (size_t)(pos % pattern_len);
+		size_t len;
+		const char *p;
+
+		seed = seed * 1103515245 + 12345;
+		len = (seed >> 8) % CHUNK_MAX + 1;
+		if (len > pattern_len - off) {
+			len = pattern_len - off;
+		}
+		if (len > c->total - pos) {
+			len = (size_t)(c->total - pos);
+		}
+		pos += len;
+
+		// LogRingWrite()
+		p = pattern + off;
+		while (len > 0) {
+			size_t n = SpscRingWrite(c->ring, p, len);
+			p += n;
+			len -= n;
+			SetEvent(c->data_event);
+			if (len > 0) {
+				WaitForSingleObject(c->space_event, INFINITE);
+			}
+		}
+	}
+	InterlockedExchange(&c->done, 1);
+	SetEvent(c->data_event);
+	return 0;
+}
+
+static unsigned __stdcall Consumer(void *arg)
+{
+	Context *c = (Context *)arg;
+	unsigned long long pos = 0;
+
+	for (;;) {
+		const BYTE *ptr;
+		size_t len;
+		BOOL done;
+
+		WaitForSingleObject(c->data_event, INFINITE);
+		done = InterlockedCompareExchange(&c->done, 0, 0) != 0;
+
+		// DeferredLogWriteThread()
+		while ((len = SpscRingReadSpan(c->ring, &ptr)) > 0) {
+			size_t i = 0;
+			while (i < len) {
+				size_t off = (size_t)((pos + i) % pattern_len);
+				size_t n = pattern_len - off;
+				if (n > len - i) {
+					n = len - i;
+				}
+				if (memcmp(ptr + i, pattern + off, n) != 0) {
+					c->errors++;
+				}
+				i += n;
+			}
+			if (c->file != INVALID_HANDLE_VALUE) {
+				DWORD wrote;
+				WriteFile(c->file, ptr, (DWORD)len, &wrote, NULL);
+			}
+			pos += len;
+			c->spans++;
+			SpscRingCommitRead(c->ring, len);
+			SetEvent(c->space_event);
+		}
+		if (done) {
+			break;
+		}
+	}
+	if (pos != c->total) {
+		printf("received %llu bytes, expected %llu\n", pos, c->total);
+		c->errors++;
+	}
+	return 0;
+}
+
+/* boundaries of SpscRingWrite/SpscRingRead at the wrap around point */
+static int TestWrap(void)
+{
+	SpscRing *r = SpscRingCreate(16);
+	BYTE in[40], out[40];
+	int errors = 0;
+	size_t i, n;
+
+	for (i = 0; i < sizeof(in); i++) {
+		in[i] = (BYTE)i;
+	}
+	if (r == NULL || SpscRingGetSize(r) != 16) {
+		return 1;
+	}
+	for (n = 1; n <= 16; n++) {
+		for (i = 0; i < 20; i++) {
+			size_t w = SpscRingWrite(r, in, n);
+			size_t rd = SpscRingRead(r, out, sizeof(out));
+			if (w != n || rd != n || memcmp(in, out, n) != 0 || SpscRingGetCount(r) != 0) {
+				errors++;
+			}
+		}
+	}
+	if (SpscRingWrite(r, in, sizeof(in)) != 16 || SpscRingGetFree(r) != 0) {
+		errors++;
+	}
+	SpscRingDestroy(r);
+	return errors;
+}
+
+int main(int argc, char *argv[])
+{
+	Context c;
+	HANDLE threads[2];
+	DWORD start, elapsed;
+	int errors;
+
+	memset(&c, 0, sizeof(c));
+	c.total = 1024ULL * 1024 * 1024;
+	c.file = INVALID_HANDLE_VALUE;
+	if (argc > 1) {
+		c.total = (unsigned long long)atoi(argv[1]) * 1024 * 1024;
+	}
+	if (argc > 2) {
+		c.file = CreateFileA(argv[2], GENERIC_WRITE, FILE_SHARE_READ, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+		if (c.file == INVALID_HANDLE_VALUE) {
+			printf("can not open %s\n", argv[2]);
+			return 1;
+		}
+	}
+
+	errors = TestWrap();
+	printf("wrap: %s\n", errors == 0 ? "OK" : "NG");
+
+	MakePattern();
+	c.ring = SpscRingCreate(RING_SIZE);
+	c.data_event = CreateEvent(NULL, FALSE, FALSE, NULL);
+	c.space_event = CreateEvent(NULL, FALSE, FALSE, NULL);
+
+	start = GetTickCount();
+	threads[0] = (HANDLE)_beginthreadex(NULL, 0, Consumer, &c, 0, NULL);
+	threads[1] = (HANDLE)_beginthreadex(NULL, 0, Producer, &c, 0, NULL);
+	WaitForMultipleObjects(2, threads, TRUE, INFINITE);
+	if (c.file != INVALID_HANDLE_VALUE) {
+		FlushFileBuffers(c.file);
+	}
+	elapsed = GetTickCount() - start;
+
+	printf("stress: %llu MB in %lu ms, %.1f MB/s, %llu spans%s: %s\n",
+		   c.total / (1024 * 1024), (unsigned long)elapsed,
+		   elapsed == 0 ? 0.0 : (double)c.total / (1024 * 1024) / (elapsed / 1000.0),
+		   c.spans, c.file != INVALID_HANDLE_VALUE ? " (with WriteFile)" : "",
+		   c.errors == 0 ? "OK" : "NG");
+
+	CloseHandle(threads[0]);
+	CloseHandle(threads[1]);
+	CloseHandle(c.data_event);
+	CloseHandle(c.space_event);
+	if (c.file != INVALID_HANDLE_VALUE) {
+		CloseHandle(c.file);
+	}
+	SpscRingDestroy(c.ring);
+	free(pattern);
+	return (errors == 0 && c.errors == 0) ? 0 : 1;
+}
@@ -92,6 +92,7 @@
 #define CmdSendBinary       'b'
 #define CmdSendCompatString 'c'	// ]̕Mƌ݊, StringBinaryKv
 #define CmdGetTTPos         'd'
+#define CmdSftpCmnd         'e'
 
 #define LogOptBinary        1
 #define LogOptAppend        2
@@ -107,6 +107,13 @@ enum rotate_mode {
 	ROTATE_SIZE
 };
 
+// log flush mode, FlushFileBuffers() ^C~O
+enum log_flush_mode {
+	LOG_FLUSH_CLOSE,		// t@CƂ
+	LOG_FLUSH_LINE,			// s񂾂Ƃ
+	LOG_FLUSH_INTERVAL		// ts.LogFlushInterval(ms) 
+};
+
 // Log Timestamp Type
 enum LogTimestampType {
     TIMESTAMP_LOCAL,
@@ -604,6 +611,13 @@ struct tttset {
 	WORD AutoComPortReconnectRetryCount;		// 0~
 	int nCmdShow;						// WinMain() 4Ԗڂ̈̒l
 
+	int ReceiveBufferSize;				// Mobt@(cv.InBuff)̃TCY
+	WORD LogFlushMode;					// enum log_flush_mode
+	DWORD LogFlushInterval;				// LOG_FLUSH_INTERVAL ̂Ƃ̊Ԋu(ms)
+	WORD LogCompress;					// OubNPʂgzipŏ
+	WORD LogRotateInterval;				// ԂŃ[e[gԊu(), 0̂Ƃ͎Ԃł̓[e[gȂ
+	WORD LogRotateCompress;				// [e[gt@Ck
+
 	// Experimental
 	BYTE ExperimentalTreePropertySheetEnable;
 };
@@ -760,11 +774,13 @@ typedef struct tttset TTTSet, *PTTSet;
 #define APC  0x9F
 
 #define InBuffSize  1024
+#define InBuffSizeMax (1024*1024*16)
 #define OutBuffSize (1024*16)
 
 typedef struct {
-	BYTE InBuff[InBuffSize];
-	int InBuffCount, InPtr;
+	BYTE *InBuff;			// MOobt@
+	int InBuffCount, InPtr;	// i[oCg, ǂݏoʒu
+	int InBuffLen;			// InBuff ̃TCY(ts.ReceiveBufferSize)
 	BYTE OutBuff[OutBuffSize];
 	int OutBuffCount, OutPtr;
 
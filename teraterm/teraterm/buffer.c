@@ -53,36 +53,48 @@
 #define	ENABLE_CELL_INDEX	0
 
 // obt@̔p1̏
+//	XN[obt@S(ő BuffSizeMax Z)Ŏgp̂ŏۂ (16byte)
+//	Rrl[V̓Z̊O(CombTable[])ɒuACombIndex ŎQƂ
+//	CombTable[] ̃Gg͎QƃJEgtŋL̂ŁAZ̃Rs[
+//	\̂̃Rs[ƎQƃJEg̑ōs
+//	UTF-16 \Ō͕̕KvȂƂ u32 ƃRrl[V狁߂
 typedef struct {
 	char32_t u32;
-	char32_t u32_last;
+	unsigned int CombIndex : 30;	// CombTable[]  index, 0 = Rrl[VȂ
+	unsigned int Padding : 1;		// TRUE = Sp̎̋lߕ or s̋lߕ
+	unsigned int Emoji : 1;			// TRUE = G
+	unsigned short ansi_char;
 	char WidthProperty;				// 'W' or 'F' or 'H' or 'A' or 'n'(Narrow) or 'N'(Neutual) (̑)
 	char cell;			// cell 1/2/3+=p,Sp,3ȏ
 						// 2ȏ̂ƂǍ̕paddingcell-1
-	char Padding;					// TRUE = Sp̎̋lߕ or s̋lߕ
-	char Emoji;						// TRUE = G
-	unsigned char CombinationCharCount16;	// character count
-	unsigned char CombinationCharSize16;		// buffer size
-	unsigned char CombinationCharCount32;
-	unsigned char CombinationCharSize32;
-	wchar_t *pCombinationChars16;
-	char32_t *pCombinationChars32;
-	wchar_t	wc2[2];
 	unsigned char fg;
 	unsigned char bg;
 	unsigned char attr;
 	unsigned char attr2;
-	unsigned short ansi_char;
 #if ENABLE_CELL_INDEX
 	int idx;	// Zʂԍ
 #endif
 } buff_char_t;
 
+// Rrl[V̏
+//	1̃GgL(intern)A쐬͕ύXȂ
+typedef struct {
+	unsigned int RefCount;					// 0 = gp
+	unsigned int Hash;
+	unsigned int Next;						//  hash ̎̃Gg
+											// gp̂Ƃ͎̖gpGg
+	unsigned char CombinationCharCount16;	// character count
+	unsigned char CombinationCharCount32;
+	wchar_t *pCombinationChars16;
+	char32_t *pCombinationChars32;			// pCombinationChars16 Ɠ̈Ɋmۂ
+} buff_comb_t;
+
 #define BuffXMax TermWidthMax
 //#define BuffYMax 100000
 //#define BuffSizeMax 8000000
 // XN[obt@̍ő咷g (2004.11.28 yutaka)
-#define BuffYMax 500000
+// ẐōXɊg
+#define BuffYMax 1000000
 #define BuffSizeMax (BuffYMax * 80)
 
 // 1̃Rrl[Vobt@őTCY
@@ -100,10 +112,21 @@ static int NTabStops;
 static WORD BuffLock = 0;
 
 static buff_char_t *CodeBuffW;
+static buff_comb_t *CombTable;		// [0] ͖gp
+static unsigned int *CombHash;		// hash -> CombTable[]  index, vf CombTableSize
+static unsigned int CombTableSize;
+static unsigned int CombFreeIndex;	// gpXg̐擪, 0 = Ȃ
+static unsigned int CombUsed;		// gp̃Gg
 static LONG LinePtr;
 static LONG BufferSize;
 static int NumOfLinesInBuff;
 static int BuffStartAbs, BuffEndAbs;
+// s̊ԐڎQ
+//	LineMap[O̍s] = CodeBuffW[] ̍s(slot)
+//	SlotLine[slot] = O̍s (LineMap ̋t)
+//	XN[̈̃XN[ LineMap ւ邾ŃZRs[Ȃ
+static int *LineMap;
+static int *SlotLine;
 
 // I
 static BOOL Selected;			// TRUE = ̈IĂ
@@ -136,113 +159,249 @@ static void BuffDrawLineI(int DrawX, int DrawY, int SY, int IStart, int IEnd);
 static void BuffDrawLineIPrn(int SY, int IStart, int IEnd);
 
 /**
- *	buff_char_t  relZړ
- *
- *	@param	CodeBuffW_	obt@̐擪|C^
- *	@param	BufferSize_	obt@̃TCY(buff_char_tP)
- *	@param	p			ړ|C^
- *	@param	rel			ړ
- *	@retval	ړ̃|C^
+ *	Z̃Rrl[VԂ
+ *	Rrl[VȂƂ́ȀԂ
  */
-static buff_char_t *GetPtrRel(buff_char_t *CodeBuffW_, size_t BufferSize_, buff_char_t *p, int rel)
+static const buff_comb_t *GetComb(const buff_char_t *b)
 {
-	ptrdiff_t idx = (ptrdiff_t)(p - CodeBuffW_) + rel;
-	for (;;) {
-		if (idx < 0) {
-			idx += BufferSize_;
+	static const buff_comb_t none;
+	if (b->CombIndex == 0) {
+		return &none;
+	}
+	return &CombTable[b->CombIndex];
+}
+
+static unsigned int CombHashValue(const char32_t *chars, size_t count)
+{
+	// FNV-1a
+	unsigned int h = 2166136261U;
+	size_t i;
+	for (i = 0; i < count; i++) {
+		h = (h ^ chars[i]) * 16777619U;
+	}
+	return h;
+}
+
+/**
+ *	CombTable[] ̃Ggmۂ
+ *	CombTable[] ͍Ċmۂ邱Ƃ̂ŁA|C^ێĂƂ͎蒼
+ *
+ *	@return	index, 0 ̂Ƃ͊mۂłȂ
+ */
+static unsigned int CombAlloc(void)
+{
+	unsigned int idx;
+	if (CombFreeIndex == 0) {
+		unsigned int i;
+		unsigned int new_size = CombTableSize == 0 ? 256 : CombTableSize * 2;
+		buff_comb_t *new_table;
+		unsigned int *new_hash;
+		if (new_size > (1U << 30)) {
+			return 0;
 		}
-		else if (idx >= (ptrdiff_t)BufferSize_) {
-			idx -= BufferSize_;
+		new_table = realloc(CombTable, sizeof(buff_comb_t) * new_size);
+		if (new_table == NULL) {
+			return 0;
 		}
-		else {
+		CombTable = new_table;
+		new_hash = realloc(CombHash, sizeof(unsigned int) * new_size);
+		if (new_hash == NULL) {
+			return 0;
+		}
+		CombHash = new_hash;
+		// [0] ͖gpȂ̂ 1 
+		for (i = (CombTableSize == 0 ? 1 : CombTableSize); i < new_size; i++) {
+			memset(&CombTable[i], 0, sizeof(CombTable[i]));
+			CombTable[i].Next = (i + 1 < new_size) ? i + 1 : 0;
+		}
+		CombFreeIndex = CombTableSize == 0 ? 1 : CombTableSize;
+		CombTableSize = new_size;
+
+		// hash 蒼
+		memset(CombHash, 0, sizeof(unsigned int) * new_size);
+		for (i = 1; i < new_size; i++) {
+			buff_comb_t *c = &CombTable[i];
+			if (c->RefCount != 0) {
+				unsigned int bucket = c->Hash & (new_size - 1);
+				c->Next = CombHash[bucket];
+				CombHash[bucket] = i;
+			}
+		}
+	}
+	idx = CombFreeIndex;
+	CombFreeIndex = CombTable[idx].Next;
+	CombTable[idx].Next = 0;
+	CombUsed++;
+	return idx;
+}
+
+/**
+ *	Rrl[ṼGg𓾂
+ *	̃Gg΂L
+ *
+ *	@return	index(QƃJEg1₵Ă), 0 ̂Ƃ͊mۂłȂ
+ */
+static unsigned int CombIntern(const char32_t *chars, size_t count)
+{
+	unsigned int hash = CombHashValue(chars, count);
+	unsigned int idx;
+	unsigned int bucket;
+	buff_comb_t *c;
+	wchar_t u16[MAX_CHAR_SIZE];
+	size_t count16;
+	size_t i;
+
+	if (CombTableSize != 0) {
+		for (idx = CombHash[hash & (CombTableSize - 1)]; idx != 0; idx = CombTable[idx].Next) {
+			c = &CombTable[idx];
+			if (c->Hash == hash && c->CombinationCharCount32 == count &&
+				memcmp(c->pCombinationChars32, chars, sizeof(char32_t) * count) == 0) {
+				c->RefCount++;
+				return idx;
+			}
+		}
+	}
+
+	// UTF-16
+	count16 = 0;
+	for (i = 0; i < count; i++) {
+		wchar_t u16_str[2];
+		size_t wlen = UTF32ToUTF16(chars[i], &u16_str[0], 2);
+		if (count16 + wlen > MAX_CHAR_SIZE) {
 			break;
 		}
+		memcpy(&u16[count16], u16_str, sizeof(wchar_t) * wlen);
+		count16 += wlen;
 	}
-	p = &CodeBuffW_[(int)idx];
-	return p;
+
+	idx = CombAlloc();
+	if (idx == 0) {
+		return 0;
+	}
+	c = &CombTable[idx];
+	c->pCombinationChars32 = malloc(sizeof(char32_t) * count + sizeof(wchar_t) * count16);
+	if (c->pCombinationChars32 == NULL) {
+		c->Next = CombFreeIndex;
+		CombFreeIndex = idx;
+		CombUsed--;
+		return 0;
+	}
+	memcpy(c->pCombinationChars32, chars, sizeof(char32_t) * count);
+	c->pCombinationChars16 = (wchar_t *)(c->pCombinationChars32 + count);
+	memcpy(c->pCombinationChars16, u16, sizeof(wchar_t) * count16);
+	c->CombinationCharCount32 = (unsigned char)count;
+	c->CombinationCharCount16 = (unsigned char)count16;
+	c->RefCount = 1;
+	c->Hash = hash;
+	bucket = hash & (CombTableSize - 1);
+	c->Next = CombHash[bucket];
+	CombHash[bucket] = idx;
+	return idx;
 }
 
-static void FreeCombinationBuf(buff_char_t *b)
+static void CombAddRef(unsigned int idx)
+{
+	if (idx != 0) {
+		CombTable[idx].RefCount++;
+	}
+}
+
+static void CombRelease(unsigned int idx)
 {
-	if (b->pCombinationChars16 != NULL) {
-		free(b->pCombinationChars16);
-		b->pCombinationChars16 = NULL;
+	buff_comb_t *c;
+	unsigned int *link;
+
+	if (idx == 0) {
+		return;
+	}
+	c = &CombTable[idx];
+	assert(c->RefCount > 0);
+	if (--c->RefCount != 0) {
+		return;
 	}
-	b->CombinationCharSize16 = 0;
-	b->CombinationCharCount16 = 0;
 
-	if (b->pCombinationChars32 != NULL) {
-		free(b->pCombinationChars32);
-		b->pCombinationChars32 = NULL;
+	// hash O
+	link = &CombHash[c->Hash & (CombTableSize - 1)];
+	while (*link != idx) {
+		link = &CombTable[*link].Next;
 	}
-	b->CombinationCharSize32 = 0;
-	b->CombinationCharCount32 = 0;
+	*link = c->Next;
+
+	free(c->pCombinationChars32);
+	memset(c, 0, sizeof(*c));
+	c->Next = CombFreeIndex;
+	CombFreeIndex = idx;
+	CombUsed--;
 }
 
-static void DupCombinationBuf(buff_char_t *b)
+static void FreeCombinationBuf(buff_char_t *b)
 {
-	size_t size;
+	CombRelease(b->CombIndex);
+	b->CombIndex = 0;
+}
 
-	size = b->CombinationCharSize16;
-	if (size > 0) {
-		wchar_t *new_buf = malloc(sizeof(wchar_t) * size);
-		memcpy(new_buf, b->pCombinationChars16, sizeof(wchar_t) * size);
-		b->pCombinationChars16 = new_buf;
+/**
+ *	Z̍Ō̕(Rrl[VƂ͍Ō̃Rrl[V)
+ */
+static char32_t GetLastChar(const buff_char_t *b)
+{
+	const buff_comb_t *c = GetComb(b);
+	if (c->CombinationCharCount32 == 0) {
+		return b->u32;
 	}
-	size = b->CombinationCharSize32;
-	if (size > 0) {
-		char32_t *new_buf = malloc(sizeof(char32_t) * size);
-		memcpy(new_buf, b->pCombinationChars32, sizeof(char32_t) * size);
-		b->pCombinationChars32 = new_buf;
+	return c->pCombinationChars32[c->CombinationCharCount32 - 1];
+}
+
+/**
+ *	Z̕(Rrl[V) UTF-16 ŕԂ
+ *
+ *	@param[out]	wc2		UTF-16, TQ[gyAł͂ȂƂ wc2[1] = 0
+ */
+static void GetWC2(const buff_char_t *b, wchar_t *wc2)
+{
+	size_t wstr_len = UTF32ToUTF16(b->u32, &wc2[0], 2);
+	switch (wstr_len) {
+	case 0:
+	default:
+		wc2[0] = 0;
+		wc2[1] = 0;
+		break;
+	case 1:
+		wc2[1] = 0;
+		break;
+	case 2:
+		break;
 	}
 }
 
+#if ENABLE_CELL_INDEX
 static void CopyCombinationBuf(buff_char_t *dest, const buff_char_t *src)
 {
+	int idx = dest->idx;
+
+	// ɎQƂ𑝂₷(dest  src GgQƂĂ邱Ƃ)
+	CombAddRef(src->CombIndex);
 	FreeCombinationBuf(dest);
 
-	// \̂Rs[
-#if ENABLE_CELL_INDEX
-	int idx = dest->idx;
-#endif
+	// \̂Rs[(Zʂԍ͎c)
 	*dest = *src;
-#if ENABLE_CELL_INDEX
 	dest->idx = idx;
-#endif
-
-	DupCombinationBuf(dest);
 }
+#endif
 
 static void BuffSetChar2(buff_char_t *buff, char32_t u32, char property, BOOL half_width, char emoji)
 {
-	size_t wstr_len;
 	buff_char_t *p = buff;
 
 	FreeCombinationBuf(p);
 	p->WidthProperty = property;
 	p->cell = half_width ? 1 : 2;
 	p->u32 = u32;
-	p->u32_last = u32;
 	p->Padding = FALSE;
 	p->Emoji = emoji;
 	p->fg = AttrDefaultFG;
 	p->bg = AttrDefaultBG;
 
-	//
-	wstr_len = UTF32ToUTF16(u32, &p->wc2[0], 2);
-	switch (wstr_len) {
-	case 0:
-	default:
-		p->wc2[0] = 0;
-		p->wc2[1] = 0;
-		break;
-	case 1:
-		p->wc2[1] = 0;
-		break;
-	case 2:
-		break;
-	}
-
 	if (u32 < 0x80) {
 		p->ansi_char = (unsigned short)u32;
 	}
@@ -292,68 +451,70 @@ static void BuffSetChar(buff_char_t *buff, char32_t u32, char property)
  */
 static void BuffAddChar(buff_char_t *buff, char32_t u32)
 {
-	buff_char_t *p = buff;
-	assert(p->u32 != 0);
-	// ɑ̈g傷
-	if (p->CombinationCharSize16 < p->CombinationCharCount16 + 2) {
-		size_t new_size = p->CombinationCharSize16;
-		new_size = new_size == 0 ? 5 : new_size * 2;
-		if (new_size > MAX_CHAR_SIZE) {
-			new_size = MAX_CHAR_SIZE;
-		}
-		if (p->CombinationCharSize16 != new_size) {
-			p->pCombinationChars16 = realloc(p->pCombinationChars16, sizeof(wchar_t) * new_size);
-			p->CombinationCharSize16 = (char)new_size;
-		}
+	const buff_comb_t *c = GetComb(buff);
+	char32_t chars[MAX_CHAR_SIZE];
+	size_t count = c->CombinationCharCount32;
+	unsigned int idx;
+	assert(buff->u32 != 0);
+	if (count >= MAX_CHAR_SIZE) {
+		return;
 	}
-	if (p->CombinationCharSize32 < p->CombinationCharCount32 + 2) {
-		size_t new_size = p->CombinationCharSize32;
-		new_size = new_size == 0 ? 5 : new_size * 2;
-		if (new_size > MAX_CHAR_SIZE) {
-			new_size = MAX_CHAR_SIZE;
-		}
-		if (p->CombinationCharSize32 != new_size) {
-			p->pCombinationChars32 = realloc(p->pCombinationChars32, sizeof(char32_t) * new_size);
-			p->CombinationCharSize32 = (char)new_size;
-		}
+	// 1ǉ̃Ggɒu
+	if (count > 0) {
+		memcpy(chars, c->pCombinationChars32, sizeof(char32_t) * count);
 	}
-
-	// UTF-32
-	if (p->CombinationCharCount32 < p->CombinationCharSize32) {
-		p->u32_last = u32;
-		p->pCombinationChars32[(size_t)p->CombinationCharCount32] = u32;
-		p->CombinationCharCount32++;
+	chars[count] = u32;
+	idx = CombIntern(chars, count + 1);
+	if (idx == 0) {
+		return;
 	}
+	CombRelease(buff->CombIndex);
+	buff->CombIndex = idx;
+}
 
-	// UTF-16
-	if (p->CombinationCharCount16 < p->CombinationCharSize16) {
-		wchar_t u16_str[2];
-		size_t wlen = UTF32ToUTF16(u32, &u16_str[0], 2);
-		if (p->CombinationCharCount16 + wlen <= p->CombinationCharSize16) {
-			size_t i = (size_t)p->CombinationCharCount16;
-			p->pCombinationChars16[i] = u16_str[0];
-			if (wlen == 2) {
-				i++;
-				p->pCombinationChars16[i] = u16_str[1];
-			}
-			p->CombinationCharCount16 += (unsigned char)wlen;
-		}
+/**
+ *	Z̎QƂĂGg̎QƃJEg𑝌
+ */
+static void CombAddRefCells(const buff_char_t *b, size_t count)
+{
+	size_t i;
+	for (i = 0; i < count; i++) {
+		CombAddRef(b[i].CombIndex);
 	}
 }
 
-static void memcpyW(buff_char_t *dest, const buff_char_t *src, size_t count)
+static void CombReleaseCells(const buff_char_t *b, size_t count)
 {
 	size_t i;
+	for (i = 0; i < count; i++) {
+		CombRelease(b[i].CombIndex);
+	}
+}
 
+static void memcpyW(buff_char_t *dest, const buff_char_t *src, size_t count)
+{
 	if (dest == src || count == 0) {
 		return;
 	}
 
-	for (i = 0; i < count; i++) {
-		CopyCombinationBuf(dest, src);
-		dest++;
-		src++;
+#if ENABLE_CELL_INDEX
+	{
+		size_t i;
+		for (i = 0; i < count; i++) {
+			CopyCombinationBuf(dest, src);
+			dest++;
+			src++;
+		}
+	}
+#else
+	if (CombUsed != 0) {
+		// ɎQƂ𑝂₷(dest  src GgQƂĂ邱Ƃ)
+		CombAddRefCells(src, count);
+		CombReleaseCells(dest, count);
 	}
+	// s̃Rs[ł͏dȂĂ邱Ƃ
+	memmove(dest, src, sizeof(buff_char_t) * count);
+#endif
 }
 
 static void memsetW(buff_char_t *dest, wchar_t ch, unsigned char fg, unsigned char bg, unsigned char attr, unsigned char attr2, size_t count)
@@ -371,19 +532,18 @@ static void memsetW(buff_char_t *dest, wchar_t ch, unsigned char fg, unsigned ch
 
 static void memmoveW(buff_char_t *dest, const buff_char_t *src, size_t count)
 {
-	size_t i;
-
 	if (dest == src || count == 0) {
 		return;
 	}
 
-
+#if ENABLE_CELL_INDEX
 	if (dest < src) {
 		// ORs[? -> memcpyW() ok
 		memcpyW(dest, src, count);
 	}
 	else {
 		// 납Rs[
+		size_t i;
 		dest += count - 1;
 		src += count - 1;
 		for (i = 0; i < count; i++) {
@@ -392,6 +552,13 @@ static void memmoveW(buff_char_t *dest, const buff_char_t *src, size_t count)
 			src--;
 		}
 	}
+#else
+	if (CombUsed != 0) {
+		CombAddRefCells(src, count);
+		CombReleaseCells(dest, count);
+	}
+	memmove(dest, src, sizeof(buff_char_t) * count);
+#endif
 }
 
 static BOOL IsBuffPadding(const buff_char_t *b)
@@ -410,33 +577,107 @@ static BOOL IsBuffFullWidth(const buff_char_t *b)
 	return FALSE;
 }
 
-static LONG GetLinePtr(int Line)
+/**
+ *	O̍sԍԂ
+ */
+static int GetRingLine(int Line)
 {
-	LONG Ptr;
-
-	Ptr = (LONG)(BuffStartAbs + Line) * (LONG)(NumOfColumns);
-	while (Ptr>=BufferSize) {
-		Ptr = Ptr - BufferSize;
+	int ring = BuffStartAbs + Line;
+	while (ring >= NumOfLinesInBuff) {
+		ring -= NumOfLinesInBuff;
 	}
-	return Ptr;
+	return ring;
 }
 
+static LONG GetLinePtr(int Line)
+{
+	return (LONG)LineMap[GetRingLine(Line)] * (LONG)NumOfColumns;
+}
+
+/**
+ *	̍s̓̃|C^Ԃ
+ */
 static LONG NextLinePtr(LONG Ptr)
 {
-	Ptr = Ptr + (LONG)NumOfColumns;
-	if (Ptr >= BufferSize) {
-		Ptr = Ptr - BufferSize;
+	int slot = Ptr / NumOfColumns;
+	int x = Ptr - slot * NumOfColumns;
+	int ring = SlotLine[slot] + 1;
+	if (ring >= NumOfLinesInBuff) {
+		ring = 0;
 	}
-	return Ptr;
+	return (LONG)LineMap[ring] * (LONG)NumOfColumns + x;
 }
 
 static LONG PrevLinePtr(LONG Ptr)
 {
-	Ptr = Ptr - (LONG)NumOfColumns;
-	if (Ptr < 0) {
-		Ptr = Ptr + BufferSize;
+	int slot = Ptr / NumOfColumns;
+	int x = Ptr - slot * NumOfColumns;
+	int ring = SlotLine[slot] - 1;
+	if (ring < 0) {
+		ring = NumOfLinesInBuff - 1;
+	}
+	return (LONG)LineMap[ring] * (LONG)NumOfColumns + x;
+}
+
+/**
+ *	buff_char_t  relZړ
+ *	s܂Ƃ́A/O̍sֈړ
+ *
+ *	@param	p			ړ|C^
+ *	@param	rel			ړ
+ *	@retval	ړ̃|C^
+ */
+static buff_char_t *GetPtrRel(buff_char_t *p, int rel)
+{
+	LONG Ptr = (LONG)(p - CodeBuffW);
+	int x = Ptr % NumOfColumns;
+	Ptr -= x;
+	x += rel;
+	while (x < 0) {
+		x += NumOfColumns;
+		Ptr = PrevLinePtr(Ptr);
+	}
+	while (x >= NumOfColumns) {
+		x -= NumOfColumns;
+		Ptr = NextLinePtr(Ptr);
+	}
+	return &CodeBuffW[Ptr + x];
+}
+
+/**
+ *	s [Line1, Line2] ̕т𔽓]
+ */
+static void ReverseLines(int Line1, int Line2)
+{
+	while (Line1 < Line2) {
+		int r1 = GetRingLine(Line1);
+		int r2 = GetRingLine(Line2);
+		int tmp = LineMap[r1];
+		LineMap[r1] = LineMap[r2];
+		LineMap[r2] = tmp;
+		Line1++;
+		Line2--;
+	}
+}
+
+/**
+ *	s [Top, Bottom]  n s։]
+ *	Top+n sڂ Top sڂɂȂATop  n s Bottom ֈڂ
+ *	s̎QƂւ邾ŁAZ̓Rs[Ȃ
+ */
+static void RotateLines(int Top, int Bottom, int n)
+{
+	int i;
+	if (n <= 0 || Top + n > Bottom) {
+		return;
+	}
+	ReverseLines(Top, Top + n - 1);
+	ReverseLines(Top + n, Bottom);
+	ReverseLines(Top, Bottom);
+	for (i = Top; i <= Bottom; i++) {
+		int ring = GetRingLine(i);
+		SlotLine[LineMap[ring]] = ring;
 	}
-	return Ptr;
 }
 
 /**
@@ -446,7 +687,7 @@ static void GetPosFromPtr(const buff_char_t *b, int *bx, int *by)
 {
 	size_t index = b - CodeBuffW;
 	int x = (int)(index % NumOfColumns);
-	int y = (int)(index / NumOfColumns);
+	int y = SlotLine[index / NumOfColumns];
 	if (y >= BuffStartAbs) {
 		y -= BuffStartAbs;
 	}
@@ -464,6 +705,8 @@ static BOOL ChangeBuffer(int Nx, int Ny)
 	LONG SrcPtr, DestPtr;
 	WORD LockOld;
 	buff_char_t *CodeDestW;
+	int *LineMapDest;
+	int *SlotLineDest;
 
 	if (Nx > BuffXMax) {
 		Nx = BuffXMax;
@@ -482,10 +725,22 @@ static BOOL ChangeBuffer(int Nx, int Ny)
 	NewSize = (LONG)Nx * (LONG)Ny;
 
 	CodeDestW = NULL;
+	LineMapDest = NULL;
+	SlotLineDest = NULL;
 	CodeDestW = malloc(NewSize * sizeof(buff_char_t));
 	if (CodeDestW == NULL) {
 		goto allocate_error;
 	}
+	LineMapDest = malloc(Ny * sizeof(int));
+	SlotLineDest = malloc(Ny * sizeof(int));
+	if (LineMapDest == NULL || SlotLineDest == NULL) {
+		goto allocate_error;
+	}
+	// Âobt@s̏ɃRs[̂ŁAVobt@ł͍s slot ͈v
+	for (i = 0; i < Ny; i++) {
+		LineMapDest[i] = i;
+		SlotLineDest[i] = i;
+	}
 
 	memset(&CodeDestW[0], 0, NewSize * sizeof(buff_char_t));
 #if ENABLE_CELL_INDEX
@@ -550,6 +805,8 @@ static BOOL ChangeBuffer(int Nx, int Ny)
 	}
 
 	CodeBuffW = CodeDestW;
+	LineMap = LineMapDest;
+	SlotLine = SlotLineDest;
 	BufferSize = NewSize;
 	NumOfLinesInBuff = Ny;
 	BuffStartAbs = 0;
@@ -576,6 +833,8 @@ static BOOL ChangeBuffer(int Nx, int Ny)
 
 allocate_error:
 	if (CodeDestW)  free(CodeDestW);
+	free(LineMapDest);
+	free(SlotLineDest);
 	return FALSE;
 }
 
@@ -653,6 +912,15 @@ void FreeBuffer(void)
 	for (i = 0; i < NumOfColumns * NumOfLinesInBuff; i++) {
 		FreeCombinationBuf(&CodeBuffW[i]);
 	}
+	if (CombUsed == 0) {
+		// ǂ̃ZQƂĂȂ
+		free(CombTable);
+		CombTable = NULL;
+		free(CombHash);
+		CombHash = NULL;
+		CombTableSize = 0;
+		CombFreeIndex = 0;
+	}
 
 	BuffLock = 1;
 	UnlockBuffer();
@@ -660,6 +928,10 @@ void FreeBuffer(void)
 		free(CodeBuffW);
 		CodeBuffW = NULL;
 	}
+	free(LineMap);
+	LineMap = NULL;
+	free(SlotLine);
+	SlotLine = NULL;
 }
 
 void BuffAllSelect(void)
@@ -737,32 +1009,87 @@ void BuffReset(void)
 	BuffDiscardSavedScreen();
 }
 
-static void BuffScroll(int Count, int Bottom)
+/**
+ *	ʂ̍s [YTop, YBottom] ̍E}[W n sփXN[A󂢂s
+ *	n < 0 ̂Ƃ͉փXN[
+ *	E}[Wʕ̂Ƃ͍s̎QƂւ邾ŁAZ̓Rs[Ȃ
+ */
+static void ScrollRegionLines(int YTop, int YBottom, int n)
 {
-	int i, n;
+	int i;
+	int lines = YBottom - YTop + 1;
+	int linelen = CursorRightM - CursorLeftM + 1;
+	int erase_top, erase_count;
 	LONG SrcPtr, DestPtr;
-	int BuffEndOld;
 
-	if (Count>NumOfLinesInBuff) {
-		Count = NumOfLinesInBuff;
+	if (n == 0 || lines <= 0) {
+		return;
+	}
+	if (n > lines) {
+		n = lines;
+	}
+	else if (n < -lines) {
+		n = -lines;
 	}
 
-	DestPtr = GetLinePtr(PageStart+NumOfLines-1+Count);
-	n = Count;
-	if (Bottom<NumOfLines-1) {
-		SrcPtr = GetLinePtr(PageStart+NumOfLines-1);
-		for (i=NumOfLines-1; i>=Bottom+1; i--) {
-			memcpyW(&(CodeBuffW[DestPtr]),&(CodeBuffW[SrcPtr]),NumOfColumns);
-			memsetW(&(CodeBuffW[SrcPtr]),0x20,CurCharAttr.Fore, CurCharAttr.Back, AttrDefault, CurCharAttr.Attr2 & Attr2ColorMask, NumOfColumns);
+	if (CursorLeftM == 0 && CursorRightM == NumOfColumns-1) {
+		RotateLines(PageStart+YTop, PageStart+YBottom, n > 0 ? n : lines + n);
+		NewLine(PageStart+CursorY);
+	}
+	else if (n > 0) {
+		DestPtr = GetLinePtr(PageStart+YTop) + CursorLeftM;
+		SrcPtr = GetLinePtr(PageStart+YTop+n) + CursorLeftM;
+		for (i = YTop+n ; i<=YBottom ; i++) {
+			memmoveW(&(CodeBuffW[DestPtr]), &(CodeBuffW[SrcPtr]), linelen);
+			SrcPtr = NextLinePtr(SrcPtr);
+			DestPtr = NextLinePtr(DestPtr);
+		}
+	}
+	else {
+		DestPtr = GetLinePtr(PageStart+YBottom) + CursorLeftM;
+		SrcPtr = GetLinePtr(PageStart+YBottom+n) + CursorLeftM;
+		for (i = YBottom+n ; i>=YTop ; i--) {
+			memmoveW(&(CodeBuffW[DestPtr]), &(CodeBuffW[SrcPtr]), linelen);
 			SrcPtr = PrevLinePtr(SrcPtr);
 			DestPtr = PrevLinePtr(DestPtr);
-			n--;
 		}
 	}
-	for (i = 1 ; i <= n ; i++) {
+
+	// 󂢂s
+	erase_count = n > 0 ? n : -n;
+	erase_top = n > 0 ? YBottom+1-n : YTop;
+	DestPtr = GetLinePtr(PageStart+erase_top) + CursorLeftM;
+	for (i = 0 ; i < erase_count ; i++) {
+		memsetW(&(CodeBuffW[DestPtr]), 0x20, CurCharAttr.Fore, CurCharAttr.Back, AttrDefault, CurCharAttr.Attr2 & Attr2ColorMask, linelen);
+		DestPtr = NextLinePtr(DestPtr);
+	}
+}
+
+static void BuffScroll(int Count, int Bottom)
+{
+	int i;
+	int Top, lines;
+	LONG DestPtr;
+	int BuffEndOld;
+
+	if (Count>NumOfLinesInBuff) {
+		Count = NumOfLinesInBuff;
+	}
+
+	// Bottom 艺̍s͉ʏ̈ʒuςȂ
+	//   [Bottom+1, NumOfLines-1+Count] ̍s Count s։]A
+	//   ɗ Count s(XN[ŐVs)
+	Top = PageStart+Bottom+1;
+	lines = NumOfLines-1-Bottom+Count;
+	if (lines > NumOfLinesInBuff) {
+		lines = NumOfLinesInBuff;
+	}
+	RotateLines(Top, Top+lines-1, lines-Count);
+	DestPtr = GetLinePtr(Top);
+	for (i = 1 ; i <= Count ; i++) {
 		buff_char_t *b = &CodeBuffW[DestPtr];
 		memsetW(b ,0x20, CurCharAttr.Fore, CurCharAttr.Back, AttrDefault, CurCharAttr.Attr2 & Attr2ColorMask, NumOfColumns);
-		DestPtr = PrevLinePtr(DestPtr);
+		DestPtr = NextLinePtr(DestPtr);
 	}
 
 	BuffEndAbs = BuffEndAbs + Count;
@@ -1002,9 +1329,7 @@ void BuffInsertLines(int Count, int YEnd)
 //   Count: number of lines to be inserted
 //   YEnd: bottom line number of scroll region (screen coordinate)
 {
-	int i, linelen;
 	int extl=0, extr=0;
-	LONG SrcPtr, DestPtr;
 
 	BuffUpdateScroll();
 
@@ -1015,18 +1340,7 @@ void BuffInsertLines(int Count, int YEnd)
 	if (extl || extr)
 		EraseKanjiOnLRMargin(GetLinePtr(PageStart+CursorY), YEnd-CursorY+1);
 
-	SrcPtr = GetLinePtr(PageStart+YEnd-Count) + CursorLeftM;
-	DestPtr = GetLinePtr(PageStart+YEnd) + CursorLeftM;
-	linelen = CursorRightM - CursorLeftM + 1;
-	for (i= YEnd-Count ; i>=CursorY ; i--) {
-		memcpyW(&(CodeBuffW[DestPtr]), &(CodeBuffW[SrcPtr]), linelen);
-		SrcPtr = PrevLinePtr(SrcPtr);
-		DestPtr = PrevLinePtr(DestPtr);
-	}
-	for (i = 1 ; i <= Count ; i++) {
-		memsetW(&(CodeBuffW[DestPtr]), 0x20, CurCharAttr.Fore, CurCharAttr.Back, AttrDefault, CurCharAttr.Attr2 & Attr2ColorMask, linelen);
-		DestPtr = PrevLinePtr(DestPtr);
-	}
+	ScrollRegionLines(CursorY, YEnd, -Count);
 
 	if (CursorLeftM > 0 || CursorRightM < NumOfColumns-1 || !DispInsertLines(Count, YEnd)) {
 		BuffUpdateRect(CursorLeftM-extl, CursorY, CursorRightM+extr, YEnd);
@@ -1091,9 +1405,7 @@ void BuffDeleteLines(int Count, int YEnd)
 //   Count: number of lines to be deleted
 //   YEnd: bottom line number of scroll region (screen coordinate)
 {
-	int i, linelen;
 	int extl=0, extr=0;
-	LONG SrcPtr, DestPtr;
 
 	BuffUpdateScroll();
 
@@ -1104,18 +1416,7 @@ void BuffDeleteLines(int Count, int YEnd)
 	if (extl || extr)
 		EraseKanjiOnLRMargin(GetLinePtr(PageStart+CursorY), YEnd-CursorY+1);
 
-	SrcPtr = GetLinePtr(PageStart+CursorY+Count) + (LONG)CursorLeftM;
-	DestPtr = GetLinePtr(PageStart+CursorY) + (LONG)CursorLeftM;
-	linelen = CursorRightM - CursorLeftM + 1;
-	for (i=CursorY ; i<= YEnd-Count ; i++) {
-		memcpyW(&(CodeBuffW[DestPtr]), &(CodeBuffW[SrcPtr]), linelen);
-		SrcPtr = NextLinePtr(SrcPtr);
-		DestPtr = NextLinePtr(DestPtr);
-	}
-	for (i = YEnd+1-Count ; i<=YEnd ; i++) {
-		memsetW(&(CodeBuffW[DestPtr]), 0x20, CurCharAttr.Fore, CurCharAttr.Back, AttrDefault, CurCharAttr.Attr2 & Attr2ColorMask, linelen);
-		DestPtr = NextLinePtr(DestPtr);
-	}
+	ScrollRegionLines(CursorY, YEnd, Count);
 
 	if (CursorLeftM > 0 || CursorRightM < NumOfColumns-1 || ! DispDeleteLines(Count,YEnd)) {
 		BuffUpdateRect(CursorLeftM-extl, CursorY, CursorRightM+extr, YEnd);
@@ -1768,9 +2069,11 @@ static wchar_t *BuffGetStringForCB(int sx, int sy, int ex, int ey, BOOL box_sele
 		while (x < IEnd) {
 			const buff_char_t *b = &CodeBuffW[TmpPtr + x];
 			if (b->u32 != 0) {
-				str_w[k++] = b->wc2[0];
-				if (b->wc2[1] != 0) {
-					str_w[k++] = b->wc2[1];
+				wchar_t wc2[2];
+				GetWC2(b, wc2);
+				str_w[k++] = wc2[0];
+				if (wc2[1] != 0) {
+					str_w[k++] = wc2[1];
 				}
 				if (k + 2 >= str_size) {
 					str_size *= 2;
@@ -1778,13 +2081,14 @@ static wchar_t *BuffGetStringForCB(int sx, int sy, int ex, int ey, BOOL box_sele
 				}
 				{
 					int i;
+					const buff_comb_t *comb = GetComb(b);
 					// Rrl[V
-					if (k + b->CombinationCharCount16 >= str_size) {
-						str_size += + b->CombinationCharCount16;
+					if (k + comb->CombinationCharCount16 >= str_size) {
+						str_size += + comb->CombinationCharCount16;
 						str_w = realloc(str_w, sizeof(wchar_t) * str_size);
 					}
-					for (i = 0 ; i < (int)b->CombinationCharCount16; i++) {
-						str_w[k++] = b->pCombinationChars16[i];
+					for (i = 0 ; i < (int)comb->CombinationCharCount16; i++) {
+						str_w[k++] = comb->pCombinationChars16[i];
 					}
 				}
 			}
@@ -1829,6 +2133,8 @@ static wchar_t *BuffGetStringForCB(int sx, int sy, int ex, int ey, BOOL box_sele
 static size_t expand_wchar(const buff_char_t *b, wchar_t *buf, size_t buf_size, BOOL *too_samll)
 {
 	size_t len;
+	wchar_t wc2[2];
+	const buff_comb_t *comb = GetComb(b);
 
 	if (IsBuffPadding(b)) {
 		if (too_samll != NULL) {
@@ -1838,8 +2144,9 @@ static size_t expand_wchar(const buff_char_t *b, wchar_t *buf, size_t buf_size,
 	}
 
 	// 𑪂
+	GetWC2(b, wc2);
 	len = 0;
-	if (b->wc2[1] == 0) {
+	if (wc2[1] == 0) {
 		// TQ[gyAł͂Ȃ
 		len++;
 	} else {
@@ -1847,7 +2154,7 @@ static size_t expand_wchar(const buff_char_t *b, wchar_t *buf, size_t buf_size,
 		len += 2;
 	}
 	// Rrl[V
-	len += b->CombinationCharCount16;
+	len += comb->CombinationCharCount16;
 
 	if (buf == NULL) {
 		// Ԃ
@@ -1867,12 +2174,12 @@ static size_t expand_wchar(const buff_char_t *b, wchar_t *buf, size_t buf_size,
 	}
 
 	// WJĂ
-	*buf++ = b->wc2[0];
-	if (b->wc2[1] != 0) {
-		*buf++ = b->wc2[1];
+	*buf++ = wc2[0];
+	if (wc2[1] != 0) {
+		*buf++ = wc2[1];
 	}
-	if (b->CombinationCharCount16 != 0) {
-		memcpy(buf, b->pCombinationChars16, b->CombinationCharCount16 * sizeof(wchar_t));
+	if (comb->CombinationCharCount16 != 0) {
+		memcpy(buf, comb->pCombinationChars16, comb->CombinationCharCount16 * sizeof(wchar_t));
 	}
 
 	return len;
@@ -1891,12 +2198,15 @@ static size_t expand_wchar(const buff_char_t *b, wchar_t *buf, size_t buf_size,
 static size_t MatchOneStringPtr(const buff_char_t *b, const wchar_t *str, size_t len)
 {
 	int match_pos = 0;
+	wchar_t wc2[2];
+	const buff_comb_t *comb = GetComb(b);
 	if (len == 0) {
 		return 0;
 	}
-	if (b->wc2[1] == 0) {
+	GetWC2(b, wc2);
+	if (wc2[1] == 0) {
 		// TQ[gyAł͂Ȃ
-		if (str[match_pos] != b->wc2[0]) {
+		if (str[match_pos] != wc2[0]) {
 			return 0;
 		}
 		match_pos++;
@@ -1906,25 +2216,25 @@ static size_t MatchOneStringPtr(const buff_char_t *b, const wchar_t *str, size_t
 		if (len < 2) {
 			return 0;
 		}
-		if (str[match_pos+0] != b->wc2[0] ||
-			str[match_pos+1] != b->wc2[1]) {
+		if (str[match_pos+0] != wc2[0] ||
+			str[match_pos+1] != wc2[1]) {
 			return 0;
 		}
 		match_pos+=2;
 		len-=2;
 	}
-	if (b->CombinationCharCount16 > 0) {
+	if (comb->CombinationCharCount16 > 0) {
 		// Rrl[V
 		int i;
-		if (len < b->CombinationCharCount16) {
+		if (len < comb->CombinationCharCount16) {
 			return 0;
 		}
-		for (i = 0 ; i < (int)b->CombinationCharCount16; i++) {
-			if (str[match_pos++] != b->pCombinationChars16[i]) {
+		for (i = 0 ; i < (int)comb->CombinationCharCount16; i++) {
+			if (str[match_pos++] != comb->pCombinationChars16[i]) {
 				return 0;
 			}
 		}
-		len -= b->CombinationCharCount16;
+		len -= comb->CombinationCharCount16;
 	}
 	return match_pos;
 }
@@ -2475,14 +2785,16 @@ static void mark_url_line_w(int cur_x, int cur_y)
 	const buff_char_t *b;
 
 	// URL̐擪T
-	TmpPtr = GetLinePtr(PageStart + cur_y) + cur_x - 1;	// J[\ʒu|C^
+	TmpPtr = GetLinePtr(PageStart + cur_y) + cur_x;	// J[\ʒu|C^
+	TmpPtr = (LONG)(GetPtrRel(&CodeBuffW[TmpPtr], -1) - CodeBuffW);
 	while ((CodeBuffW[TmpPtr].attr & AttrURL) != 0) {
-		if (TmpPtr == 0) {
+		if (TmpPtr == GetLinePtr(0)) {
+			// obt@̐擪
 			break;
 		}
-		TmpPtr--;
+		TmpPtr = (LONG)(GetPtrRel(&CodeBuffW[TmpPtr], -1) - CodeBuffW);
 	}
-	TmpPtr++;
+	TmpPtr = (LONG)(GetPtrRel(&CodeBuffW[TmpPtr], 1) - CodeBuffW);
 
 	// |C^J[\ʒu
 	GetPosFromPtr(&CodeBuffW[TmpPtr], &sx, &sy);
@@ -2749,20 +3061,25 @@ static void mark_url_w(int cur_x, int cur_y)
  */
 static wchar_t *GetWCS(const buff_char_t *b)
 {
-	size_t len = (b->wc2[1] == 0) ? 2 : 3;
+	wchar_t wc2[2];
+	const buff_comb_t *comb = GetComb(b);
+	size_t len;
 	wchar_t *strW;
 	wchar_t *p;
 	int i;
 
-	len += b->CombinationCharCount16;
+	GetWC2(b, wc2);
+	len = (wc2[1] == 0) ? 2 : 3;
+
+	len += comb->CombinationCharCount16;
 	strW = malloc(sizeof(wchar_t) * len);
 	p = strW;
-	*p++ = b->wc2[0];
-	if (b->wc2[1] != 0) {
-		*p++ = b->wc2[1];
+	*p++ = wc2[0];
+	if (wc2[1] != 0) {
+		*p++ = wc2[1];
 	}
-	for (i=0; i<b->CombinationCharCount16; i++) {
-		*p++ = b->pCombinationChars16[i];
+	for (i=0; i<comb->CombinationCharCount16; i++) {
+		*p++ = comb->pCombinationChars16[i];
 	}
 	*p = L'\0';
 	return strW;
@@ -2829,17 +3146,17 @@ static buff_char_t *IsCombiningChar(int x, int y, BOOL wrap, unsigned int u32, i
 
 	// ?
 	// 		1O ZWJ
-	if (combine_type != 0 || (p->u32_last == 0x200d)) {
+	if (combine_type != 0 || (GetLastChar(p) == 0x200d)) {
 		return p;
 	}
 
 	// B[}
-	if (UnicodeIsVirama(p->u32_last) != 0) {
+	if (UnicodeIsVirama(GetLastChar(p)) != 0) {
 		// 1ÕB[}Ɠ block ̕ł
-		int block_index_last = UnicodeBlockIndex(p->u32_last);
+		int block_index_last = UnicodeBlockIndex(GetLastChar(p));
 		int block_index = UnicodeBlockIndex(u32);
 #if 0
-		OutputDebugPrintf("U+%06x, %d, %s\n", p->u32_last, block_index_last, UnicodeBlockName(block_index_last));
+		OutputDebugPrintf("U+%06x, %d, %s\n", GetLastChar(p), block_index_last, UnicodeBlockName(block_index_last));
 		OutputDebugPrintf("U+%06x, %d, %s\n", u32, block_index, UnicodeBlockName(block_index));
 #endif
 		if (block_index_last == block_index) {
@@ -2958,7 +3275,7 @@ int BuffPutUnicode(unsigned int u32, const TCharAttr *Attr, BOOL Insert)
 
 		// ͕́ANonspacing mark ȊO?
 		//		J[\+1, +1
-		if (p->u32_last != 0x200d && combining_type != 1) {
+		if (GetLastChar(p) != 0x200d && combining_type != 1) {
 			// J[\ړʂ1
 			move_x = 1;
 
@@ -3077,12 +3394,12 @@ int BuffPutUnicode(unsigned int u32, const TCharAttr *Attr, BOOL Insert)
 		}
 
 		{
-			buff_char_t *p1 = GetPtrRel(CodeBuffW, BufferSize, p, 1);
+			buff_char_t *p1 = GetPtrRel(p, 1);
 
 			// ̕Sp && ͕Sp ?
 			if (!Insert && !half_width && IsBuffFullWidth(p1)) {
 				// Spׂ
-				buff_char_t *p2 = GetPtrRel(CodeBuffW, BufferSize, p1, 1);
+				buff_char_t *p2 = GetPtrRel(p1, 1);
 				BuffSetChar(p1, ' ', 'H');
 				BuffSetChar(p2, ' ', 'H');
 			}
@@ -3360,30 +3677,33 @@ void BuffGetDrawInfoW(int SY, int IStart, int IEnd,
 		}
 
 		if (SetString) {
+			wchar_t wc2[2];
+			const buff_comb_t *comb = GetComb(b);
+			GetWC2(b, wc2);
 			if (b->u32 < 0x10000) {
-				bufW[lenW] = b->wc2[0];
+				bufW[lenW] = wc2[0];
 				bufWW[lenW] = b->cell;
 				lenW++;
 			} else {
 				// UTF-16ŃTQ[gyA
-				bufW[lenW] = b->wc2[0];
+				bufW[lenW] = wc2[0];
 				bufWW[lenW] = 0;
 				lenW++;
-				bufW[lenW] = b->wc2[1];
+				bufW[lenW] = wc2[1];
 				bufWW[lenW] = b->cell;
 				lenW++;
 			}
-			if (b->CombinationCharCount16 != 0) {
+			if (comb->CombinationCharCount16 != 0) {
 				// Rrl[V
 				int i;
 				const char cell_tmp = bufWW[lenW - 1];
 				bufWW[lenW - 1] = 0;
-				for (i = 0; i < (int)b->CombinationCharCount16; i++) {
-					bufW[lenW + i] = b->pCombinationChars16[i];
+				for (i = 0; i < (int)comb->CombinationCharCount16; i++) {
+					bufW[lenW + i] = comb->pCombinationChars16[i];
 					bufWW[lenW + i] = 0;
 				}
-				bufWW[lenW + b->CombinationCharCount16 - 1] = cell_tmp;
-				lenW += b->CombinationCharCount16;
+				bufWW[lenW + comb->CombinationCharCount16 - 1] = cell_tmp;
+				lenW += comb->CombinationCharCount16;
 				DrawFlag = TRUE;  // Rrl[Vꍇ͂`
 			}
 
@@ -3678,9 +3998,7 @@ void BuffSetCaretWidth(void)
 
 void ScrollUp1Line(void)
 {
-	int i, linelen;
 	int extl=0, extr=0;
-	LONG SrcPtr, DestPtr;
 
 	if ((CursorTop<=CursorY) && (CursorY<=CursorBottom)) {
 		UpdateStr();
@@ -3692,14 +4010,7 @@ void ScrollUp1Line(void)
 		if (extl || extr)
 			EraseKanjiOnLRMargin(GetLinePtr(PageStart+CursorTop), CursorBottom-CursorTop+1);
 
-		linelen = CursorRightM - CursorLeftM + 1;
-		DestPtr = GetLinePtr(PageStart+CursorBottom) + CursorLeftM;
-		for (i = CursorBottom-1 ; i >= CursorTop ; i--) {
-			SrcPtr = PrevLinePtr(DestPtr);
-			memcpyW(&(CodeBuffW[DestPtr]), &(CodeBuffW[SrcPtr]), linelen);
-			DestPtr = SrcPtr;
-		}
-		memsetW(&(CodeBuffW[SrcPtr]), 0x20, CurCharAttr.Fore, CurCharAttr.Back, AttrDefault, CurCharAttr.Attr2 & Attr2ColorMask, linelen);
+		ScrollRegionLines(CursorTop, CursorBottom, -1);
 
 		if (CursorLeftM > 0 || CursorRightM < NumOfColumns-1)
 			BuffUpdateRect(CursorLeftM-extl, CursorTop, CursorRightM+extr, CursorBottom);
@@ -3710,9 +4021,7 @@ void ScrollUp1Line(void)
 
 void BuffScrollNLines(int n)
 {
-	int i, linelen;
 	int extl=0, extr=0;
-	LONG SrcPtr, DestPtr;
 
 	if (n<1) {
 		return;
@@ -3754,23 +4063,10 @@ void BuffScrollNLines(int n)
 		if (extl || extr)
 			EraseKanjiOnLRMargin(GetLinePtr(PageStart+CursorTop), CursorBottom-CursorTop+1);
 
-		linelen = CursorRightM - CursorLeftM + 1;
-		DestPtr = GetLinePtr(PageStart+CursorTop) + (LONG)CursorLeftM;
-		if (n<CursorBottom-CursorTop+1) {
-			SrcPtr = GetLinePtr(PageStart+CursorTop+n) + (LONG)CursorLeftM;
-			for (i = CursorTop+n ; i<=CursorBottom ; i++) {
-				memmoveW(&(CodeBuffW[DestPtr]), &(CodeBuffW[SrcPtr]), linelen);
-				SrcPtr = NextLinePtr(SrcPtr);
-				DestPtr = NextLinePtr(DestPtr);
-			}
-		}
-		else {
+		if (n > CursorBottom-CursorTop+1) {
 			n = CursorBottom-CursorTop+1;
 		}
-		for (i = CursorBottom+1-n ; i<=CursorBottom; i++) {
-			memsetW(&(CodeBuffW[DestPtr]), 0x20, CurCharAttr.Fore, CurCharAttr.Back, AttrDefault, CurCharAttr.Attr2 & Attr2ColorMask, linelen);
-			DestPtr = NextLinePtr(DestPtr);
-		}
+		ScrollRegionLines(CursorTop, CursorBottom, n);
 		if (CursorLeftM > 0 || CursorRightM < NumOfColumns-1)
 			BuffUpdateRect(CursorLeftM-extl, CursorTop, CursorRightM+extr, CursorBottom);
 		else
@@ -3779,9 +4075,7 @@ void BuffScrollNLines(int n)
 }
 
 void BuffRegionScrollUpNLines(int n) {
-	int i, linelen;
 	int extl=0, extr=0;
-	LONG SrcPtr, DestPtr;
 
 	if (n<1) {
 		return;
@@ -3807,23 +4101,10 @@ void BuffRegionScrollUpNLines(int n) {
 		if (extl || extr)
 			EraseKanjiOnLRMargin(GetLinePtr(PageStart+CursorTop), CursorBottom-CursorTop+1);
 
-		DestPtr = GetLinePtr(PageStart+CursorTop) + CursorLeftM;
-		linelen = CursorRightM - CursorLeftM + 1;
-		if (n < CursorBottom - CursorTop + 1) {
-			SrcPtr = GetLinePtr(PageStart+CursorTop+n) + CursorLeftM;
-			for (i = CursorTop+n ; i<=CursorBottom ; i++) {
-				memmoveW(&(CodeBuffW[DestPtr]), &(CodeBuffW[SrcPtr]), linelen);
-				SrcPtr = NextLinePtr(SrcPtr);
-				DestPtr = NextLinePtr(DestPtr);
-			}
-		}
-		else {
+		if (n > CursorBottom - CursorTop + 1) {
 			n = CursorBottom - CursorTop + 1;
 		}
-		for (i = CursorBottom+1-n ; i<=CursorBottom; i++) {
-			memsetW(&(CodeBuffW[DestPtr]), 0x20, CurCharAttr.Fore, CurCharAttr.Back, AttrDefault, CurCharAttr.Attr2 & Attr2ColorMask, linelen);
-			DestPtr = NextLinePtr(DestPtr);
-		}
+		ScrollRegionLines(CursorTop, CursorBottom, n);
 
 		if (CursorLeftM > 0 || CursorRightM < NumOfColumns-1) {
 			BuffUpdateRect(CursorLeftM-extl, CursorTop, CursorRightM+extr, CursorBottom);
@@ -3835,9 +4116,7 @@ void BuffRegionScrollUpNLines(int n) {
 }
 
 void BuffRegionScrollDownNLines(int n) {
-	int i, linelen;
 	int extl=0, extr=0;
-	LONG SrcPtr, DestPtr;
 
 	if (n<1) {
 		return;
@@ -3851,23 +4130,10 @@ void BuffRegionScrollDownNLines(int n) {
 	if (extl || extr)
 		EraseKanjiOnLRMargin(GetLinePtr(PageStart+CursorTop), CursorBottom-CursorTop+1);
 
-	DestPtr = GetLinePtr(PageStart+CursorBottom) + CursorLeftM;
-	linelen = CursorRightM - CursorLeftM + 1;
-	if (n < CursorBottom - CursorTop + 1) {
-		SrcPtr = GetLinePtr(PageStart+CursorBottom-n) + CursorLeftM;
-		for (i=CursorBottom-n ; i>=CursorTop ; i--) {
-			memmoveW(&(CodeBuffW[DestPtr]), &(CodeBuffW[SrcPtr]), linelen);
-			SrcPtr = PrevLinePtr(SrcPtr);
-			DestPtr = PrevLinePtr(DestPtr);
-		}
-	}
-	else {
+	if (n > CursorBottom - CursorTop + 1) {
 		n = CursorBottom - CursorTop + 1;
 	}
-	for (i = CursorTop+n-1; i>=CursorTop; i--) {
-		memsetW(&(CodeBuffW[DestPtr]), 0x20, CurCharAttr.Fore, CurCharAttr.Back, AttrDefault, CurCharAttr.Attr2 & Attr2ColorMask, linelen);
-		DestPtr = PrevLinePtr(DestPtr);
-	}
+	ScrollRegionLines(CursorTop, CursorBottom, -n);
 
 	if (CursorLeftM > 0 || CursorRightM < NumOfColumns-1) {
 		BuffUpdateRect(CursorLeftM-extl, CursorTop, CursorRightM+extr, CursorBottom);
@@ -5857,22 +6123,25 @@ wchar_t *BuffGetCharInfo(int Xw, int Yw)
 	{
 		wchar_t *codes_ptr = NULL;
 		wchar_t *code_str;
+		wchar_t wc2[2];
+		const buff_comb_t *comb = GetComb(b);
 		int i;
 
+		GetWC2(b, wc2);
 		aswprintf(&code_str,
 				  L"Unicode UTF-16:\n"
 				  L" 0x%04x\n",
-				  b->wc2[0]);
+				  wc2[0]);
 		awcscat(&codes_ptr, code_str);
 		free(code_str);
-		if (b->wc2[1] != 0 ) {
+		if (wc2[1] != 0 ) {
 			wchar_t buf[32];
-			swprintf(buf, _countof(buf), L" 0x%04x\n", b->wc2[1]);
+			swprintf(buf, _countof(buf), L" 0x%04x\n", wc2[1]);
 			awcscat(&codes_ptr, buf);
 		}
-		for (i=0; i<b->CombinationCharCount16; i++) {
+		for (i=0; i<comb->CombinationCharCount16; i++) {
 			wchar_t buf[32];
-			swprintf(buf, _countof(buf), L" 0x%04x\n", b->pCombinationChars16[i]);
+			swprintf(buf, _countof(buf), L" 0x%04x\n", comb->pCombinationChars16[i]);
 			awcscat(&codes_ptr, buf);
 		}
 		unicode_utf16_str = codes_ptr;
@@ -5882,14 +6151,15 @@ wchar_t *BuffGetCharInfo(int Xw, int Yw)
 	{
 		wchar_t *codes_ptr = NULL;
 		wchar_t *code_str;
+		const buff_comb_t *comb = GetComb(b);
 		int i;
 
 		awcscat(&codes_ptr, L"Unicode UTF-32:\n");
 		code_str = UnicodeCodePointStr(b->u32);
 		awcscats(&codes_ptr, L" ", code_str, L"\n", NULL);
 		free(code_str);
-		for (i=0; i<b->CombinationCharCount32; i++) {
-			code_str = UnicodeCodePointStr(b->pCombinationChars32[i]);
+		for (i=0; i<comb->CombinationCharCount32; i++) {
+			code_str = UnicodeCodePointStr(comb->pCombinationChars32[i]);
 			awcscats(&codes_ptr, L" ", code_str, L"\n", NULL);
 			free(code_str);
 		}
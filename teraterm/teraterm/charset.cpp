@@ -34,6 +34,7 @@
 #include <stdlib.h>
 #include <crtdbg.h>
 #include <assert.h>
+#include <stdint.h>
 #include <windows.h>
 
 #include "ttwinman.h"	// for ts
@@ -919,6 +920,118 @@ void ParseFirst(CharSetData *w, BYTE b)
 		w->Op.PutU32(b, w->ClientData);
 }
 
+/**
+ *	\\ASCII(0x20-0x7e)oCgԂ
+ *	8byte܂Ƃ߂Ĕ肷
+ */
+static size_t ScanPrintableASCII(const BYTE *ptr, size_t len)
+{
+	const uint64_t ones = 0x0101010101010101ULL;
+	const uint64_t highs = 0x8080808080808080ULL;
+	size_t i = 0;
+
+	while (i + 8 <= len) {
+		uint64_t x;
+		uint64_t del;
+		memcpy(&x, ptr + i, sizeof(x));
+		del = x ^ (ones * 0x7f);
+		if (((x & highs) |						// 0x80ȏ
+			 ((x - ones * 0x20) & ~x & highs) |	// 0x20
+			 ((del - ones) & ~del & highs))		// 0x7f
+			!= 0) {
+			break;
+		}
+		i += 8;
+	}
+	while (i < len && 0x20 <= ptr[i] && ptr[i] <= 0x7e) {
+		i++;
+	}
+	return i;
+}
+
+/**
+ *	UTF-8 1(2byteȏ)o
+ *
+ *	@param[out]	code	Unicode
+ *	@return		̃oCg
+ *				0 ̂ƂUTF-8ł͂Ȃ or rœr؂Ă
+ */
+static size_t GetUTF8Char(const BYTE *p, size_t len, char32_t *code)
+{
+	const BYTE b = p[0];
+	if (0xc2 <= b && b <= 0xdf) {
+		if (len < 2 || (p[1] & 0xc0) != 0x80) {
+			return 0;
+		}
+		*code = ((b & 0x1f) << 6) | (p[1] & 0x3f);
+		return 2;
+	}
+	if ((b & 0xf0) == 0xe0) {
+		if (len < 3 || (p[1] & 0xc0) != 0x80 || (p[2] & 0xc0) != 0x80) {
+			return 0;
+		}
+		if ((b == 0xe0 && p[1] < 0xa0) || (b == 0xed && 0x9f < p[1])) {
+			return 0;
+		}
+		*code = ((b & 0xf) << 12) | ((p[1] & 0x3f) << 6) | (p[2] & 0x3f);
+		return 3;
+	}
+	if (0xf0 <= b && b <= 0xf4) {
+		if (len < 4 || (p[1] & 0xc0) != 0x80 || (p[2] & 0xc0) != 0x80 || (p[3] & 0xc0) != 0x80) {
+			return 0;
+		}
+		if ((b == 0xf0 && p[1] < 0x90) || (b == 0xf4 && 0x8f < p[1])) {
+			return 0;
+		}
+		*code = ((b & 0x07) << 18) | ((p[1] & 0x3f) << 12) | ((p[2] & 0x3f) << 6) | (p[3] & 0x3f);
+		return 4;
+	}
+	return 0;
+}
+
+/**
+ *	\AĂ镔܂Ƃ߂ď
+ *	UTF-8 ̂ƂA䕶EsUTF-8Erœr؂ꂽ̎O܂ŏ
+ *	ȊO̕R[hA̓ȑԂ̂Ƃ͉Ȃ
+ *	c ParseFirst() 1byte
+ *
+ *	@param	ptr		Mf[^
+ *	@param	len		Mf[^̃oCg
+ *	@return	oCg
+ */
+size_t ParseFirstRun(CharSetData *w, const BYTE *ptr, size_t len)
+{
+	size_t i = 0;
+
+	if (ts.KanjiCode != IdUTF8 || w->DebugFlag != DEBUG_FLAG_NONE) {
+		return 0;
+	}
+	if (w->count != 0 || w->Fallbacked) {
+		// UTF-8 ̓r or fallback 
+		return 0;
+	}
+
+	while (i < len) {
+		size_t n = ScanPrintableASCII(ptr + i, len - i);
+		if (n > 0) {
+			size_t end = i + n;
+			for (; i < end; i++) {
+				w->Op.PutU32(ptr[i], w->ClientData);
+			}
+		}
+		else {
+			char32_t code;
+			n = GetUTF8Char(ptr + i, len - i, &code);
+			if (n == 0 || IsC1(code)) {
+				break;
+			}
+			w->Op.PutU32(code, w->ClientData);
+			i += n;
+		}
+	}
+	return i;
+}
+
 /**
  *	w(Designate)
  *
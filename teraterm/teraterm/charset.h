@@ -56,6 +56,7 @@ typedef enum {
 
 // input
 void ParseFirst(CharSetData *w, BYTE b);
+size_t ParseFirstRun(CharSetData *w, const BYTE *ptr, size_t len);
 
 // control
 typedef enum {
@@ -51,6 +51,7 @@
 #include "helpid.h"
 #include "vtwin.h"
 #include "makeoutputstring.h"
+#include "spsc_ring.h"
 
 static SOCKET OpenSocket(PComVar);
 static void AsyncConnect(PComVar);
@@ -115,6 +116,13 @@ static int CloseSocket(SOCKET s)
 static HANDLE ReadEnd;
 static OVERLAPPED wol, rol;
 
+// VAAOtpCv̎M
+//	MXbh RecvQueue ɓǂݍ݁AUIXbh InBuff ֎o
+//	RecvQueue t̂Ƃ UIXbho ReadEnd Zbg܂ő҂
+static SpscRing *RecvQueue;
+static HANDLE RecvThread;
+static volatile LONG RecvNotify;	// WM_USER_COMMNOTIFY(FD_READ) 𑗂Ė
+
 // Winsock async operation handle
 static HANDLE HAsync=0;
 
@@ -142,6 +150,60 @@ void CommInit(PComVar cv)
 	cv->NotifyIcon = NULL;
 
 	cv->ConnectedTime = 0;
+
+	cv->InBuff = NULL;
+	cv->InBuffLen = 0;
+}
+
+/**
+ *	Mobt@(Oobt@)mۂ
+ *	TCY ts->ReceiveBufferSizeAOƃTCYقȂƂ͊mۂȂ
+ */
+static void CommAllocInBuff(PTTSet ts, PComVar cv)
+{
+	int size = ts->ReceiveBufferSize;
+	if (size < InBuffSize) {
+		size = InBuffSize;
+	}
+	else if (size > InBuffSizeMax) {
+		size = InBuffSizeMax;
+	}
+
+	if (cv->InBuff != NULL && cv->InBuffLen == size) {
+		return;
+	}
+	free(cv->InBuff);
+	cv->InBuff = (BYTE *)malloc(size);
+	if (cv->InBuff == NULL) {
+		size = InBuffSize;
+		cv->InBuff = (BYTE *)malloc(size);
+	}
+	cv->InBuffLen = (cv->InBuff != NULL) ? size : 0;
+}
+
+/**
+ *	Mobt@̏݉\ȘÄԂ
+ *
+ *	@param[out]	ptr		݈ʒu
+ *	@return				߂oCg
+ */
+static DWORD InBuffFreeSpan(PComVar cv, BYTE **ptr)
+{
+	int WritePtr;
+
+	if (cv->InBuffCount == 0) {
+		// ̂Ƃ͐擪g
+		cv->InPtr = 0;
+	}
+	WritePtr = cv->InPtr + cv->InBuffCount;
+	if (WritePtr >= cv->InBuffLen) {
+		WritePtr -= cv->InBuffLen;
+	}
+	*ptr = &cv->InBuff[WritePtr];
+	if (WritePtr < cv->InPtr) {
+		return cv->InPtr - WritePtr;
+	}
+	return cv->InBuffLen - WritePtr;
 }
 
 /* reset a serial port which is already open */
@@ -292,6 +354,7 @@ void CommOpen(HWND HW, PTTSet ts, PComVar cv)
 	}
 
 	/* initialize ComVar */
+	CommAllocInBuff(ts, cv);
 	cv->InBuffCount = 0;
 	cv->InPtr = 0;
 	cv->OutBuffCount = 0;
@@ -599,76 +662,189 @@ BreakSC:
 	}
 }
 
+/**
+ *	MXbhUIXbh֎Mʒm
+ *	ʒmς݂ŁAUIXbh܂on߂ĂȂΑȂ
+ */
+static void RecvQueueNotify(PComVar cv)
+{
+	if (InterlockedExchange(&RecvNotify, 1) == 0) {
+		PostMessage(cv->HWin, WM_USER_COMMNOTIFY, 0, FD_READ);
+	}
+}
+
+/**
+ *	RecvQueue ̏݉\ȘÄ𓾂
+ *	t̂ƂUIXbho܂ő҂
+ *
+ *	@param[out]	ptr		݈ʒu
+ *	@return				߂oCgA0̂Ƃ̓N[Y
+ */
+static DWORD RecvQueueWriteSpan(PComVar cv, BYTE **ptr)
+{
+	size_t len;
+	while ((len = SpscRingWriteSpan(RecvQueue, ptr)) == 0) {
+		RecvQueueNotify(cv);
+		WaitForSingleObject(ReadEnd, INFINITE);
+		if (! cv->Ready) {
+			return 0;
+		}
+	}
+	return (DWORD)len;
+}
+
+/**
+ *	VA|[gǂ߂邾 RecvQueue ֓ǂݍ
+ *	^CAEg ReadIntervalTimeout = MAXDWORD Ȃ̂ ReadFile() ͂߂
+ */
+static void CommThreadRead(PComVar cv)
+{
+	DWORD C;
+	DWORD DErr;
+	BYTE *ptr;
+	DWORD len;
+
+	do {
+		len = RecvQueueWriteSpan(cv, &ptr);
+		if (len == 0) {
+			return;
+		}
+		ClearCommError(cv->ComID,&DErr,NULL);
+		if (! PReadFile(cv->ComID,ptr,len,&C,&rol)) {
+			if (GetLastError() == ERROR_IO_PENDING) {
+				if (WaitForSingleObject(rol.hEvent, 1000) != WAIT_OBJECT_0) {
+					C = 0;
+				}
+				else {
+					GetOverlappedResult(cv->ComID,&rol,&C,FALSE);
+				}
+			}
+			else {
+				C = 0;
+			}
+		}
+		if (C > 0) {
+			SpscRingCommitWrite(RecvQueue, C);
+			RecvQueueNotify(cv);
+		}
+	} while ((C!=0) && cv->Ready);
+	ClearCommError(cv->ComID,&DErr,NULL);
+}
+
 // OtpCvpXbh
-void NamedPipeThread(void *arg)
+static unsigned __stdcall NamedPipeThread(void *arg)
 {
 	PComVar cv = (PComVar)arg;
 	DWORD DErr;
-	HANDLE REnd;
-	char Temp[20];
-	char Buffer[1];  // 1byte
-	DWORD BytesRead, TotalBytesAvail, BytesLeftThisMessage;
+	BYTE *ptr;
+	DWORD len;
+	DWORD C, TotalBytesAvail;
 
-	_snprintf_s(Temp, sizeof(Temp), _TRUNCATE, "%s%d", READENDNAME, cv->ComPort);
-	REnd = OpenEvent(EVENT_ALL_ACCESS,FALSE, Temp);
 	while (TRUE) {
-		BytesRead = 0;
 		// OtpCv̓Cxg҂ƂłȂdlȂ̂ŁAL[̒g
 		// `邱ƂŁAReadFile() 邩ǂfB
-		if (PeekNamedPipe(cv->ComID, Buffer, sizeof(Buffer), &BytesRead, &TotalBytesAvail, &BytesLeftThisMessage)) {
+		if (PeekNamedPipe(cv->ComID, NULL, 0, NULL, &TotalBytesAvail, NULL)) {
 			if (! cv->Ready) {
-				_endthread();
+				break;
 			}
-			if (BytesRead == 0) {  // 󂾂AȂB
+			if (TotalBytesAvail == 0) {  // 󂾂AȂB
 				Sleep(1);
 				continue;
 			}
-			if (! cv->RRQ) {
-				PostMessage(cv->HWin, WM_USER_COMMNOTIFY, 0, FD_READ);
+			len = RecvQueueWriteSpan(cv, &ptr);
+			if (len == 0) {
+				break;
+			}
+			// L[ɓĂ镪ǂނ̂ ReadFile() ̓ubNȂ
+			if (len > TotalBytesAvail) {
+				len = TotalBytesAvail;
+			}
+			if (PReadFile(cv->ComID,ptr,len,&C,NULL) && C > 0) {
+				SpscRingCommitWrite(RecvQueue, C);
+				RecvQueueNotify(cv);
 			}
-			// ReadFile() I܂ő҂B
-			WaitForSingleObject(REnd,INFINITE);
 		}
 		else {
 			DErr = GetLastError();
 			// [VMware] this returns 109 (broken pipe) if a named pipe is removed.
 			// [Virtual Box] this returns 233 (pipe not connected) if a named pipe is removed.
 			if (! cv->Ready || ERROR_BROKEN_PIPE == DErr || ERROR_PIPE_NOT_CONNECTED == DErr) {
-				PostMessage(cv->HWin, WM_USER_COMMNOTIFY, 0, FD_CLOSE);
-				_endthread();
+				if (cv->Ready) {
+					PostMessage(cv->HWin, WM_USER_COMMNOTIFY, 0, FD_CLOSE);
+				}
+				break;
 			}
 		}
 	}
+	return 0;
 }
 
-void CommThread(void *arg)
+// VA|[gpXbh
+static unsigned __stdcall CommThread(void *arg)
 {
 	DWORD Evt;
 	PComVar cv = (PComVar)arg;
 	DWORD DErr;
-	HANDLE REnd;
-	char Temp[20];
 
-	_snprintf_s(Temp, sizeof(Temp), _TRUNCATE, "%s%d", READENDNAME, cv->ComPort);
-	REnd = OpenEvent(EVENT_ALL_ACCESS,FALSE, Temp);
 	while (TRUE) {
 		if (WaitCommEvent(cv->ComID,&Evt,NULL)) {
 			if (! cv->Ready) {
-				_endthread();
-			}
-			if (! cv->RRQ) {
-				PostMessage(cv->HWin, WM_USER_COMMNOTIFY, 0, FD_READ);
+				break;
 			}
-			WaitForSingleObject(REnd,INFINITE);
+			CommThreadRead(cv);
 		}
 		else {
 			DErr = GetLastError();  // this returns 995 (operation aborted) if a USB com port is removed
 			if (! cv->Ready || ERROR_OPERATION_ABORTED == DErr) {
-				_endthread();
+				break;
 			}
 			ClearCommError(cv->ComID,&DErr,NULL);
 		}
 	}
+	return 0;
+}
+
+/**
+ *	MXbhJn
+ */
+static BOOL RecvThreadStart(PComVar cv, unsigned (__stdcall *func)(void *))
+{
+	unsigned tid;
+
+	RecvQueue = SpscRingCreate(cv->InBuffLen);
+	if (RecvQueue == NULL) {
+		return FALSE;
+	}
+	RecvNotify = 0;
+	// Xbh cv->Ready  FALSE ɂȂÎŁA TRUE ɂĂ
+	cv->Ready = TRUE;
+	RecvThread = (HANDLE)_beginthreadex(NULL, 0, func, cv, 0, &tid);
+	if (RecvThread == NULL) {
+		SpscRingDestroy(RecvQueue);
+		RecvQueue = NULL;
+		return FALSE;
+	}
+	return TRUE;
+}
+
+/**
+ *	MXbh̏I҂
+ *	ĂԑO cv->Ready = FALSE ƂAXbh҂Ă̂Ă
+ *	Xbh RecvQueue ɐGĂԂɔjȂ悤AI܂ő҂
+ */
+static void RecvThreadStop(void)
+{
+	if (RecvThread != NULL) {
+		// ReadEnd ͎ZbgȂ̂ŁAXbh҂OɏĂĂ
+		// N悤ɁAI܂ŃZbg
+		do {
+			SetEvent(ReadEnd);
+		} while (WaitForSingleObject(RecvThread, 100) == WAIT_TIMEOUT);
+		CloseHandle(RecvThread);
+		RecvThread = NULL;
+	}
+	SpscRingDestroy(RecvQueue);
+	RecvQueue = NULL;
 }
 
 void CommStart(PComVar cv, LONG lParam, PTTSet ts)
@@ -761,7 +937,7 @@ void CommStart(PComVar cv, LONG lParam, PTTSet ts)
 			rol.hEvent = CreateEvent(NULL,TRUE,FALSE,Temp);
 
 			/* create the receiver thread */
-			if (_beginthread(CommThread,0,cv) == -1) {
+			if (! RecvThreadStart(cv, CommThread)) {
 				static const TTMessageBoxInfoW info = {
 					"Tera Term",
 					"MSG_TT_ERROR", L"Tera Term: Error",
@@ -788,7 +964,7 @@ void CommStart(PComVar cv, LONG lParam, PTTSet ts)
 			rol.hEvent = CreateEvent(NULL,TRUE,FALSE,Temp);
 
 			/* create the receiver thread */
-			if (_beginthread(NamedPipeThread,0,cv) == -1) {
+			if (! RecvThreadStart(cv, NamedPipeThread)) {
 				static const TTMessageBoxInfoW info = {
 					"Tera Term",
 					"MSG_TT_ERROR", L"Tera Term: Error",
@@ -811,6 +987,9 @@ BOOL CommCanClose(PComVar cv)
 	if (cv->InBuffCount>0) {
 		return FALSE;
 	}
+	if (RecvQueue != NULL && SpscRingGetCount(RecvQueue) > 0) {
+		return FALSE;
+	}
 	if (FLogIsOpend() && FLogGetCount() > 0) {
 		return FALSE;
 	}
@@ -855,13 +1034,15 @@ void CommClose(PComVar cv)
 			break;
 		case IdSerial:
 			if ( cv->ComID != INVALID_HANDLE_VALUE ) {
+				// WaitCommEvent(), ReadFile() 𒆒fĎMXbhI
+				SetCommMask(cv->ComID,0);
+				PurgeComm(cv->ComID, PURGE_TXABORT | PURGE_RXABORT |
+				                     PURGE_TXCLEAR | PURGE_RXCLEAR);
+				RecvThreadStop();
 				CloseHandle(ReadEnd);
 				CloseHandle(wol.hEvent);
 				CloseHandle(rol.hEvent);
-				PurgeComm(cv->ComID, PURGE_TXABORT | PURGE_RXABORT |
-				                     PURGE_TXCLEAR | PURGE_RXCLEAR);
 				EscapeCommFunction(cv->ComID,CLRDTR);
-				SetCommMask(cv->ComID,0);
 				PCloseFile(cv->ComID);
 				ClearCOMFlag(cv->ComPort);
 			}
@@ -876,6 +1057,7 @@ void CommClose(PComVar cv)
 
 		case IdNamedPipe:
 			if ( cv->ComID != INVALID_HANDLE_VALUE ) {
+				RecvThreadStop();
 				CloseHandle(ReadEnd);
 				CloseHandle(wol.hEvent);
 				CloseHandle(rol.hEvent);
@@ -888,6 +1070,9 @@ void CommClose(PComVar cv)
 	cv->PortType = 0;
 	free(cv->TitleRemoteW);
 	cv->TitleRemoteW = NULL;
+	free(cv->InBuff);
+	cv->InBuff = NULL;
+	cv->InBuffLen = 0;
 }
 
 void CommProcRRQ(PComVar cv)
@@ -913,53 +1098,46 @@ void CommReceive(PComVar cv)
 {
 	DWORD C;
 	DWORD DErr;
+	BYTE *ptr;
+	DWORD len;
 
 	if (! cv->Ready || ! cv->RRQ ||
-	    (cv->InBuffCount>=InBuffSize)) {
+	    (cv->InBuffCount>=cv->InBuffLen)) {
 		return;
 	}
 
-	/* Compact buffer */
-	if ((cv->InBuffCount>0) && (cv->InPtr>0)) {
-		memmove(cv->InBuff,&(cv->InBuff[cv->InPtr]),cv->InBuffCount);
-		cv->InPtr = 0;
-	}
-
-	if (cv->InBuffCount<InBuffSize) {
+	// Oobt@Ȃ̂ŋlߒ(memmove)͍sȂ
+	// ǂݍ݂͏݉\ȘÄ悲Ƃɍs
+	if (cv->InBuffCount<cv->InBuffLen) {
 		switch (cv->PortType) {
 			case IdTCPIP:
-				C = Precv(cv->s, &(cv->InBuff[cv->InBuffCount]),
-				          InBuffSize-cv->InBuffCount, 0);
-				if (C == SOCKET_ERROR) {
-					C = 0;
-					PWSAGetLastError();
-				}
-				cv->InBuffCount = cv->InBuffCount + C;
+				do {
+					len = InBuffFreeSpan(cv, &ptr);
+					C = Precv(cv->s, ptr, len, 0);
+					if (C == SOCKET_ERROR) {
+						C = 0;
+						PWSAGetLastError();
+					}
+					cv->InBuffCount = cv->InBuffCount + C;
+					// Äg؂Ƃ͐܂Ԃɂǂݍ
+				} while ((C == len) && (cv->InBuffCount<cv->InBuffLen));
 				break;
 			case IdSerial:
+			case IdNamedPipe:
+				// MXbhǂݍ񂾃f[^o
+				// ɒʒmtO낵Aoɓ͂f[^͍ēxʒm
+				InterlockedExchange(&RecvNotify, 0);
 				do {
-					ClearCommError(cv->ComID,&DErr,NULL);
-					if (! PReadFile(cv->ComID,&(cv->InBuff[cv->InBuffCount]),
-					                InBuffSize-cv->InBuffCount,&C,&rol)) {
-						if (GetLastError() == ERROR_IO_PENDING) {
-							if (WaitForSingleObject(rol.hEvent, 1000) != WAIT_OBJECT_0) {
-								C = 0;
-							}
-							else {
-								GetOverlappedResult(cv->ComID,&rol,&C,FALSE);
-							}
-						}
-						else {
-							C = 0;
-						}
-					}
+					len = InBuffFreeSpan(cv, &ptr);
+					C = (DWORD)SpscRingRead(RecvQueue, ptr, len);
 					cv->InBuffCount = cv->InBuffCount + C;
-				} while ((C!=0) && (cv->InBuffCount<InBuffSize));
-				ClearCommError(cv->ComID,&DErr,NULL);
+				} while ((C == len) && (cv->InBuffCount<cv->InBuffLen));
+				// tő҂ĂMXbhĊJ
+				SetEvent(ReadEnd);
 				break;
 			case IdFile:
-				if (PReadFile(cv->ComID,&(cv->InBuff[cv->InBuffCount]),
-				              InBuffSize-cv->InBuffCount,&C,NULL)) {
+				len = InBuffFreeSpan(cv, &ptr);
+				if (PReadFile(cv->ComID,ptr,len,&C,NULL)) {
 					if (C == 0) {
 						DErr = ERROR_HANDLE_EOF;
 					}
@@ -971,29 +1149,6 @@ void CommReceive(PComVar cv)
 					DErr = GetLastError();
 				}
 				break;
-
-			case IdNamedPipe:
-				// L[̒ɍŒ1oCgȏ̃f[^Ă邱ƂmFłĂ邽߁A
-				// ReadFile() ̓ubN邱Ƃ͂Ȃ߁AꊇēǂށB
-				if (PReadFile(cv->ComID,&(cv->InBuff[cv->InBuffCount]),
-				              InBuffSize-cv->InBuffCount,&C,NULL)) {
-					if (C == 0) {
-						DErr = ERROR_HANDLE_EOF;
-					}
-					else {
-						cv->InBuffCount = cv->InBuffCount + C;
-					}
-				}
-				else {
-					DErr = GetLastError();
-				}
-
-				// 1oCgȏǂ߂ACxgNAXbhĊJB
-				if (cv->InBuffCount > 0) {
-					cv->RRQ = FALSE;
-					SetEvent(ReadEnd);
-				}
-				break;
 		}
 	}
 
@@ -1006,8 +1161,8 @@ void CommReceive(PComVar cv)
 				}
 				break;
 			case IdSerial:
+			case IdNamedPipe:
 				cv->RRQ = FALSE;
-				SetEvent(ReadEnd);
 				return;
 			case IdFile:
 				if (DErr != ERROR_IO_PENDING) {
@@ -1018,17 +1173,6 @@ void CommReceive(PComVar cv)
 					cv->RRQ = TRUE;
 				}
 				return;
-			case IdNamedPipe:
-				// TODO: ԂAɗ邱Ƃ͂ȂB
-				if (DErr != ERROR_IO_PENDING) {
-					PostMessage(cv->HWin, WM_USER_COMMNOTIFY, 0, FD_CLOSE);
-					cv->RRQ = FALSE;
-				}
-				else {
-					cv->RRQ = TRUE;
-				}
-				SetEvent(ReadEnd);
-				return;
 		}
 		cv->RRQ = FALSE;
 	}
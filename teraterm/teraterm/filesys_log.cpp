@@ -28,6 +28,7 @@
 
 /* TERATERM.EXE, log routines */
 #include <stdio.h>
+#include <string.h>
 #if !defined(_CRTDBG_MAP_ALLOC)
 #define _CRTDBG_MAP_ALLOC
 #endif
@@ -51,6 +52,9 @@
 #include "codeconv.h"
 #include "asprintf.h"
 #include "win32helper.h"
+#include "spsc_ring.h"
+#include "filesys_log_gz.h"
+#include "filesys_log_enc.h"
 
 #include "filesys_log_res.h"
 #include "filesys_log.h"
@@ -68,10 +72,37 @@ enum enumLineEnd {
 	Line_FileHead = 2,
 };
 
+// JĂ郍Ot@C
+//	[e[gƂ́A鏈(c݂̏ FlushFileBuffers())ƃ[e[gpXbh֓n
+typedef struct {
+	HANDLE FileHandle;
+	LogGz *Gz;			// kÔƂ NULL ȊO
+
+	HANDLE LogThread;
+	SpscRing *LogRing;		// xݗpXbh֓nf[^
+	HANDLE LogRingEvent;	// LogRing Ƀf[^ꂽ
+	HANDLE LogSpaceEvent;	// LogRing ɋ󂫂ł
+	volatile LONG LogThreadQuit;
+
+	// FlushFileBuffers()
+	BOOL FlushPending;		// ݌ FlushFileBuffers() ĂȂ
+	DWORD FlushTick;
+} LogFile_t;
+
+// [e[gpXbh֓nWu
+typedef struct RotateJob {
+	struct RotateJob *Next;
+	LogFile_t *File;	// t@C, O̎cЕtƂ NULL
+	wchar_t *FullName;	// Ot@C
+	wchar_t *TempName;	// [e[gt@C̈ꎞIȖO
+	int Step;
+	BOOL Compress;
+} RotateJob;
+
 typedef struct {
 	wchar_t *FullName;
 
-	HANDLE FileHandle;
+	LogFile_t *File;	// JȂƂ NULL
 	LONG FileSize, ByteCount;
 
 	DWORD StartTime;
@@ -82,10 +113,11 @@ typedef struct {
 	int RotateMode;  //  enum rotate_mode RotateMode;
 	LONG RotateSize;
 	int RotateStep;
-
-	HANDLE LogThread;
-	DWORD LogThreadId;
-	HANDLE LogThreadEvent;
+	DWORD RotateInterval;	// ԂŃ[e[gԊu(ms), 0̂Ƃ͎Ԃł̓[e[gȂ
+	DWORD RotateTick;		// ̃t@CJ
+	LONG RotateBase;		// ̃t@CJƂ ByteCount
+	BOOL RotateCompress;	// [e[gt@Ck
+	UINT RotateSeq;			// ꎞIȃt@C̒ʂԍ
 
 	BOOL IsPause;
 
@@ -101,14 +133,35 @@ typedef TFileVar *PFileVar;
 
 static PFileVar LogVar = NULL;
 
-static PCHAR cv_LogBuf;
-static int cv_LogPtr, cv_LStart, cv_LCount;
-static PCHAR cv_BinBuf;
-static int cv_BinPtr, cv_BStart, cv_BCount;
+/*
+ *	Oobt@
+ *	tɂȂ LOG_BUFF_SIZE_MAX ܂Ŕ{Xɑ傫
+ *	ȏ傫łȂƂ͂̏Ńt@C֏oċ󂯂
+ */
+#define LOG_BUFF_SIZE_INIT	(64*1024)
+#define LOG_BUFF_SIZE_MAX	InBuffSizeMax
+
+typedef struct {
+	PCHAR Buf;
+	int Size;	// mۂĂoCg
+	int Start;	// 擪̈ʒu
+	int Count;	// i[ĂoCg
+} LogBuf_t;
+
+static LogBuf_t cv_LogBuf;
+static LogBuf_t cv_BinBuf;
 static int cv_BinSkip;
 
-// xݗpXbh̃bZ[W
-#define WM_DPC_LOGTHREAD_SEND (WM_APP + 1)
+// ߂ɎꂽoCg
+static LONGLONG LogLostBytes;
+// xݗpXbhŎꂽoCgALogToFile()  LogLostBytes ɉZ
+static volatile LONG LogThreadLostBytes;
+
+// xݗpXbh֓nOobt@̃TCY
+#define LOG_RING_SIZE	(4*1024*1024)
+
+// LogRotateStep  0(wȂ)̂ƂɎc̏
+#define LOG_ROTATE_STEP_MAX	10000
 
 static void Log1Bin(BYTE b);
 static void LogBinSkip(int add);
@@ -118,6 +171,9 @@ void LogPut1(BYTE b);
 static void OutputStr(const wchar_t *str);
 static void LogToFile(PFileVar fv);
 static void FLogOutputBOM(PFileVar fv);
+static void LogRotate(PFileVar fv);
+static void LogRotateRecover(PFileVar fv);
+static void LogWriteAll(PFileVar fv);
 
 static BOOL OpenFTDlg_(PFileVar fv)
 {
@@ -251,99 +307,262 @@ static void FixLogOption(void)
 }
 
 
-// Xbh̏Iƃt@C̃N[Y
-static void CloseFileSync(PFileVar fv)
+/**
+ *	FlushFileBuffers() 
+ *	kÔƂ́A܂Ăf[^ubNɂďĂs
+ *
+ *	@return	߂ȂoCg
+ */
+static DWORD LogFlushFile(LogFile_t *f)
 {
-	BOOL ret;
+	DWORD lost = 0;
 
-	if (fv->FileHandle == INVALID_HANDLE_VALUE) {
-		return;
+	if (f->Gz != NULL) {
+		lost = LogGzFlush(f->Gz);
 	}
+	FlushFileBuffers(f->FileHandle);
+	f->FlushPending = FALSE;
+	return lost;
+}
 
-	if (fv->LogThread != INVALID_HANDLE_VALUE) {
-		// Xbh̏I҂
-		ret = PostThreadMessage(fv->LogThreadId, WM_QUIT, 0, 0);
-		if (ret != 0) {
-			// XbhL[ɃGL[łꍇ̂ݑ҂킹sB
-			WaitForSingleObject(fv->LogThread, INFINITE);
-		}
-		else {
-			//DWORD code = GetLastError();
+/**
+ *	t@C֏
+ *	ts.LogFlushMode  LOG_FLUSH_LINE ̂Ƃ͉s܂ł FlushFileBuffers() 
+ *
+ *	@return	߂ȂoCg
+ */
+static DWORD LogWriteFile(LogFile_t *f, const void *buf, DWORD len)
+{
+	DWORD lost;
+
+	if (f->Gz != NULL) {
+		lost = LogGzWrite(f->Gz, buf, len);
+	}
+	else {
+		DWORD wrote;
+		if (!WriteFile(f->FileHandle, buf, len, &wrote, NULL)) {
+			wrote = 0;
 		}
-		CloseHandle(fv->LogThread);
-		fv->LogThread = INVALID_HANDLE_VALUE;
+		lost = len - wrote;
+	}
+	if (ts.LogFlushMode == LOG_FLUSH_LINE && memchr(buf, '\n', len) != NULL) {
+		lost += LogFlushFile(f);
 	}
-	CloseHandle(fv->FileHandle);
-	fv->FileHandle = INVALID_HANDLE_VALUE;
+	else {
+		f->FlushPending = TRUE;
+	}
+	return lost;
+}
+
+/**
+ *	Vf[^ȂƂIɌĂ
+ *	kÔƂ LOG_GZ_BLOCK_TIME boubN
+ *	ts.LogFlushMode  LOG_FLUSH_INTERVAL ̂Ƃ
+ *	O񂩂 ts.LogFlushInterval(ms) oĂ FlushFileBuffers() 
+ *
+ *	@return	߂ȂoCg
+ */
+static DWORD LogFlushInterval(LogFile_t *f)
+{
+	DWORD now;
+	DWORD lost = 0;
+
+	if (f->Gz != NULL) {
+		lost = LogGzIdle(f->Gz);
+	}
+	if (ts.LogFlushMode != LOG_FLUSH_INTERVAL || !f->FlushPending) {
+		return lost;
+	}
+	now = GetTickCount();
+	if (now - f->FlushTick < ts.LogFlushInterval) {
+		return lost;
+	}
+	f->FlushTick = now;
+	return lost + LogFlushFile(f);
+}
+
+static void FreeThreadResource(LogFile_t *f)
+{
+	SpscRingDestroy(f->LogRing);
+	f->LogRing = NULL;
+	if (f->LogRingEvent != NULL) {
+		CloseHandle(f->LogRingEvent);
+		f->LogRingEvent = NULL;
+	}
+	if (f->LogSpaceEvent != NULL) {
+		CloseHandle(f->LogSpaceEvent);
+		f->LogSpaceEvent = NULL;
+	}
+}
+
+/**
+ *	Xbh̏Iƃt@C̃N[Y
+ *	Xbh LogRing ɎcĂf[^ݏI܂ő҂
+ *	f ͉
+ *
+ *	@return	߂ȂoCg
+ */
+static DWORD CloseLogFile(LogFile_t *f)
+{
+	DWORD lost = 0;
+
+	if (f->LogThread != INVALID_HANDLE_VALUE) {
+		// Xbh̏I҂
+		// Xbh LogRing ɎcĂf[^łI
+		InterlockedExchange(&f->LogThreadQuit, 1);
+		SetEvent(f->LogRingEvent);
+		WaitForSingleObject(f->LogThread, INFINITE);
+		CloseHandle(f->LogThread);
+		f->LogThread = INVALID_HANDLE_VALUE;
+		FreeThreadResource(f);
+	}
+	if (f->Gz != NULL) {
+		// CfbNX
+		lost = LogGzClose(f->Gz);
+		f->Gz = NULL;
+	}
+	if (f->FlushPending) {
+		FlushFileBuffers(f->FileHandle);
+		f->FlushPending = FALSE;
+	}
+	CloseHandle(f->FileHandle);
+	free(f);
+	return lost;
 }
 
 // xݗpXbh
+//	LogRing ɓĂf[^Ä悲Ƃɂ̂܂ WriteFile() 
 static unsigned _stdcall DeferredLogWriteThread(void *arg)
 {
-	MSG msg;
-	PFileVar fv = (PFileVar)arg;
-	PCHAR buf;
-	DWORD buflen;
-	DWORD wrote;
+	LogFile_t *f = (LogFile_t *)arg;
+	DWORD timeout = (ts.LogFlushMode == LOG_FLUSH_INTERVAL) ? ts.LogFlushInterval : INFINITE;
+	BOOL quit;
+	DWORD lost;
 
-	PeekMessage(&msg, NULL, 0, 0, PM_NOREMOVE);
-
-	// XbhL[̍쐬IƂXbh֒ʒmB
-	if (fv->LogThreadEvent != NULL) {
-		SetEvent(fv->LogThreadEvent);
+	if (f->Gz != NULL && timeout > LOG_GZ_BLOCK_TIME * 1000) {
+		// f[^ȂĂkÕubNԂŋ؂
+		timeout = LOG_GZ_BLOCK_TIME * 1000;
 	}
 
-	while (GetMessage(&msg, NULL, 0, 0) > 0) {
-		switch (msg.message) {
-			case WM_DPC_LOGTHREAD_SEND:
-				buf = (PCHAR)msg.wParam;
-				buflen = (DWORD)msg.lParam;
-				WriteFile(fv->FileHandle, buf, buflen, &wrote, NULL);
-				free(buf);   // Ń
-				break;
+	do {
+		WaitForSingleObject(f->LogRingEvent, timeout);
+
+		// IvOɓꂽf[^͏łI
+		quit = InterlockedCompareExchange(&f->LogThreadQuit, 0, 0) != 0;
 
-			case WM_QUIT:
-				goto end;
+		for (;;) {
+			const BYTE *ptr;
+			size_t len = SpscRingReadSpan(f->LogRing, &ptr);
+			if (len == 0) {
 				break;
+			}
+			lost = LogWriteFile(f, ptr, (DWORD)len);
+			if (lost > 0) {
+				InterlockedExchangeAdd(&LogThreadLostBytes, (LONG)lost);
+			}
+			SpscRingCommitRead(f->LogRing, len);
+			SetEvent(f->LogSpaceEvent);
 		}
-	}
+		lost = LogFlushInterval(f);
+		if (lost > 0) {
+			InterlockedExchangeAdd(&LogThreadLostBytes, (LONG)lost);
+		}
+	} while (!quit);
 
-end:
 	_endthreadex(0);
 	return (0);
 }
 
+/**
+ *	xݗpXbhփf[^n
+ *	LogRing ɋ󂫂ȂƂ́AXbhŋ󂭂܂ő҂
+ *
+ *	@return	nȂoCg
+ */
+static DWORD LogRingWrite(LogFile_t *f, const void *data, DWORD len)
+{
+	const BYTE *p = (const BYTE *)data;
+
+	while (len > 0) {
+		size_t n = SpscRingWrite(f->LogRing, p, len);
+		p += n;
+		len -= (DWORD)n;
+		SetEvent(f->LogRingEvent);
+		if (len > 0) {
+			HANDLE handles[2] = { f->LogSpaceEvent, f->LogThread };
+			if (WaitForMultipleObjects(2, handles, FALSE, INFINITE) != WAIT_OBJECT_0) {
+				// XbhIĂ
+				break;
+			}
+		}
+	}
+	return len;
+}
+
 // xݗpXbhNB
 // (2013.4.19 yutaka)
-// DeferredLogWriteThread XbhNāAXbhL[쐬OɁA
-// Ot@C̃N[Y(CloseFileSync)sƁAGL[sAfbhbN
-// ƂCB
-// XbhԂ̓s߁AOȂCxgIuWFNggāAXbhL[
-// 쐬܂ő҂킹悤ɂBOtCxgIuWFNggꍇ́A
-// VXe(Windows OS)Ńj[NȖOɂKvB
-// (2016.9.23 yutaka)
-static void StartThread(PFileVar fv)
+// f[^̓bZ[Wł͂Ȃ LogRing œn̂ŁAXbhL[̍쐬҂킹Kv͂ȂB
+// NłȂƂ LogThread  INVALID_HANDLE_VALUE ̂܂܂ƂȂALogToFile() ŒڏށB
+static void StartThread(LogFile_t *f)
 {
 	unsigned tid;
-	fv->LogThreadEvent = CreateEvent(NULL, TRUE, FALSE, NULL);
-	fv->LogThread = (HANDLE)_beginthreadex(NULL, 0, DeferredLogWriteThread, fv, 0, &tid);
-	fv->LogThreadId = tid;
-	if (fv->LogThreadEvent != NULL) {
-		WaitForSingleObject(fv->LogThreadEvent, INFINITE);
-		CloseHandle(fv->LogThreadEvent);
+	HANDLE thread;
+
+	f->LogThreadQuit = 0;
+	f->LogRing = SpscRingCreate(LOG_RING_SIZE);
+	f->LogRingEvent = CreateEvent(NULL, FALSE, FALSE, NULL);
+	f->LogSpaceEvent = CreateEvent(NULL, FALSE, FALSE, NULL);
+	if (f->LogRing == NULL || f->LogRingEvent == NULL || f->LogSpaceEvent == NULL) {
+		FreeThreadResource(f);
+		return;
 	}
+	thread = (HANDLE)_beginthreadex(NULL, 0, DeferredLogWriteThread, f, 0, &tid);
+	if (thread == 0) {
+		FreeThreadResource(f);
+		return;
+	}
+	f->LogThread = thread;
 }
 
-static void OpenLogFile(PFileVar fv)
+/**
+ *	Ot@CJ
+ *	@param	Truncate	TRUE ̂ƂÃt@C̓êĂ
+ *	@return	CloseLogFile() ŕ, JȂƂ NULL
+ */
+static LogFile_t *OpenLogFile(const wchar_t *FullName, BOOL Truncate)
 {
+	LogFile_t *f;
+
 	// LogLockExclusive Lȏꍇɂ܂LȂƁA
 	// ݒ̃Ot@C𑼂̃GfB^ŊJȂ
-	int dwShareMode = FILE_SHARE_READ;
+	// FILE_SHARE_DELETE ̓[e[gƂɊJ܂܃l[邽
+	int dwShareMode = FILE_SHARE_READ | FILE_SHARE_DELETE;
 	if (!ts.LogLockExclusive) {
-		dwShareMode = FILE_SHARE_READ | FILE_SHARE_WRITE;
+		dwShareMode = FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE;
+	}
+	// kO͒ǋLɊ̃CfbNXǂނ GENERIC_READ Kv
+	DWORD dwDesiredAccess = ts.LogCompress ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_WRITE;
+
+	f = (LogFile_t *)calloc(1, sizeof(*f));
+	if (f == NULL) {
+		return NULL;
+	}
+	f->LogThread = INVALID_HANDLE_VALUE;
+	f->FileHandle = CreateFileW(FullName, dwDesiredAccess, dwShareMode, NULL,
+								Truncate ? CREATE_ALWAYS : OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (f->FileHandle == INVALID_HANDLE_VALUE) {
+		free(f);
+		return NULL;
+	}
+	if (ts.LogCompress) {
+		f->Gz = LogGzOpen(f->FileHandle);
+		if (f->Gz == NULL) {
+			CloseHandle(f->FileHandle);
+			free(f);
+			return NULL;
+		}
 	}
-	fv->FileHandle = CreateFileW(fv->FullName, GENERIC_WRITE, dwShareMode, NULL,
-								 OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+	return f;
 }
 
 static BOOL LogStart(PFileVar fv, const wchar_t *fname)
@@ -368,11 +587,14 @@ static BOOL LogStart(PFileVar fv, const wchar_t *fname)
 			return FALSE;
 		}
 	}
-	cv_LStart = cv_LogPtr;
-	cv_LCount = 0;
+	cv_LogBuf.Start = 0;
+	cv_LogBuf.Count = 0;
+	LogLostBytes = 0;
+	LogThreadLostBytes = 0;
 
-	OpenLogFile(fv);
-	if (fv->FileHandle == INVALID_HANDLE_VALUE) {
+	// kO͊̃t@C̑ɏƂ̂ŁAǋLłȂ΋ɂĂ
+	fv->File = OpenLogFile(fv->FullName, ts.Append == 0 && ts.LogCompress);
+	if (fv->File == NULL) {
 		return FALSE;
 	}
 
@@ -380,7 +602,10 @@ static BOOL LogStart(PFileVar fv, const wchar_t *fname)
 	fv->eLineEnd = Line_LineHead;
 	if (ts.Append > 0)
 	{
-		SetFilePointer(fv->FileHandle, 0, NULL, FILE_END);
+		if (fv->File->Gz == NULL) {
+			// kO LogGzOpen() ŏ݈ʒuݒς
+			SetFilePointer(fv->File->FileHandle, 0, NULL, FILE_END);
+		}
 		/* 2007.05.24 Gentaro
 		   If log file already exists,
 		   a newline is inserted before the first timestamp.
@@ -398,12 +623,16 @@ static BOOL LogStart(PFileVar fv, const wchar_t *fname)
 	fv->RotateMode = ts.LogRotate;
 	fv->RotateSize = ts.LogRotateSize;
 	fv->RotateStep = ts.LogRotateStep;
+	fv->RotateInterval = (DWORD)ts.LogRotateInterval * 60 * 1000;
+	fv->RotateTick = GetTickCount();
+	// kÔƂ͂łɈkĂ
+	fv->RotateCompress = ts.LogRotateCompress && !ts.LogCompress;
 
 	// Log rotateL̏ꍇAt@CTCYݒ肷B
 	// ŏ̃t@Cݒ肵TCYŃ[e[gȂ̏CB
 	// (2016.4.9 yutaka)
 	if (fv->RotateMode != ROTATE_NONE) {
-		DWORD size = GetFileSize(fv->FileHandle, NULL);
+		DWORD size = GetFileSize(fv->File->FileHandle, NULL);
 		if (size == -1) {
 			return FALSE;
 		}
@@ -412,6 +641,10 @@ static BOOL LogStart(PFileVar fv, const wchar_t *fname)
 	else {
 		fv->ByteCount = 0;
 	}
+	fv->RotateBase = fv->ByteCount;
+
+	// O񃍁[e[g̓rŏIƂ̃t@CЕt
+	LogRotateRecover(fv);
 
 	if (! OpenFTDlg_(fv)) {
 		return FALSE;
@@ -421,7 +654,7 @@ static BOOL LogStart(PFileVar fv, const wchar_t *fname)
 	fv->StartTime = GetTickCount();
 
 	if (ts.DeferredLogWriteMode) {
-		StartThread(fv);
+		StartThread(fv->File);
 	}
 
 	if (fv->FileLog) {
@@ -461,51 +694,141 @@ void FLogOutputAllBuffer(void)
 }
 
 /**
- * O1byte
- *		obt@֏܂
- *		ۂ݂̏ LogToFile() ōs
+ *	obt@{̑傫ɂ
+ *	i[Ăf[^͐擪ׂȂ
+ *
+ *	@retval	FALSE	ȏ傫łȂ
  */
-void LogPut1(BYTE b)
+static BOOL LogBufGrow(LogBuf_t *lb)
 {
-	PFileVar fv = LogVar;
+	int new_size;
+	PCHAR new_buf;
+	int len;
+
+	if (lb->Size >= LOG_BUFF_SIZE_MAX) {
+		return FALSE;
+	}
+	new_size = lb->Size * 2;
+	if (new_size > LOG_BUFF_SIZE_MAX) {
+		new_size = LOG_BUFF_SIZE_MAX;
+	}
+	new_buf = (PCHAR)malloc(new_size);
+	if (new_buf == NULL) {
+		return FALSE;
+	}
+	len = lb->Size - lb->Start;
+	if (len > lb->Count) {
+		len = lb->Count;
+	}
+	memcpy(new_buf, &lb->Buf[lb->Start], len);
+	memcpy(&new_buf[len], lb->Buf, lb->Count - len);
+	free(lb->Buf);
+	lb->Buf = new_buf;
+	lb->Size = new_size;
+	lb->Start = 0;
+	return TRUE;
+}
 
-	cv_LogBuf[cv_LogPtr] = b;
-	cv_LogPtr++;
-	if (cv_LogPtr>=InBuffSize)
-		cv_LogPtr = cv_LogPtr-InBuffSize;
+/**
+ *	t̂Ƃ̓obt@傫邩At@C֏oċ󂫂
+ *
+ *	@retval	FALSE	󂫂Ȃ
+ */
+static BOOL LogBufMakeRoom(PFileVar fv, LogBuf_t *lb)
+{
+	if (lb->Count < lb->Size) {
+		return TRUE;
+	}
+	if (LogBufGrow(lb)) {
+		return TRUE;
+	}
+	LogToFile(fv);
+	return lb->Count < lb->Size;
+}
 
-	if (fv->FileLog)
-	{
-		if (cv_LCount>=InBuffSize)
-		{
-			cv_LCount = InBuffSize;
-			cv_LStart = cv_LogPtr;
+/**
+ *	obt@1byte
+ */
+static void LogBufPut1(PFileVar fv, LogBuf_t *lb, BYTE b)
+{
+	int ptr;
+
+	if (!LogBufMakeRoom(fv, lb)) {
+		// oȂ
+		LogLostBytes++;
+		return;
+	}
+	ptr = lb->Start + lb->Count;
+	if (ptr >= lb->Size) {
+		ptr -= lb->Size;
+	}
+	lb->Buf[ptr] = b;
+	lb->Count++;
+}
+
+/**
+ *	obt@ւ܂Ƃ߂ď
+ *	󂢂ĂÄ悲Ƃ memcpy() 
+ */
+static void LogBufWrite(PFileVar fv, LogBuf_t *lb, const BYTE *data, size_t len)
+{
+	while (len > 0) {
+		int ptr;
+		size_t span;
+
+		if (!LogBufMakeRoom(fv, lb)) {
+			// oȂ
+			LogLostBytes += len;
+			return;
 		}
-		else
-			cv_LCount++;
+		ptr = lb->Start + lb->Count;
+		if (ptr >= lb->Size) {
+			ptr -= lb->Size;
+		}
+		span = (ptr >= lb->Start) ? lb->Size - ptr : lb->Start - ptr;
+		if (span > len) {
+			span = len;
+		}
+		memcpy(&lb->Buf[ptr], data, span);
+		lb->Count += (int)span;
+		data += span;
+		len -= span;
 	}
-	else
-		cv_LCount = 0;
 }
 
-static BOOL Get1(PCHAR Buf, int *Start, int *Count, PBYTE b)
+/**
+ * O1byte
+ *		obt@֏܂
+ *		ۂ݂̏ LogToFile() ōs
+ */
+void LogPut1(BYTE b)
 {
-	if (*Count<=0) return FALSE;
-	*b = Buf[*Start];
-	(*Start)++;
-	if (*Start>=InBuffSize)
-		*Start = *Start-InBuffSize;
-	(*Count)--;
-	return TRUE;
+	PFileVar fv = LogVar;
+
+	if (!fv->FileLog) {
+		return;
+	}
+	LogBufPut1(fv, &cv_LogBuf, b);
 }
 
 
 
 static CRITICAL_SECTION g_filelog_lock;   /* bNpϐ */
 
+/*
+ *	[e[gpXbh
+ *	OĂ(fv Ă)҂ɁAcĂWuďI
+ */
+static CRITICAL_SECTION g_rotate_lock;	// RotateHead, RotateTail, RotateThread, RotateRunning
+static RotateJob *RotateHead, *RotateTail;
+static HANDLE RotateThread;				// ŌɋNXbh
+static BOOL RotateRunning;				// RotateThread WuĂ
+static volatile LONG RotateQuit;		// FLogRotateUnInit() Ă΂ꂽ
+
 void logfile_lock_initialize(void)
 {
 	InitializeCriticalSection(&g_filelog_lock);
+	InitializeCriticalSection(&g_rotate_lock);
 }
 
 static inline void logfile_lock(void)
@@ -518,38 +841,111 @@ static inline void logfile_unlock(void)
 	LeaveCriticalSection(&g_filelog_lock);
 }
 
-// O[e[gB
-// (2013.3.21 yutaka)
-static void LogRotate(PFileVar fv)
+/**
+ *	t@CkO`ňk
+ *	[e[gpXbhĂ΂
+ *
+ *	@retval	TRUE	kł
+ */
+static BOOL LogRotateCompressFile(const wchar_t *src, const wchar_t *dst)
 {
-	int loopmax = 10000;  // XXX
-	int i, k;
+	HANDLE in;
+	HANDLE out;
+	LogGz *z;
+	BYTE *buf;
+	DWORD lost = 0;
+	BOOL result = FALSE;
+
+	in = CreateFileW(src, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (in == INVALID_HANDLE_VALUE) {
+		return FALSE;
+	}
+	out = CreateFileW(dst, GENERIC_READ | GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (out == INVALID_HANDLE_VALUE) {
+		CloseHandle(in);
+		return FALSE;
+	}
+	buf = (BYTE *)malloc(LOG_GZ_BLOCK_SIZE);
+	z = LogGzOpen(out);
+	if (buf != NULL && z != NULL) {
+		for (;;) {
+			DWORD len;
+			if (InterlockedCompareExchange(&RotateQuit, 0, 0) != 0) {
+				// IƂ͒fÃt@C͎ LogRotateRecover() ňk
+				break;
+			}
+			if (!ReadFile(in, buf, LOG_GZ_BLOCK_SIZE, &len, NULL)) {
+				lost++;
+				break;
+			}
+			if (len == 0) {
+				result = TRUE;
+				break;
+			}
+			lost += LogGzWrite(z, buf, len);
+		}
+		lost += LogGzClose(z);
+	}
+	free(buf);
+	CloseHandle(out);
+	CloseHandle(in);
 
-	if (fv->RotateMode == ROTATE_NONE)
-		return;
+	if (!result || lost > 0) {
+		DeleteFileW(dst);
+		return FALSE;
+	}
+	return TRUE;
+}
 
-	if (fv->RotateMode == ROTATE_SIZE) {
-		if (fv->ByteCount <= fv->RotateSize)
-			return;
-		//OutputDebugPrintf("%s: mode %d size %ld\n", __FUNCTION__, fv->RotateMode, fv->ByteCount);
-	} else {
+/**
+ *	[e[gt@CāÃt@Cփl[
+ *	[e[gpXbhĂ΂
+ *
+ *	xݗpXbhɎcĂf[^ł
+ *	name.1  name.2 c Əɂ炵ĂAꎞIȖÕt@C name.1 ɂ
+ *	kƂ name.1.gz c ƂȂ
+ */
+static void LogRotateFiles(RotateJob *job)
+{
+	int loopmax = LOG_ROTATE_STEP_MAX;
+	int i, k;
+	const wchar_t *ext = L"";
+	wchar_t *tmpname = job->TempName;
+	wchar_t *gzname = NULL;
+	size_t tmplen = wcslen(job->TempName);
+
+	if (job->File != NULL) {
+		DWORD lost = CloseLogFile(job->File);
+		job->File = NULL;
+		if (lost > 0) {
+			InterlockedExchangeAdd(&LogThreadLostBytes, (LONG)lost);
+		}
+	}
+	if (InterlockedCompareExchange(&RotateQuit, 0, 0) != 0) {
+		// IƂ͕邾ɂāAl[ƈk͎ LogRotateRecover() ōs
 		return;
 	}
 
-	logfile_lock();
-	// OTCYďB
-	fv->ByteCount = 0;
-
-	// 񍡂̃t@CN[YāAʖ̃t@CI[vB
-	CloseFileSync(fv);
+	if (tmplen > 3 && _wcsicmp(job->TempName + tmplen - 3, L".gz") == 0) {
+		// O񈳏k܂ŏIĂt@C
+		ext = L".gz";
+	}
+	else if (job->Compress) {
+		aswprintf(&gzname, L"%s.gz", job->TempName);
+		if (LogRotateCompressFile(job->TempName, gzname)) {
+			DeleteFileW(job->TempName);
+			tmpname = gzname;
+			ext = L".gz";
+		}
+	}
 
 	// ネ[e[ṼXebv̎w肪邩
-	if (fv->RotateStep > 0)
-		loopmax = fv->RotateStep;
+	if (job->Step > 0)
+		loopmax = job->Step;
 
 	for (i = 1 ; i <= loopmax ; i++) {
 		wchar_t *filename;
-		aswprintf(&filename, L"%s.%d", fv->FullName, i);
+		aswprintf(&filename, L"%s.%d%s", job->FullName, i, ext);
 		DWORD attr = GetFileAttributesW(filename);
 		free(filename);
 		if (attr == INVALID_FILE_ATTRIBUTES)
@@ -564,29 +960,325 @@ static void LogRotate(PFileVar fv)
 	for (k = i-1 ; k >= 0 ; k--) {
 		wchar_t *oldfile;
 		if (k == 0)
-			oldfile = _wcsdup(fv->FullName);
+			oldfile = _wcsdup(tmpname);
 		else
-			aswprintf(&oldfile, L"%s.%d", fv->FullName, k);
+			aswprintf(&oldfile, L"%s.%d%s", job->FullName, k, ext);
 		wchar_t *newfile;
-		aswprintf(&newfile, L"%s.%d", fv->FullName, k+1);
+		aswprintf(&newfile, L"%s.%d%s", job->FullName, k+1, ext);
 		DeleteFileW(newfile);
 		if (MoveFileW(oldfile, newfile) == 0) {
-			OutputDebugPrintf("%s: rename %d\n", __FUNCTION__, errno);
+			OutputDebugPrintf("%s: rename %d\n", __FUNCTION__, GetLastError());
 		}
 		free(oldfile);
 		free(newfile);
 	}
+	free(gzname);
+}
 
-	// ăI[v
-	OpenLogFile(fv);
-	if (fv->bom) {
-		FLogOutputBOM(fv);
+static void FreeRotateJob(RotateJob *job)
+{
+	free(job->FullName);
+	free(job->TempName);
+	free(job);
+}
+
+// [e[gpXbh
+//	RotateHead ɓĂWuɏAȂȂI
+static unsigned _stdcall LogRotateThread(void *arg)
+{
+	(void)arg;
+	for (;;) {
+		RotateJob *job;
+		EnterCriticalSection(&g_rotate_lock);
+		job = RotateHead;
+		if (job != NULL) {
+			RotateHead = job->Next;
+			if (RotateHead == NULL) {
+				RotateTail = NULL;
+			}
+		}
+		else {
+			RotateRunning = FALSE;
+		}
+		LeaveCriticalSection(&g_rotate_lock);
+		if (job == NULL) {
+			break;
+		}
+		LogRotateFiles(job);
+		FreeRotateJob(job);
 	}
-	if (ts.DeferredLogWriteMode) {
-		StartThread(fv);
+
+	_endthreadex(0);
+	return (0);
+}
+
+/**
+ *	[e[gt@CĐ̃l[悤A[e[gpXbhֈ˗
+ *	XbhĂȂ΋N
+ *
+ *	@param	File	t@C, Ȃ NULL, Wu
+ *	@param	tmpname	[e[gt@C̈ꎞIȖO, Wu
+ */
+static void LogRotateQueue(PFileVar fv, LogFile_t *File, wchar_t *tmpname)
+{
+	unsigned tid;
+	RotateJob *job = (RotateJob *)malloc(sizeof(*job));
+	if (job == NULL) {
+		if (File != NULL) {
+			LogLostBytes += CloseLogFile(File);
+		}
+		free(tmpname);
+		return;
+	}
+	job->Next = NULL;
+	job->File = File;
+	job->FullName = _wcsdup(fv->FullName);
+	job->TempName = tmpname;
+	job->Step = fv->RotateStep;
+	job->Compress = fv->RotateCompress;
+
+	EnterCriticalSection(&g_rotate_lock);
+	if (!RotateRunning) {
+		if (RotateThread != NULL) {
+			// ÕXbh͏IĂ
+			CloseHandle(RotateThread);
+		}
+		RotateThread = (HANDLE)_beginthreadex(NULL, 0, LogRotateThread, NULL, 0, &tid);
+		RotateRunning = RotateThread != NULL;
+	}
+	if (!RotateRunning) {
+		LeaveCriticalSection(&g_rotate_lock);
+		// XbhgȂƂ͂̏ŏ
+		LogRotateFiles(job);
+		FreeRotateJob(job);
+		return;
+	}
+	if (RotateTail == NULL) {
+		RotateHead = job;
+	}
+	else {
+		RotateTail->Next = job;
+	}
+	RotateTail = job;
+	LeaveCriticalSection(&g_rotate_lock);
+}
+
+/**
+ *	[e[gpXbhIATera Term ̏IɌĂ
+ *	[e[gt@CI܂ő҂
+ *	̃l[ƈk͑҂ɒfAɃOJnƂ LogRotateRecover() ōs
+ */
+void FLogRotateUnInit(void)
+{
+	HANDLE thread;
+
+	EnterCriticalSection(&g_rotate_lock);
+	InterlockedExchange(&RotateQuit, 1);
+	thread = RotateThread;
+	RotateThread = NULL;
+	LeaveCriticalSection(&g_rotate_lock);
+	if (thread != NULL) {
+		WaitForSingleObject(thread, INFINITE);
+		CloseHandle(thread);
+	}
+}
+
+/**
+ *	Ot@CꎞIȖOɃl[
+ *	t@C FILE_SHARE_DELETE ŊJĂ̂ŁAJ܂܃l[ł
+ *
+ *	@return	l[̃t@C, l[łȂƂ NULL
+ */
+static wchar_t *LogRotateRename(PFileVar fv)
+{
+	int retry;
+
+	for (retry = 0 ; retry < 100 ; retry++) {
+		wchar_t *tmpname;
+		aswprintf(&tmpname, L"%s.rotate%u", fv->FullName, fv->RotateSeq++);
+		if (MoveFileW(fv->FullName, tmpname) != 0) {
+			return tmpname;
+		}
+		DWORD err = GetLastError();
+		free(tmpname);
+		if (err != ERROR_ALREADY_EXISTS && err != ERROR_FILE_EXISTS) {
+			OutputDebugPrintf("%s: rename %d\n", __FUNCTION__, err);
+			break;
+		}
+	}
+	return NULL;
+}
+
+typedef struct {
+	wchar_t *Name;
+	FILETIME Time;
+} RotateLeftover;
+
+static int CompareLeftover(const void *a, const void *b)
+{
+	return CompareFileTime(&((const RotateLeftover *)a)->Time, &((const RotateLeftover *)b)->Time);
+}
+
+/**
+ *	[e[g̓rŏIƂɎcꎞIȃt@C(name.rotateN, name.rotateN.gz)
+ *	ÂɃ[e[gpXbh֓nāÃt@Cɂ
+ */
+static void LogRotateRecover(PFileVar fv)
+{
+	const wchar_t *base;
+	size_t dir_len, base_len;
+	wchar_t *pattern;
+	WIN32_FIND_DATAW fd;
+	HANDLE h;
+	RotateLeftover *list = NULL;
+	size_t count = 0, max = 0, i;
+	BOOL running;
+
+	// O񃍃OƂ̃Wu܂cĂƂ́Ãt@CȂ̂
+	// ɃOJnƂɕЕt
+	EnterCriticalSection(&g_rotate_lock);
+	running = RotateRunning;
+	LeaveCriticalSection(&g_rotate_lock);
+	if (running) {
+		return;
+	}
+
+	base = wcsrchr(fv->FullName, L'\\');
+	base = (base != NULL) ? base + 1 : fv->FullName;
+	dir_len = base - fv->FullName;
+	base_len = wcslen(base);
+
+	aswprintf(&pattern, L"%s.rotate*", fv->FullName);
+	h = FindFirstFileW(pattern, &fd);
+	free(pattern);
+	if (h == INVALID_HANDLE_VALUE) {
+		return;
+	}
+	do {
+		const wchar_t *p;
+		wchar_t *name;
+		if (fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+			continue;
+		}
+		// Zt@Cňv̂Ȃǂ
+		if (_wcsnicmp(fd.cFileName, base, base_len) != 0 ||
+			wcsncmp(fd.cFileName + base_len, L".rotate", 7) != 0) {
+			continue;
+		}
+		p = fd.cFileName + base_len + 7;
+		if (*p < L'0' || *p > L'9') {
+			continue;
+		}
+		while (*p >= L'0' && *p <= L'9') {
+			p++;
+		}
+		if (*p != L'\0' && wcscmp(p, L".gz") != 0) {
+			continue;
+		}
+		aswprintf(&name, L"%.*s%s", (int)dir_len, fv->FullName, fd.cFileName);
+		if (*p != L'\0') {
+			// k̓rŏIƂ͌̃t@CcĂ̂ŁAg
+			size_t len = wcslen(name);
+			DWORD attr;
+			name[len - 3] = L'\0';
+			attr = GetFileAttributesW(name);
+			name[len - 3] = L'.';
+			if (attr != INVALID_FILE_ATTRIBUTES) {
+				DeleteFileW(name);
+				free(name);
+				continue;
+			}
+		}
+		if (count == max) {
+			size_t new_max = (max == 0) ? 8 : max * 2;
+			RotateLeftover *n = (RotateLeftover *)realloc(list, sizeof(RotateLeftover) * new_max);
+			if (n == NULL) {
+				free(name);
+				break;
+			}
+			list = n;
+			max = new_max;
+		}
+		list[count].Name = name;
+		list[count].Time = fd.ftLastWriteTime;
+		count++;
+	} while (FindNextFileW(h, &fd));
+	FindClose(h);
+
+	qsort(list, count, sizeof(RotateLeftover), CompareLeftover);
+	for (i = 0; i < count; i++) {
+		LogRotateQueue(fv, NULL, list[i].Name);
+	}
+	free(list);
+}
+
+/**
+ *	[e[gKv邩
+ */
+static BOOL LogRotateNeeded(PFileVar fv)
+{
+	// Ԃł̃[e[g LogRotate ̐ݒɂ炸s
+	// ĂȂt@C̓[e[gȂ(̃t@CŐoȂ)
+	if (fv->RotateInterval > 0 && fv->ByteCount > fv->RotateBase) {
+		if (GetTickCount() - fv->RotateTick >= fv->RotateInterval)
+			return TRUE;
+	}
+
+	if (fv->RotateMode == ROTATE_SIZE) {
+		if (fv->RotateSize == 0 && fv->RotateInterval > 0) {
+			// ԂŃ[e[g
+			return FALSE;
+		}
+		if (fv->ByteCount <= fv->RotateSize)
+			return FALSE;
+		//OutputDebugPrintf("%s: mode %d size %ld\n", __FUNCTION__, fv->RotateMode, fv->ByteCount);
+		return TRUE;
+	}
+	return FALSE;
+}
+
+// O[e[gB
+// (2013.3.21 yutaka)
+//	̃t@C͊J܂܈ꎞIȖOɃl[āAɐVt@CJB
+//	̃t@C鏈(xݗpXbhɎcĂf[^݂̏ FlushFileBuffers())A
+//	̃l[∳k͎Ԃ̂ŁA[e[gpXbhōsB
+static void LogRotate(PFileVar fv)
+{
+	wchar_t *tmpname;
+	LogFile_t *old;
+
+	if (!LogRotateNeeded(fv))
+		return;
+
+	logfile_lock();
+	// OTCYďB
+	fv->ByteCount = 0;
+	fv->RotateTick = GetTickCount();
+
+	tmpname = LogRotateRename(fv);
+	if (tmpname == NULL) {
+		// l[łȂƂ͓t@Cɑď
+		fv->RotateBase = fv->ByteCount;
+		logfile_unlock();
+		return;
 	}
 
+	// Vt@CJ
+	old = fv->File;
+	fv->File = OpenLogFile(fv->FullName, FALSE);
+	if (fv->File != NULL) {
+		if (fv->bom) {
+			FLogOutputBOM(fv);
+		}
+		if (ts.DeferredLogWriteMode) {
+			StartThread(fv->File);
+		}
+	}
+	fv->RotateBase = fv->ByteCount;
+
 	logfile_unlock();
+
+	LogRotateQueue(fv, old, tmpname);
 }
 
 static wchar_t *TimeStampStr(PFileVar fv)
@@ -623,121 +1315,111 @@ static wchar_t *TimeStampStr(PFileVar fv)
  */
 static void LogToFile(PFileVar fv)
 {
-	PCHAR Buf;
-	int Start, Count;
-	BYTE b;
+	LogBuf_t *lb;
+	int len1, len2;
 
 	if (fv->FileLog)
 	{
-		Buf = cv_LogBuf;
-		Start = cv_LStart;
-		Count = cv_LCount;
+		lb = &cv_LogBuf;
 	}
 	else if (fv->BinLog)
 	{
-		Buf = cv_BinBuf;
-		Start = cv_BStart;
-		Count = cv_BCount;
+		lb = &cv_BinBuf;
 	}
 	else
 		return;
 
-	if (Buf==NULL) return;
-	if (Count==0) return;
+	LogLostBytes += InterlockedExchange(&LogThreadLostBytes, 0);
+
+	if (lb->Buf==NULL) return;
+	if (lb->Count==0) return;
 
 	// bN(2004.8.6 yutaka)
 	logfile_lock();
 
-	// ݃f[^쐬
-	DWORD WriteBufMax = 8192;
-	DWORD WriteBufLen = 0;
-	PCHAR WriteBuf = (PCHAR)malloc(WriteBufMax);
-	while (Get1(Buf,&Start,&Count,&b)) {
-		if (FLogIsPause() || ProtoGetProtoFlag()) {
-			continue;
-		}
-
-		if (WriteBufLen >= (WriteBufMax*4/5)) {
-			WriteBufMax *= 2;
-			WriteBuf = (PCHAR)realloc(WriteBuf, WriteBufMax);
-		}
-
-		WriteBuf[WriteBufLen++] = b;
+	if (FLogIsPause() || ProtoGetProtoFlag()) {
+		// ܂Ɏ̂Ă
+		lb->Start = 0;
+		lb->Count = 0;
+		logfile_unlock();
+		return;
+	}
 
-		(fv->ByteCount)++;
+	// obt@̃f[^͍ő2̘ÄɂȂĂ
+	len1 = lb->Size - lb->Start;
+	if (len1 > lb->Count) {
+		len1 = lb->Count;
 	}
+	len2 = lb->Count - len1;
 
 	// 
-	if (WriteBufLen > 0) {
-		if (ts.DeferredLogWriteMode) {
-			PostThreadMessage(fv->LogThreadId, WM_DPC_LOGTHREAD_SEND, (WPARAM)WriteBuf, WriteBufLen);
-		}
-		else {
-			DWORD wrote;
-			WriteFile(fv->FileHandle, WriteBuf, WriteBufLen, &wrote, NULL);
-			free(WriteBuf);
+	if (fv->File == NULL) {
+		// [e[gŐVt@CJȂ
+		LogLostBytes += lb->Count;
+	}
+	else if (fv->File->LogThread != INVALID_HANDLE_VALUE) {
+		LogLostBytes += LogRingWrite(fv->File, &lb->Buf[lb->Start], len1);
+		LogLostBytes += LogRingWrite(fv->File, lb->Buf, len2);
+	}
+	else {
+		LogLostBytes += LogWriteFile(fv->File, &lb->Buf[lb->Start], len1);
+		if (len2 > 0) {
+			LogLostBytes += LogWriteFile(fv->File, lb->Buf, len2);
 		}
+		LogLostBytes += LogFlushInterval(fv->File);
 	}
+	fv->ByteCount += lb->Count;
+	lb->Start = 0;
+	lb->Count = 0;
 
 	logfile_unlock();
 
-	if (fv->FileLog)
-	{
-		cv_LStart = Start;
-		cv_LCount = Count;
-	}
-	else {
-		cv_BStart = Start;
-		cv_BCount = Count;
-	}
-	if (FLogIsPause() || ProtoGetProtoFlag()) return;
-	fv->FLogDlg->RefreshNum(fv->StartTime, fv->FileSize, fv->ByteCount);
+	fv->FLogDlg->RefreshNum(fv->StartTime, fv->FileSize, fv->ByteCount, FLogGetLostCount());
 
 
 	// OE[e[g
 	LogRotate(fv);
 }
 
-static BOOL CreateLogBuf(void)
+static BOOL CreateLogBuf_(LogBuf_t *lb)
 {
-	if (cv_LogBuf==NULL)
+	if (lb->Buf==NULL)
 	{
-		cv_LogBuf = (char *)malloc(InBuffSize);
-		cv_LogPtr = 0;
-		cv_LStart = 0;
-		cv_LCount = 0;
+		lb->Buf = (PCHAR)malloc(LOG_BUFF_SIZE_INIT);
+		lb->Size = (lb->Buf != NULL) ? LOG_BUFF_SIZE_INIT : 0;
+		lb->Start = 0;
+		lb->Count = 0;
 	}
-	return (cv_LogBuf!=NULL);
+	return (lb->Buf!=NULL);
+}
+
+static void FreeLogBuf_(LogBuf_t *lb)
+{
+	free(lb->Buf);
+	lb->Buf = NULL;
+	lb->Size = 0;
+	lb->Start = 0;
+	lb->Count = 0;
+}
+
+static BOOL CreateLogBuf(void)
+{
+	return CreateLogBuf_(&cv_LogBuf);
 }
 
 static void FreeLogBuf(void)
 {
-	free(cv_LogBuf);
-	cv_LogBuf = NULL;
-	cv_LogPtr = 0;
-	cv_LStart = 0;
-	cv_LCount = 0;
+	FreeLogBuf_(&cv_LogBuf);
 }
 
 static BOOL CreateBinBuf(void)
 {
-	if (cv_BinBuf==NULL)
-	{
-		cv_BinBuf = (PCHAR)malloc(InBuffSize);
-		cv_BinPtr = 0;
-		cv_BStart = 0;
-		cv_BCount = 0;
-	}
-	return (cv_BinBuf!=NULL);
+	return CreateLogBuf_(&cv_BinBuf);
 }
 
 static void FreeBinBuf(void)
 {
-	free(cv_BinBuf);
-	cv_BinBuf = NULL;
-	cv_BinPtr = 0;
-	cv_BStart = 0;
-	cv_BCount = 0;
+	FreeLogBuf_(&cv_BinBuf);
 }
 
 static void FileTransEnd_(PFileVar fv)
@@ -753,7 +1435,11 @@ static void FileTransEnd_(PFileVar fv)
 		FLogDlg = NULL;
 		fv->FLogDlg = NULL;
 	}
-	CloseFileSync(fv);
+	if (fv->File != NULL) {
+		LogLostBytes += CloseLogFile(fv->File);
+		fv->File = NULL;
+	}
+	// [e[gpXbh͑҂ȂAcĂWuĂI
 	FreeLogBuf();
 	FreeBinBuf();
 	free(fv->FullName);
@@ -816,6 +1502,7 @@ void FLogRotateHalt(void)
 	fv->RotateMode = ROTATE_NONE;
 	fv->RotateSize = 0;
 	fv->RotateStep = 0;
+	fv->RotateInterval = 0;
 }
 
 static INT_PTR CALLBACK OnCommentDlgProc(HWND hDlgWnd, UINT msg, WPARAM wp, LPARAM)
@@ -880,6 +1567,9 @@ void FLogClose(void)
 		return;
 	}
 
+	// obt@ɎcĂ郍OoĂ
+	// Ƃ͎Ԃł̃[e[g͂Ȃ
+	LogWriteAll(fv);
 	FileTransEnd_(fv);
 }
 
@@ -904,8 +1594,6 @@ BOOL FLogOpen(const wchar_t *fname, LogCode_t code, BOOL bom)
 	}
 	LogVar = fv;
 	memset(fv, 0, sizeof(TFileVar));
-	fv->FileHandle = INVALID_HANDLE_VALUE;
-	fv->LogThread = INVALID_HANDLE_VALUE;
 	fv->eLineEnd = Line_LineHead;
 
 	fv->log_code = code;
@@ -1135,23 +1823,12 @@ static void Log1Bin(BYTE b)
 		cv_BinSkip--;
 		return;
 	}
-	cv_BinBuf[cv_BinPtr] = b;
-	cv_BinPtr++;
-	if (cv_BinPtr>=InBuffSize) {
-		cv_BinPtr = cv_BinPtr-InBuffSize;
-	}
-	if (cv_BCount>=InBuffSize) {
-		cv_BCount = InBuffSize;
-		cv_BStart = cv_BinPtr;
-	}
-	else {
-		cv_BCount++;
-	}
+	LogBufPut1(LogVar, &cv_BinBuf, b);
 }
 
 static void LogBinSkip(int add)
 {
-	if (cv_BinBuf != NULL) {
+	if (cv_BinBuf.Buf != NULL) {
 		cv_BinSkip += add;
 	}
 }
@@ -1166,16 +1843,17 @@ int FLogGetCount(void)
 		return 0;
 	}
 	if (fv->FileLog) {
-		return cv_LCount;
+		return cv_LogBuf.Count;
 	}
 	if (fv->BinLog) {
-		return cv_BCount;
+		return cv_BinBuf.Count;
 	}
 	return 0;
 }
 
 /**
  *	Oobt@̋󂫃oCgԂ
+ *	obt@傫ł镪܂
  */
 int FLogGetFreeCount(void)
 {
@@ -1184,116 +1862,171 @@ int FLogGetFreeCount(void)
 		return 0;
 	}
 	if (fv->FileLog) {
-		return InBuffSize - cv_LCount;
+		return LOG_BUFF_SIZE_MAX - cv_LogBuf.Count;
 	}
 	if (fv->BinLog) {
-		return InBuffSize - cv_BCount;
+		return LOG_BUFF_SIZE_MAX - cv_BinBuf.Count;
 	}
 	return 0;
 }
 
 /**
- * obt@̃Ot@C֏
+ *	OJnĂ珑߂ɎꂽoCgԂ
+ *	0 Ȃ烍O͌ĂȂ
  */
-void FLogWriteFile(void)
+LONGLONG FLogGetLostCount(void)
 {
-	PFileVar fv = LogVar;
-	if (fv == NULL) {
-		return;
-	}
-	if (cv_LogBuf!=NULL)
+	return LogLostBytes + LogThreadLostBytes;
+}
+
+/**
+ *	obt@̃Ot@C֏
+ */
+static void LogWriteAll(PFileVar fv)
+{
+	if (cv_LogBuf.Buf!=NULL)
 	{
 		if (fv->FileLog) {
 			LogToFile(fv);
 		}
 	}
 
-	if (cv_BinBuf!=NULL)
+	if (cv_BinBuf.Buf!=NULL)
 	{
 		if (fv->BinLog) {
 			LogToFile(fv);
 		}
 	}
+
+	if (fv->File != NULL && fv->File->LogThread == INVALID_HANDLE_VALUE) {
+		// Vf[^ȂĂ莞ԂƂɈkÕubNAFlushFileBuffers() 
+		LogLostBytes += LogFlushInterval(fv->File);
+	}
 }
 
-void FLogPutUTF32(unsigned int u32)
+void FLogWriteFile(void)
 {
 	PFileVar fv = LogVar;
-	BOOL log_available = (cv_LogBuf != 0);
-
-	if (!log_available) {
-		// Oɂ͏o͂Ȃ
+	if (fv == NULL) {
 		return;
 	}
+	LogWriteAll(fv);
 
-	// s?(so͂)
-	if (ts.LogTimestamp && fv->eLineEnd) {
-		// ^CX^vo
-		fv->eLineEnd = Line_Other; /* clear endmark*/
-		wchar_t* strtime = TimeStampStr(fv);
-		FLogWriteStr(strtime);
-		free(strtime);
+	// LogToFile() ͏ރf[^ȂƂ̓[e[gȂ̂ŁA
+	// Vf[^ȂƂԂŃ[e[g
+	if (fv->RotateInterval > 0 && !FLogIsPause()) {
+		LogRotate(fv);
 	}
+}
 
-	switch(fv->log_code) {
-	case LOG_UTF8: {
-		// UTF-8
-		char u8_buf[4];
-		size_t u8_len = UTF32ToUTF8(u32, u8_buf, _countof(u8_buf));
-		for (size_t i = 0; i < u8_len; i++) {
-			BYTE b = u8_buf[i];
-			LogPut1(b);
-		}
-		break;
+/**
+ *	UTF-32 ̕ UTF-8 ɕϊăobt@֏
+ */
+static void LogPutUTF8(PFileVar fv, const unsigned int *u32, size_t len)
+{
+	BYTE buf[1024];
+
+	while (len > 0) {
+		size_t pos;
+		size_t n = LogEncUTF8(u32, len, buf, sizeof(buf), &pos);
+		LogBufWrite(fv, &cv_LogBuf, buf, pos);
+		u32 += n;
+		len -= n;
 	}
-	case LOG_UTF16LE:
-	case LOG_UTF16BE: {
-		// UTF-16
-		wchar_t u16[2];
-		size_t u16_len = UTF32ToUTF16(u32, u16, _countof(u16));
-		for (size_t i = 0; i < u16_len; i++) {
-			if (fv->log_code == LOG_UTF16LE) {
-				// UTF-16LE
-				LogPut1(u16[i] & 0xff);
-				LogPut1((u16[i] >> 8) & 0xff);
-			}
-			else {
-				// UTF-16BE
-				LogPut1((u16[i] >> 8) & 0xff);
-				LogPut1(u16[i] & 0xff);
-			}
-		}
+}
+
+/**
+ *	UTF-32 ̕ UTF-16LE/BE ɕϊăobt@֏
+ */
+static void LogPutUTF16(PFileVar fv, const unsigned int *u32, size_t len)
+{
+	BYTE buf[1024];
+	const BOOL be = (fv->log_code == LOG_UTF16BE);
+
+	while (len > 0) {
+		size_t pos;
+		size_t n = LogEncUTF16(u32, len, be, buf, sizeof(buf), &pos);
+		LogBufWrite(fv, &cv_LogBuf, buf, pos);
+		u32 += n;
+		len -= n;
 	}
+}
+
+/**
+ *	UTF-32 ̕O֏o͂
+ *	sƂɋ؂āAsł̓^CX^vo͂
+ *
+ *	@param	u32		
+ *	@param	len		
+ */
+void FLogPutUTF32Run(const unsigned int *u32, size_t len)
+{
+	PFileVar fv = LogVar;
+	BOOL log_available = (cv_LogBuf.Buf != 0);
+
+	if (!log_available || !fv->FileLog) {
+		// Oɂ͏o͂Ȃ
+		return;
 	}
 
-	if (u32 == 0x0a) {
-		fv->eLineEnd = Line_LineHead; /* set endmark*/
+	while (len > 0) {
+		size_t n;
+
+		// s?(so͂)
+		if (ts.LogTimestamp && fv->eLineEnd) {
+			// ^CX^vo
+			fv->eLineEnd = Line_Other; /* clear endmark*/
+			wchar_t* strtime = TimeStampStr(fv);
+			FLogWriteStr(strtime);
+			free(strtime);
+		}
+
+		// s܂ł܂Ƃ߂ĕϊ
+		n = LogEncFindLineEnd(u32, len);
+		switch(fv->log_code) {
+		case LOG_UTF8:
+			LogPutUTF8(fv, u32, n);
+			break;
+		case LOG_UTF16LE:
+		case LOG_UTF16BE:
+			LogPutUTF16(fv, u32, n);
+			break;
+		}
+
+		if (u32[n - 1] == 0x0a) {
+			fv->eLineEnd = Line_LineHead; /* set endmark*/
+		}
+		u32 += n;
+		len -= n;
 	}
 }
 
-static void FLogOutputBOM(PFileVar fv)
+void FLogPutUTF32(unsigned int u32)
 {
-	DWORD wrote;
+	FLogPutUTF32Run(&u32, 1);
+}
 
+static void FLogOutputBOM(PFileVar fv)
+{
 	switch(fv->log_code) {
 	case 0: {
 		// UTF-8
 		const char *bom = "\xef\xbb\xbf";
-		WriteFile(fv->FileHandle, bom, 3, &wrote, NULL);
+		LogLostBytes += LogWriteFile(fv->File, bom, 3);
 		fv->ByteCount += 3;
 		break;
 	}
 	case 1: {
 		// UTF-16LE
 		const char *bom = "\xff\xfe";
-		WriteFile(fv->FileHandle, bom, 2, &wrote, NULL);
+		LogLostBytes += LogWriteFile(fv->File, bom, 2);
 		fv->ByteCount += 2;
 		break;
 	}
 	case 2: {
 		// UTF-16BE
 		const char *bom = "\xfe\xff";
-		WriteFile(fv->FileHandle, bom, 2, &wrote, NULL);
+		LogLostBytes += LogWriteFile(fv->File, bom, 2);
 		fv->ByteCount += 2;
 		break;
 	}
@@ -52,6 +52,7 @@ wchar_t *FLogGetLogFilename(const wchar_t *log_filename);
 wchar_t *FLogGetLogFilenameBase(const wchar_t *filename);
 
 void logfile_lock_initialize(void);
+void FLogRotateUnInit(void);
 void FLogPause(BOOL Pause);
 void FLogRotateSize(size_t size);
 void FLogRotateRotate(int step);
@@ -69,8 +70,10 @@ void FLogWindow(int nCmdShow);
 void FLogShowDlg(void);
 int FLogGetCount(void);
 int FLogGetFreeCount(void);
+LONGLONG FLogGetLostCount(void);
 void FLogWriteFile(void);
 void FLogPutUTF32(unsigned int u32);
+void FLogPutUTF32Run(const unsigned int *u32, size_t len);
 void FLogOutputAllBuffer(void);
 
 #ifdef __cplusplus
@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2026- TeraTerm Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* TERATERM.EXE, log encoding */
+#include <string.h>
+#include <stdint.h>
+#include <windows.h>
+
+#include "codeconv.h"
+
+#include "filesys_log_enc.h"
+
+/**
+ *	LF(0x0a) ̎̈ʒuԂ
+ *	LF ȂƂ len Ԃ
+ *	2(64bit)܂Ƃ߂Ĕ肷
+ */
+size_t LogEncFindLineEnd(const unsigned int *u32, size_t len)
+{
+	const uint64_t ones = 0x0000000100000001ULL;
+	const uint64_t highs = 0x8000000080000000ULL;
+	size_t i = 0;
+
+	while (i + 2 <= len) {
+		uint64_t x;
+		memcpy(&x, u32 + i, sizeof(x));
+		x ^= ones * 0x0a;
+		if (((x - ones) & ~x & highs) != 0) {
+			// ǂ炩 LF
+			break;
+		}
+		i += 2;
+	}
+	while (i < len) {
+		if (u32[i++] == 0x0a) {
+			return i;
+		}
+	}
+	return len;
+}
+
+/**
+ *	UTF-32 ̕ UTF-8 ɕϊ
+ *	ASCII 4܂Ƃ߂ĕϊ
+ *
+ *	@param	u32			
+ *	@param	len			
+ *	@param	buf			o̓obt@
+ *	@param	buf_size	o̓obt@̃TCY(LOG_ENC_CHAR_MAX ȏ)
+ *	@param	out_len		o͂oCg
+ *	@retval	ϊ
+ */
+size_t LogEncUTF8(const unsigned int *u32, size_t len, BYTE *buf, size_t buf_size, size_t *out_len)
+{
+	size_t pos = 0;
+	size_t i = 0;
+
+	while (i < len && pos <= buf_size - LOG_ENC_CHAR_MAX) {
+		if (i + 4 <= len && (u32[i] | u32[i + 1] | u32[i + 2] | u32[i + 3]) < 0x80) {
+			buf[pos] = (BYTE)u32[i];
+			buf[pos + 1] = (BYTE)u32[i + 1];
+			buf[pos + 2] = (BYTE)u32[i + 2];
+			buf[pos + 3] = (BYTE)u32[i + 3];
+			pos += 4;
+			i += 4;
+			continue;
+		}
+		pos += UTF32ToUTF8(u32[i], (char *)&buf[pos], LOG_ENC_CHAR_MAX);
+		i++;
+	}
+	*out_len = pos;
+	return i;
+}
+
+/**
+ *	UTF-32 ̕ UTF-16LE/BE ɕϊ
+ *
+ *	@param	be			TRUE ̂Ƃ UTF-16BE
+ *	̑̈Ɩ߂l LogEncUTF8() Ɠ
+ */
+size_t LogEncUTF16(const unsigned int *u32, size_t len, BOOL be, BYTE *buf, size_t buf_size, size_t *out_len)
+{
+	size_t pos = 0;
+	size_t i;
+
+	for (i = 0; i < len && pos <= buf_size - LOG_ENC_CHAR_MAX; i++) {
+		wchar_t u16[2];
+		size_t u16_len;
+		size_t k;
+
+		if (u32[i] < 0x10000) {
+			u16[0] = (wchar_t)u32[i];
+			u16_len = 1;
+		}
+		else {
+			u16_len = UTF32ToUTF16(u32[i], u16, 2);
+		}
+		for (k = 0; k < u16_len; k++) {
+			if (be) {
+				buf[pos++] = (u16[k] >> 8) & 0xff;
+				buf[pos++] = u16[k] & 0xff;
+			}
+			else {
+				buf[pos++] = u16[k] & 0xff;
+				buf[pos++] = (u16[k] >> 8) & 0xff;
+			}
+		}
+	}
+	*out_len = pos;
+	return i;
+}
@@ -0,0 +1,768 @@
+/*
+ * Copyright (C) 2026- TeraTerm Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* TERATERM.EXE, compressed log */
+#include <string.h>
+#include <stdint.h>
+#if !defined(_CRTDBG_MAP_ALLOC)
+#define _CRTDBG_MAP_ALLOC
+#endif
+#include <stdlib.h>
+#include <crtdbg.h>
+#include <windows.h>
+
+#include "zlib.h"
+
+#include "filesys_log_gz.h"
+
+#define GZ_HEADER_SIZE		12	// ID1 ID2 CM FLG MTIME XFL OS XLEN
+#define GZ_SUBFIELD_SIZE	4	// SI1 SI2 LEN
+#define GZ_FOOTER_SIZE		8	// CRC32 ISIZE
+#define GZ_EMPTY_DEFLATE	2	//  deflate ubN
+
+#define BLOCK_EXTRA_LEN		16
+#define BLOCK_HEADER_SIZE	(GZ_HEADER_SIZE + GZ_SUBFIELD_SIZE + BLOCK_EXTRA_LEN)
+#define INDEX_ENTRY_SIZE	20
+#define INDEX_ENTRY_MAX		((0xffff - GZ_SUBFIELD_SIZE) / INDEX_ENTRY_SIZE)
+#define TRAILER_EXTRA_LEN	20
+#define TRAILER_SIZE		(GZ_HEADER_SIZE + GZ_SUBFIELD_SIZE + TRAILER_EXTRA_LEN + GZ_EMPTY_DEFLATE + GZ_FOOTER_SIZE)
+
+typedef struct {
+	uint64_t file_pos;
+	uint64_t raw_pos;
+	uint32_t time;
+} LogGzIndex;
+
+struct LogGzTag {
+	HANDLE FileHandle;
+	z_stream zs;
+	BYTE *raw;				// kÕf[^
+	DWORD raw_len;
+	BYTE *out;				// kf[^(gzip member)
+	DWORD out_size;
+	uint64_t file_pos;		// ̃ubNt@C̈ʒu
+	uint64_t raw_pos;		// ̃ubN̓WJ̈ʒu
+	uint32_t block_time;	// ̃ubN̍ŏ̃f[^󂯎
+	LogGzIndex *index;
+	size_t index_count;
+	size_t index_max;
+};
+
+static void Put16(BYTE *p, uint16_t v)
+{
+	p[0] = (BYTE)v;
+	p[1] = (BYTE)(v >> 8);
+}
+
+static void Put32(BYTE *p, uint32_t v)
+{
+	Put16(p, (uint16_t)v);
+	Put16(p + 2, (uint16_t)(v >> 16));
+}
+
+static void Put64(BYTE *p, uint64_t v)
+{
+	Put32(p, (uint32_t)v);
+	Put32(p + 4, (uint32_t)(v >> 32));
+}
+
+static uint16_t Get16(const BYTE *p)
+{
+	return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t Get32(const BYTE *p)
+{
+	return Get16(p) | ((uint32_t)Get16(p + 2) << 16);
+}
+
+static uint64_t Get64(const BYTE *p)
+{
+	return Get32(p) | ((uint64_t)Get32(p + 4) << 32);
+}
+
+/**
+ *	ݎ(UNIX)
+ */
+static uint32_t GetUnixTime(void)
+{
+	FILETIME ft;
+	ULARGE_INTEGER t;
+	GetSystemTimeAsFileTime(&ft);
+	t.LowPart = ft.dwLowDateTime;
+	t.HighPart = ft.dwHighDateTime;
+	return (uint32_t)((t.QuadPart - 116444736000000000ULL) / 10000000);
+}
+
+/**
+ *	FEXTRA t gzip header  subfield header 
+ *
+ *	@return	subfield ̃f[^ʒu
+ */
+static BYTE *PutHeader(BYTE *p, uint32_t mtime, BYTE si2, uint16_t sub_len)
+{
+	p[0] = 0x1f;	// ID1
+	p[1] = 0x8b;	// ID2
+	p[2] = 8;		// CM = deflate
+	p[3] = 0x04;	// FLG = FEXTRA
+	Put32(&p[4], mtime);
+	p[8] = 0;		// XFL
+	p[9] = 11;		// OS = NTFS
+	Put16(&p[10], (uint16_t)(GZ_SUBFIELD_SIZE + sub_len));
+	p[12] = 'T';
+	p[13] = si2;
+	Put16(&p[14], sub_len);
+	return p + GZ_HEADER_SIZE + GZ_SUBFIELD_SIZE;
+}
+
+/**
+ *	PutHeader() ŏ header ׂ
+ *
+ *	@return	subfield ̃f[^̃oCgAႤƂ -1
+ */
+static int CheckHeader(const BYTE *p, BYTE si2)
+{
+	uint16_t sub_len;
+	if (p[0] != 0x1f || p[1] != 0x8b || p[2] != 8 || p[3] != 0x04) {
+		return -1;
+	}
+	if (p[12] != 'T' || p[13] != si2) {
+		return -1;
+	}
+	sub_len = Get16(&p[14]);
+	if (Get16(&p[10]) != GZ_SUBFIELD_SIZE + sub_len) {
+		return -1;
+	}
+	return sub_len;
+}
+
+/**
+ *	 member ̎c(deflate, CRC32, ISIZE)
+ */
+static void PutEmptyBody(BYTE *p)
+{
+	p[0] = 0x03;
+	p[1] = 0x00;
+	Put32(&p[2], 0);
+	Put32(&p[6], 0);
+}
+
+static BOOL CheckEmptyBody(const BYTE *p)
+{
+	return p[0] == 0x03 && p[1] == 0x00 && Get32(&p[2]) == 0 && Get32(&p[6]) == 0;
+}
+
+static BOOL ReadAt(HANDLE h, uint64_t pos, void *buf, DWORD len)
+{
+	LARGE_INTEGER li;
+	DWORD read;
+	li.QuadPart = (LONGLONG)pos;
+	if (!SetFilePointerEx(h, li, NULL, FILE_BEGIN)) {
+		return FALSE;
+	}
+	if (!ReadFile(h, buf, len, &read, NULL)) {
+		return FALSE;
+	}
+	return read == len;
+}
+
+static DWORD WriteAll(LogGz *z, const void *buf, DWORD len)
+{
+	DWORD wrote;
+	if (!WriteFile(z->FileHandle, buf, len, &wrote, NULL)) {
+		wrote = 0;
+	}
+	z->file_pos += wrote;
+	return wrote;
+}
+
+static BOOL AddIndex(LogGz *z, uint64_t file_pos, uint64_t raw_pos, uint32_t time)
+{
+	LogGzIndex *e;
+	if (z->index_count == z->index_max) {
+		size_t new_max = z->index_max == 0 ? 256 : z->index_max * 2;
+		LogGzIndex *p = (LogGzIndex *)realloc(z->index, sizeof(LogGzIndex) * new_max);
+		if (p == NULL) {
+			return FALSE;
+		}
+		z->index = p;
+		z->index_max = new_max;
+	}
+	e = &z->index[z->index_count++];
+	e->file_pos = file_pos;
+	e->raw_pos = raw_pos;
+	e->time = time;
+	return TRUE;
+}
+
+/**
+ *	OƂ̃CfbNXǂݍ
+ *	z->file_pos ̓CfbNẌʒu(Ō̃f[^ubŇ)ɂȂ
+ */
+static BOOL LoadIndex(LogGz *z, uint64_t size)
+{
+	BYTE trailer[TRAILER_SIZE];
+	uint64_t index_pos;
+	uint64_t raw_size;
+	uint32_t count;
+	DWORD len;
+	BYTE *buf;
+	DWORD i;
+
+	if (size < TRAILER_SIZE) {
+		return FALSE;
+	}
+	if (!ReadAt(z->FileHandle, size - TRAILER_SIZE, trailer, TRAILER_SIZE)) {
+		return FALSE;
+	}
+	if (CheckHeader(trailer, 'T') != TRAILER_EXTRA_LEN ||
+		!CheckEmptyBody(&trailer[TRAILER_SIZE - GZ_EMPTY_DEFLATE - GZ_FOOTER_SIZE])) {
+		return FALSE;
+	}
+	index_pos = Get64(&trailer[16]);
+	raw_size = Get64(&trailer[24]);
+	count = Get32(&trailer[32]);
+	if (index_pos > size - TRAILER_SIZE || size - TRAILER_SIZE - index_pos > 0x7fffffff) {
+		return FALSE;
+	}
+
+	len = (DWORD)(size - TRAILER_SIZE - index_pos);
+	buf = (BYTE *)malloc(len + 1);
+	if (buf == NULL) {
+		return FALSE;
+	}
+	if (!ReadAt(z->FileHandle, index_pos, buf, len)) {
+		free(buf);
+		return FALSE;
+	}
+	z->index_count = 0;
+	i = 0;
+	while (i < len) {
+		int sub_len;
+		int n;
+		const BYTE *p;
+		if (len - i < GZ_HEADER_SIZE + GZ_SUBFIELD_SIZE + GZ_EMPTY_DEFLATE + GZ_FOOTER_SIZE) {
+			break;
+		}
+		sub_len = CheckHeader(&buf[i], 'I');
+		if (sub_len < 0 || sub_len % INDEX_ENTRY_SIZE != 0 ||
+			len - i < (DWORD)(GZ_HEADER_SIZE + GZ_SUBFIELD_SIZE + sub_len + GZ_EMPTY_DEFLATE + GZ_FOOTER_SIZE)) {
+			break;
+		}
+		p = &buf[i + GZ_HEADER_SIZE + GZ_SUBFIELD_SIZE];
+		if (!CheckEmptyBody(p + sub_len)) {
+			break;
+		}
+		for (n = 0; n < sub_len; n += INDEX_ENTRY_SIZE) {
+			if (!AddIndex(z, Get64(&p[n]), Get64(&p[n + 8]), Get32(&p[n + 16]))) {
+				break;
+			}
+		}
+		i += GZ_HEADER_SIZE + GZ_SUBFIELD_SIZE + sub_len + GZ_EMPTY_DEFLATE + GZ_FOOTER_SIZE;
+	}
+	free(buf);
+	if (i != len || z->index_count != count) {
+		z->index_count = 0;
+		return FALSE;
+	}
+	z->file_pos = index_pos;
+	z->raw_pos = raw_size;
+	return TRUE;
+}
+
+/**
+ *	CfbNXȂƂ(ُIƂȂ)Af[^ubNǂăCfbNX
+ *	rŉĂubNƂ́Az->file_pos ͍Ō̊SȃubŇɂȂ
+ *
+ *	@retval	FALSE	擪kÕubNł͂Ȃ
+ */
+static BOOL ScanBlocks(LogGz *z, uint64_t size)
+{
+	uint64_t pos = 0;
+	BYTE header[BLOCK_HEADER_SIZE];
+	BYTE footer[GZ_FOOTER_SIZE];
+
+	z->index_count = 0;
+	z->raw_pos = 0;
+	while (pos + BLOCK_HEADER_SIZE <= size) {
+		uint32_t member_size;
+		uint32_t raw_len;
+		uint64_t raw_pos;
+		if (!ReadAt(z->FileHandle, pos, header, BLOCK_HEADER_SIZE)) {
+			break;
+		}
+		if (CheckHeader(header, 'L') != BLOCK_EXTRA_LEN) {
+			break;
+		}
+		member_size = Get32(&header[16]);
+		raw_len = Get32(&header[20]);
+		raw_pos = Get64(&header[24]);
+		if (member_size < BLOCK_HEADER_SIZE + GZ_FOOTER_SIZE || pos + member_size > size) {
+			break;
+		}
+		// ISIZE WJ̃oCgƍĂȂ΁A݂̓rŏIĂ
+		if (!ReadAt(z->FileHandle, pos + member_size - GZ_FOOTER_SIZE, footer, GZ_FOOTER_SIZE) ||
+			Get32(&footer[4]) != raw_len) {
+			break;
+		}
+		if (!AddIndex(z, pos, raw_pos, Get32(&header[4]))) {
+			break;
+		}
+		z->raw_pos = raw_pos + raw_len;
+		pos += member_size;
+	}
+
+	if (pos == 0) {
+		return FALSE;
+	}
+	z->file_pos = pos;
+	return TRUE;
+}
+
+/**
+ *	t@C̃CfbNXǂݍށACfbNXȂƂ̓f[^ubNǂč
+ *
+ *	@param[out]	size	t@C̃TCY
+ *	@retval	FALSE	ł͂Ȃt@C̐擪kÕubNł͂Ȃ
+ */
+static BOOL LoadBlocks(LogGz *z, uint64_t *size)
+{
+	LARGE_INTEGER li;
+
+	if (!GetFileSizeEx(z->FileHandle, &li)) {
+		return FALSE;
+	}
+	*size = (uint64_t)li.QuadPart;
+	if (*size == 0) {
+		return TRUE;
+	}
+	if (LoadIndex(z, *size)) {
+		return TRUE;
+	}
+	return ScanBlocks(z, *size);
+}
+
+/**
+ *	܂Ăf[^1̃ubNƂď
+ *
+ *	@return	߂ȂoCg
+ */
+static DWORD WriteBlock(LogGz *z)
+{
+	DWORD raw_len = z->raw_len;
+	DWORD member_size;
+	BYTE *p;
+	int r;
+
+	if (raw_len == 0) {
+		return 0;
+	}
+	z->raw_len = 0;
+
+	deflateReset(&z->zs);
+	z->zs.next_in = z->raw;
+	z->zs.avail_in = raw_len;
+	z->zs.next_out = z->out + BLOCK_HEADER_SIZE;
+	z->zs.avail_out = z->out_size - BLOCK_HEADER_SIZE - GZ_FOOTER_SIZE;
+	r = deflate(&z->zs, Z_FINISH);
+	if (r != Z_STREAM_END) {
+		return raw_len;
+	}
+	member_size = BLOCK_HEADER_SIZE + (DWORD)z->zs.total_out + GZ_FOOTER_SIZE;
+
+	p = PutHeader(z->out, z->block_time, 'L', BLOCK_EXTRA_LEN);
+	Put32(&p[0], member_size);
+	Put32(&p[4], raw_len);
+	Put64(&p[8], z->raw_pos);
+	p = z->out + member_size - GZ_FOOTER_SIZE;
+	Put32(&p[0], (uint32_t)crc32(0, z->raw, raw_len));
+	Put32(&p[4], raw_len);
+
+	AddIndex(z, z->file_pos, z->raw_pos, z->block_time);
+	z->raw_pos += raw_len;
+	if (WriteAll(z, z->out, member_size) != member_size) {
+		return raw_len;
+	}
+	return 0;
+}
+
+/**
+ *	CfbNXƃgC
+ */
+static void WriteIndex(LogGz *z)
+{
+	uint64_t index_pos = z->file_pos;
+	size_t i = 0;
+	BYTE trailer[TRAILER_SIZE];
+	BYTE *p;
+
+	while (i < z->index_count) {
+		size_t n = z->index_count - i;
+		DWORD size;
+		BYTE *buf;
+		size_t k;
+
+		if (n > INDEX_ENTRY_MAX) {
+			n = INDEX_ENTRY_MAX;
+		}
+		size = (DWORD)(GZ_HEADER_SIZE + GZ_SUBFIELD_SIZE + n * INDEX_ENTRY_SIZE + GZ_EMPTY_DEFLATE + GZ_FOOTER_SIZE);
+		buf = (BYTE *)malloc(size);
+		if (buf == NULL) {
+			// CfbNXȂAf[^ubNǂΓǂ߂
+			return;
+		}
+		p = PutHeader(buf, GetUnixTime(), 'I', (uint16_t)(n * INDEX_ENTRY_SIZE));
+		for (k = 0; k < n; k++) {
+			const LogGzIndex *e = &z->index[i + k];
+			Put64(&p[0], e->file_pos);
+			Put64(&p[8], e->raw_pos);
+			Put32(&p[16], e->time);
+			p += INDEX_ENTRY_SIZE;
+		}
+		PutEmptyBody(p);
+		if (WriteAll(z, buf, size) != size) {
+			free(buf);
+			return;
+		}
+		free(buf);
+		i += n;
+	}
+
+	p = PutHeader(trailer, GetUnixTime(), 'T', TRAILER_EXTRA_LEN);
+	Put64(&p[0], index_pos);
+	Put64(&p[8], z->raw_pos);
+	Put32(&p[16], (uint32_t)z->index_count);
+	PutEmptyBody(p + TRAILER_EXTRA_LEN);
+	WriteAll(z, trailer, TRAILER_SIZE);
+}
+
+static void Free(LogGz *z)
+{
+	deflateEnd(&z->zs);
+	free(z->raw);
+	free(z->out);
+	free(z->index);
+	free(z);
+}
+
+/**
+ *	kOJn
+ *	t@CɂłɈkOƂ͑珑
+ *	ł͂Ȃt@C̐擪kÕubNłȂƂ͊JnȂ
+ *
+ *	@param	FileHandle	GENERIC_READ | GENERIC_WRITE ŊJt@C
+ *	@return	LogGzClose() ŕANULL̂Ƃ͊JnłȂ
+ */
+LogGz *LogGzOpen(HANDLE FileHandle)
+{
+	LogGz *z;
+	uint64_t size;
+	LARGE_INTEGER li;
+
+	z = (LogGz *)calloc(1, sizeof(*z));
+	if (z == NULL) {
+		return NULL;
+	}
+	if (deflateInit2(&z->zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+		free(z);
+		return NULL;
+	}
+	z->FileHandle = FileHandle;
+	z->raw = (BYTE *)malloc(LOG_GZ_BLOCK_SIZE);
+	z->out_size = BLOCK_HEADER_SIZE + (DWORD)deflateBound(&z->zs, LOG_GZ_BLOCK_SIZE) + GZ_FOOTER_SIZE;
+	z->out = (BYTE *)malloc(z->out_size);
+	if (z->raw == NULL || z->out == NULL) {
+		Free(z);
+		return NULL;
+	}
+
+	if (!LoadBlocks(z, &size)) {
+		// kOł͂Ȃt@Čɂ͏Ȃ
+		Free(z);
+		return NULL;
+	}
+	li.QuadPart = (LONGLONG)z->file_pos;
+	if (!SetFilePointerEx(FileHandle, li, NULL, FILE_BEGIN)) {
+		Free(z);
+		return NULL;
+	}
+	if (z->file_pos < size) {
+		// CfbNXƃgCA܂͓rŏIĂubN폜đ珑
+		// (ꂽ member ̌ɏƁAgzip ͂ȍ~WJłȂ)
+		if (!SetEndOfFile(FileHandle)) {
+			Free(z);
+			return NULL;
+		}
+	}
+	return z;
+}
+
+/**
+ *	ubN̍ŏ̃f[^ LOG_GZ_BLOCK_TIME boĂAubNɂăt@C֏
+ *	f[^ȂƂIɌĂ
+ *
+ *	@return	߂ȂoCg
+ */
+DWORD LogGzIdle(LogGz *z)
+{
+	if (z->raw_len == 0 || GetUnixTime() - z->block_time < LOG_GZ_BLOCK_TIME) {
+		return 0;
+	}
+	return WriteBlock(z);
+}
+
+/**
+ *	f[^
+ *	LOG_GZ_BLOCK_SIZE ܂邩 LOG_GZ_BLOCK_TIME boƂɈkăt@C֏
+ *
+ *	@return	߂ȂoCg
+ */
+DWORD LogGzWrite(LogGz *z, const void *buf, DWORD len)
+{
+	const BYTE *p = (const BYTE *)buf;
+	DWORD lost = LogGzIdle(z);
+
+	while (len > 0) {
+		DWORD n = LOG_GZ_BLOCK_SIZE - z->raw_len;
+		if (n > len) {
+			n = len;
+		}
+		if (z->raw_len == 0) {
+			z->block_time = GetUnixTime();
+		}
+		memcpy(z->raw + z->raw_len, p, n);
+		z->raw_len += n;
+		p += n;
+		len -= n;
+		if (z->raw_len == LOG_GZ_BLOCK_SIZE) {
+			lost += WriteBlock(z);
+		}
+	}
+	return lost;
+}
+
+/**
+ *	܂Ăf[^ubNɂăt@C֏
+ *	FlushFileBuffers() ̑OɌĂ
+ *
+ *	@return	߂ȂoCg
+ */
+DWORD LogGzFlush(LogGz *z)
+{
+	return WriteBlock(z);
+}
+
+/**
+ *	c̃f[^ACfbNXAgCďI
+ *	t@C͕Ȃ
+ *
+ *	@return	߂ȂoCg
+ */
+DWORD LogGzClose(LogGz *z)
+{
+	DWORD lost = WriteBlock(z);
+	WriteIndex(z);
+	Free(z);
+	return lost;
+}
+
+struct LogGzReaderTag {
+	LogGz z;				// FileHandle, index, raw_pos(WJ̃TCY)g
+	z_stream zs;
+	size_t cache_block;		// z.raw ɓWJĂubNAȂƂ (size_t)-1
+};
+
+/**
+ *	kOǂݍݗpɊJ
+ *	ُIăCfbNXȂt@CAݒ̃t@Cǂ߂
+ *
+ *	@param	FileHandle	GENERIC_READ ŊJt@C
+ *	@return	LogGzReaderClose() ŕANULL̂Ƃ͈kOł͂Ȃ
+ */
+LogGzReader *LogGzReaderOpen(HANDLE FileHandle)
+{
+	LogGzReader *r;
+	uint64_t size;
+
+	r = (LogGzReader *)calloc(1, sizeof(*r));
+	if (r == NULL) {
+		return NULL;
+	}
+	if (inflateInit2(&r->zs, -MAX_WBITS) != Z_OK) {
+		free(r);
+		return NULL;
+	}
+	r->z.FileHandle = FileHandle;
+	r->z.raw = (BYTE *)malloc(LOG_GZ_BLOCK_SIZE);
+	r->z.out_size = BLOCK_HEADER_SIZE + (DWORD)compressBound(LOG_GZ_BLOCK_SIZE) + GZ_FOOTER_SIZE;
+	r->z.out = (BYTE *)malloc(r->z.out_size);
+	r->cache_block = (size_t)-1;
+	if (r->z.raw == NULL || r->z.out == NULL || !LoadBlocks(&r->z, &size)) {
+		LogGzReaderClose(r);
+		return NULL;
+	}
+	return r;
+}
+
+void LogGzReaderClose(LogGzReader *r)
+{
+	inflateEnd(&r->zs);
+	free(r->z.raw);
+	free(r->z.out);
+	free(r->z.index);
+	free(r);
+}
+
+/**
+ *	WJ̃TCY
+ */
+uint64_t LogGzReaderSize(LogGzReader *r)
+{
+	return r->z.raw_pos;
+}
+
+/**
+ *	time(UNIX)̃f[^܂ރubN̓WJ̈ʒuԂ
+ *	ubN̎͏ɑĂ邱ƂOɓ񕪒T
+ *
+ *	@return	time ÕubNȂƂ 0
+ */
+uint64_t LogGzReaderSeekTime(LogGzReader *r, uint32_t time)
+{
+	const LogGz *z = &r->z;
+	size_t lo = 0;
+	size_t hi = z->index_count;
+
+	// time Ɏn܂ŏ̃ubNT
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+		if (z->index[mid].time <= time) {
+			lo = mid + 1;
+		}
+		else {
+			hi = mid;
+		}
+	}
+	return lo == 0 ? 0 : z->index[lo - 1].raw_pos;
+}
+
+/**
+ *	WJ̈ʒu pos ܂ރubNT
+ *
+ *	@return	ȂƂ (size_t)-1
+ */
+static size_t FindBlock(const LogGz *z, uint64_t pos)
+{
+	size_t lo = 0;
+	size_t hi = z->index_count;
+
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+		if (z->index[mid].raw_pos <= pos) {
+			lo = mid + 1;
+		}
+		else {
+			hi = mid;
+		}
+	}
+	return lo - 1;
+}
+
+/**
+ *	ubN z.raw ɓWJ
+ */
+static BOOL InflateBlock(LogGzReader *r, size_t i)
+{
+	LogGz *z = &r->z;
+	const LogGzIndex *e = &z->index[i];
+	uint64_t file_end = (i + 1 < z->index_count) ? z->index[i + 1].file_pos : z->file_pos;
+	uint64_t raw_end = (i + 1 < z->index_count) ? z->index[i + 1].raw_pos : z->raw_pos;
+	DWORD member_size;
+	DWORD raw_len;
+
+	if (r->cache_block == i) {
+		return TRUE;
+	}
+	r->cache_block = (size_t)-1;
+	if (file_end < e->file_pos + BLOCK_HEADER_SIZE + GZ_FOOTER_SIZE || file_end - e->file_pos > z->out_size ||
+		raw_end < e->raw_pos || raw_end - e->raw_pos > LOG_GZ_BLOCK_SIZE) {
+		return FALSE;
+	}
+	member_size = (DWORD)(file_end - e->file_pos);
+	raw_len = (DWORD)(raw_end - e->raw_pos);
+	if (!ReadAt(z->FileHandle, e->file_pos, z->out, member_size)) {
+		return FALSE;
+	}
+
+	inflateReset(&r->zs);
+	r->zs.next_in = z->out + BLOCK_HEADER_SIZE;
+	r->zs.avail_in = member_size - BLOCK_HEADER_SIZE - GZ_FOOTER_SIZE;
+	r->zs.next_out = z->raw;
+	r->zs.avail_out = LOG_GZ_BLOCK_SIZE;
+	if (inflate(&r->zs, Z_FINISH) != Z_STREAM_END || r->zs.total_out != raw_len ||
+		Get32(z->out + member_size - GZ_FOOTER_SIZE) != (uint32_t)crc32(0, z->raw, raw_len)) {
+		return FALSE;
+	}
+	z->raw_len = raw_len;
+	r->cache_block = i;
+	return TRUE;
+}
+
+/**
+ *	WJ̈ʒu pos ǂݍ
+ *	KvȃubNWJ
+ *
+ *	@return	ǂݍ񂾃oCgAt@C̍Ō܂͉ĂubN len 菭ȂȂ
+ */
+DWORD LogGzReaderRead(LogGzReader *r, uint64_t pos, void *buf, DWORD len)
+{
+	const LogGz *z = &r->z;
+	BYTE *p = (BYTE *)buf;
+	DWORD read = 0;
+
+	while (read < len && pos < z->raw_pos) {
+		size_t i = FindBlock(z, pos);
+		DWORD offset;
+		DWORD n;
+		if (i == (size_t)-1 || !InflateBlock(r, i)) {
+			break;
+		}
+		offset = (DWORD)(pos - z->index[i].raw_pos);
+		if (offset >= z->raw_len) {
+			break;
+		}
+		n = z->raw_len - offset;
+		if (n > len - read) {
+			n = len - read;
+		}
+		memcpy(p + read, z->raw + offset, n);
+		read += n;
+		pos += n;
+	}
+	return read;
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2026- TeraTerm Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <windows.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ *	kO(ubNPʂgzip)
+ *
+ *	t@C gzip member(RFC 1952)ÂŁAgzip/zcat ł̂܂ܓWJł
+ *	lׂ͂ăgGfBA
+ *
+ *	f[^ubN
+ *		O LOG_GZ_BLOCK_SIZE byte ƁA܂̓ubN̍ŏ̃f[^ LOG_GZ_BLOCK_TIME bƂ
+ *		Ɨ gzip member Ƃ
+ *		MTIME	ubN̍ŏ̃f[^󂯎(UNIX)
+ *		FEXTRA	SI1='T' SI2='L' LEN=16
+ *			+0	uint32	member Ŝ̃oCg
+ *			+4	uint32	WJ̃oCg
+ *			+8	uint64	WJ̃t@C擪̈ʒu
+ *
+ *	CfbNX(t@CƂɏ)
+ *		 gzip member ɓ̂ŁAWJʂɂ͉eȂ
+ *		FEXTRA	SI1='T' SI2='I' LEN=20*n
+ *			Gg(20byte) n 
+ *			+0	uint64	f[^ubÑt@C̈ʒu
+ *			+8	uint64	WJ̃t@C擪̈ʒu
+ *			+16	uint32	MTIME Ɠ
+ *		GgƂ͕ member ɕ
+ *
+ *	gC(t@C̍Ō46byte)
+ *		 gzip member
+ *		FEXTRA	SI1='T' SI2='T' LEN=20
+ *			+0	uint64	ŏ̃CfbNX member ̃t@C̈ʒu
+ *			+8	uint64	WJ̃TCY
+ *			+16	uint32	f[^ubN
+ *
+ *	ŃV[NƂ́AgCCfbNXǂŖړĨubNWJ
+ *	ُIăgCȂƂAf[^ubN FEXTRA ǂ΃V[Nł
+ *	(LogGzReaderSeekTime(), LogGzReaderRead())
+ */
+#define LOG_GZ_BLOCK_SIZE	(256*1024)
+#define LOG_GZ_BLOCK_TIME	10		// b
+
+typedef struct LogGzTag LogGz;
+
+LogGz *LogGzOpen(HANDLE FileHandle);
+DWORD LogGzWrite(LogGz *z, const void *buf, DWORD len);
+DWORD LogGzIdle(LogGz *z);
+DWORD LogGzFlush(LogGz *z);
+DWORD LogGzClose(LogGz *z);
+
+typedef struct LogGzReaderTag LogGzReader;
+
+LogGzReader *LogGzReaderOpen(HANDLE FileHandle);
+void LogGzReaderClose(LogGzReader *r);
+uint64_t LogGzReaderSize(LogGzReader *r);
+uint64_t LogGzReaderSeekTime(LogGzReader *r, uint32_t time);
+DWORD LogGzReaderRead(LogGzReader *r, uint64_t pos, void *buf, DWORD len);
+
+#ifdef __cplusplus
+}
+#endif
@@ -151,9 +151,9 @@ void CFileTransDlg::ChangeButton(BOOL PauseFlag)
 	}
 }
 
-void CFileTransDlg::RefreshNum(DWORD StartTime, LONG FileSize, LONG ByteCount)
+void CFileTransDlg::RefreshNum(DWORD StartTime, LONG FileSize, LONG ByteCount, LONGLONG LostCount)
 {
-	char NumStr[24];
+	char NumStr[64];
 	double rate;
 	int rate2;
 	static DWORD prev_elapsed;
@@ -193,7 +193,13 @@ void CFileTransDlg::RefreshNum(DWORD StartTime, LONG FileSize, LONG ByteCount)
 		SetDlgItemText(IDC_TRANSBYTES, NumStr);
 	}
 	else {
-		_snprintf_s(NumStr,sizeof(NumStr),_TRUNCATE,"%u",ByteCount);
+		if (LostCount > 0) {
+			// ߂ɎꂽoCgΕL
+			_snprintf_s(NumStr,sizeof(NumStr),_TRUNCATE,"%u (lost %I64d)",ByteCount, LostCount);
+		}
+		else {
+			_snprintf_s(NumStr,sizeof(NumStr),_TRUNCATE,"%u",ByteCount);
+		}
 		SetDlgItemText(IDC_TRANSBYTES, NumStr);
 	}
 }
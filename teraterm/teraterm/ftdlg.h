@@ -57,7 +57,7 @@ public:
 
 	BOOL Create(HINSTANCE hInstance, Info *info);
 	void ChangeButton(BOOL PauseFlag);
-	void RefreshNum(DWORD StartTime, LONG FileSize, LONG ByteCount);
+	void RefreshNum(DWORD StartTime, LONG FileSize, LONG ByteCount, LONGLONG LostCount = 0);
 
 private:
 	virtual BOOL OnCancel();
@@ -47,12 +47,14 @@
 typedef int (CALLBACK *PSSH_start_scp)(char *, char *);
 typedef int (CALLBACK * PSSH_scp_sending_status)(void);
 typedef size_t (CALLBACK *PSSH_GetKnownHostsFileName)(wchar_t *, size_t);
+typedef int (CALLBACK *PSSH_sftp_command)(char *);
 
 static HMODULE h = NULL;
 static PSSH_start_scp start_scp = NULL;
 static PSSH_start_scp receive_file = NULL;
 static PSSH_scp_sending_status scp_sending_status = NULL;
 static PSSH_GetKnownHostsFileName GetKnownHostsFileName;
+static PSSH_sftp_command sftp_command = NULL;
 
 /**
  * @brief SCP֐̃AhX擾
@@ -158,6 +160,43 @@ BOOL ScpReceive(const wchar_t *remotefile, const wchar_t *localfile)
 	return r;
 }
 
+/**
+ *	ttxssh.dll  SFTP ̃R}hɑΉĂ邩
+ *	@retval	TRUE	ΉĂ
+ *	@retval	FALSE	ttxssh.dll A܂͌Â
+ */
+BOOL SftpIsSupported(void)
+{
+	if (sftp_command == NULL) {
+		if (h == NULL) {
+			h = GetModuleHandle("ttxssh.dll");
+		}
+		if (h != NULL) {
+			// Â ttxssh.dll ɂ͖̂ŁASCP Ƃ͕ʂɎ擾
+			sftp_command = (PSSH_sftp_command)GetProcAddress(h, "TTXSftpCommand");
+		}
+	}
+	return sftp_command != NULL;
+}
+
+/**
+ *	SFTP ̃R}hs
+ *	@param	cmdline	SFTP R\[ƓR}h ( L"get -r /fw c:\\fw")
+ *					SFTP ̃`lΊJĂs
+ *	@return TRUE	ok(NGXgł)
+ *	@return FALSE	ng
+ */
+BOOL SftpCommand(const wchar_t *cmdline)
+{
+	if (!SftpIsSupported()) {
+		return FALSE;
+	}
+	char *cmdlineU8 = ToU8W(cmdline);
+	BOOL r = (BOOL)sftp_command(cmdlineU8);
+	free(cmdlineU8);
+	return r;
+}
+
 /**
  *	knownhostt@C擾
  *	svɂȂfree()邱
@@ -36,6 +36,8 @@ BOOL ScpSend(const wchar_t *local, const wchar_t *remote);
 BOOL ScpGetStatus(void);
 BOOL ScpReceive(const wchar_t *remotefile, const wchar_t *localfile);
 BOOL TTXSSHGetKnownHostsFileName(wchar_t **filename);
+BOOL SftpIsSupported(void);
+BOOL SftpCommand(const wchar_t *cmdline);
 
 #ifdef __cplusplus
 }
@@ -397,7 +397,9 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPreInst,
 			const BOOL continue_idle = OnIdle(lCount++);
 			if (!continue_idle) {
 				// FALSE߂Ăidle͕sv
-				Sleep(2);
+				// MXbh̒ʒm(PostMessage)炷ł悤
+				// Sleep() ł͂ȂbZ[W҂
+				MsgWaitForMultipleObjects(0, NULL, FALSE, 2, QS_ALLINPUT);
 				lCount = 0;
 			}
 		}
@@ -0,0 +1,287 @@
+/*
+ * log_enc_test
+ *	filesys_log_enc.cpp: compare the bulk encoders with the per character
+ *	conversion in codeconv.cpp, and benchmark the text log encoding
+ *
+ *	usage: log_enc_test.exe [MB]   (characters to encode per benchmark, default 64M)
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <windows.h>
+
+#include "codeconv.h"
+#include "filesys_log_enc.h"
+
+static int errors;
+
+#define CHECK(cond) \
+	do { \
+		if (!(cond)) { \
+			printf("%s(%d): NG %s\n", __FILE__, __LINE__, #cond); \
+			errors++; \
+		} \
+	} while (0)
+
+static unsigned int rand_state = 1;
+
+static unsigned int Rand(void)
+{
+	rand_state = rand_state * 1103515245 + 12345;
+	return (rand_state >> 16) & 0x7fff;
+}
+
+/* random text: ASCII, LF, 2/3/4 byte UTF-8 characters */
+static void MakeText(unsigned int *u32, size_t len, int ascii_percent)
+{
+	size_t i;
+	for (i = 0; i < len; i++) {
+		unsigned int r = Rand() % 100;
+		if (r < 2) {
+			u32[i] = 0x0a;
+		}
+		else if (r < (unsigned int)ascii_percent) {
+			u32[i] = 0x20 + Rand() % 0x5f;
+		}
+		else if (r < 96) {
+			u32[i] = 0x3041 + Rand() % 0x5000;		// hiragana .. CJK
+		}
+		else if (r < 98) {
+			u32[i] = 0x80 + Rand() % 0x780;		// 2 byte
+		}
+		else {
+			u32[i] = 0x1f300 + Rand() % 0x300;		// emoji
+		}
+	}
+}
+
+static size_t RefFindLineEnd(const unsigned int *u32, size_t len)
+{
+	size_t i;
+	for (i = 0; i < len; i++) {
+		if (u32[i] == 0x0a) {
+			return i + 1;
+		}
+	}
+	return len;
+}
+
+/* per character conversion, as FLogPutUTF32() did */
+static size_t RefUTF8(const unsigned int *u32, size_t len, BYTE *out)
+{
+	size_t pos = 0;
+	size_t i;
+	for (i = 0; i < len; i++) {
+		pos += UTF32ToUTF8(u32[i], (char *)&out[pos], 4);
+	}
+	return pos;
+}
+
+static size_t RefUTF16(const unsigned int *u32, size_t len, BOOL be, BYTE *out)
+{
+	size_t pos = 0;
+	size_t i, k;
+	for (i = 0; i < len; i++) {
+		wchar_t u16[2];
+		size_t u16_len = UTF32ToUTF16(u32[i], u16, 2);
+		for (k = 0; k < u16_len; k++) {
+			out[pos++] = be ? (BYTE)(u16[k] >> 8) : (BYTE)u16[k];
+			out[pos++] = be ? (BYTE)u16[k] : (BYTE)(u16[k] >> 8);
+		}
+	}
+	return pos;
+}
+
+/* encode all with a buf_size output buffer, concatenate the chunks */
+static size_t Encode(int code, const unsigned int *u32, size_t len, size_t buf_size, BYTE *out)
+{
+	BYTE buf[1024];
+	size_t pos = 0;
+
+	while (len > 0) {
+		size_t n, out_len;
+		if (code == 0) {
+			n = LogEncUTF8(u32, len, buf, buf_size, &out_len);
+		}
+		else {
+			n = LogEncUTF16(u32, len, code == 2, buf, buf_size, &out_len);
+		}
+		CHECK(n > 0);
+		if (n == 0) {
+			break;
+		}
+		memcpy(&out[pos], buf, out_len);
+		pos += out_len;
+		u32 += n;
+		len -= n;
+	}
+	return pos;
+}
+
+static void TestFindLineEnd(void)
+{
+	unsigned int u32[80];
+	int loop;
+
+	for (loop = 0; loop < 100000; loop++) {
+		size_t len = Rand() % 70;
+		size_t i;
+		for (i = 0; i < len; i++) {
+			u32[i] = (Rand() % 8 == 0) ? 0x0a : (Rand() % 2 == 0 ? 0x0a0a0000 + Rand() : 0x0a00 + Rand() % 256);
+		}
+		CHECK(LogEncFindLineEnd(u32 + 1, len) == RefFindLineEnd(u32 + 1, len));
+	}
+}
+
+static void TestEncode(void)
+{
+	static unsigned int u32[1000];
+	static BYTE ref[4000], out[4000];
+	int loop;
+
+	for (loop = 0; loop < 20000; loop++) {
+		size_t len = Rand() % 1000;
+		size_t buf_size = 4 + Rand() % 40;
+		int code;
+		MakeText(u32, len, Rand() % 100);
+		if (loop % 2) {
+			buf_size = 1024;
+		}
+		for (code = 0; code < 3; code++) {
+			size_t ref_len = code == 0 ? RefUTF8(u32, len, ref) : RefUTF16(u32, len, code == 2, ref);
+			size_t out_len = Encode(code, u32, len, buf_size, out);
+			CHECK(ref_len == out_len && memcmp(ref, out, ref_len) == 0);
+		}
+	}
+}
+
+static double Now(void)
+{
+	LARGE_INTEGER freq, count;
+	QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&count);
+	return (double)count.QuadPart / (double)freq.QuadPart;
+}
+
+/* stands for LogPut1(), called for each byte */
+static BYTE *put_buf;
+static size_t put_pos;
+
+static void Put1(BYTE b)
+{
+	put_buf[put_pos++ & 0xffff] = b;
+}
+
+/* called through a pointer so that it is not inlined, like the real LogPut1() */
+static void (*volatile put1)(BYTE b) = Put1;
+
+/* stands for LogBufWrite() */
+static void PutBuf(const BYTE *data, size_t len)
+{
+	size_t ptr = put_pos & 0xffff;
+	if (ptr + len > 0x10000) {
+		ptr = 0;
+	}
+	memcpy(&put_buf[ptr], data, len);
+	put_pos += len;
+}
+
+static void Bench(size_t chars)
+{
+	static const struct {
+		const char *name;
+		int ascii_percent;
+	} text_list[] = {
+		{ "ascii", 100 },
+		{ "mixed", 60 },
+		{ "japanese", 5 },
+	};
+	const size_t block = 256;	// LOG_RUN_MAX
+	unsigned int *u32 = (unsigned int *)malloc(chars * sizeof(unsigned int));
+	size_t t, i;
+
+	put_buf = (BYTE *)malloc(0x10000);
+	if (u32 == NULL || put_buf == NULL) {
+		printf("no memory\n");
+		errors++;
+		return;
+	}
+	for (t = 0; t < sizeof(text_list) / sizeof(text_list[0]); t++) {
+		double t1, t2, t3;
+		MakeText(u32, chars, text_list[t].ascii_percent);
+
+		// per character: UTF32ToUTF8() and LogPut1() per byte
+		t1 = Now();
+		for (i = 0; i < chars; i++) {
+			char u8[4];
+			size_t n = UTF32ToUTF8(u32[i], u8, sizeof(u8));
+			size_t k;
+			for (k = 0; k < n; k++) {
+				put1((BYTE)u8[k]);
+			}
+		}
+		t1 = Now() - t1;
+
+		// runs: LogEncFindLineEnd(), LogEncUTF8() and LogBufWrite()
+		t2 = Now();
+		for (i = 0; i < chars; i += block) {
+			const unsigned int *p = u32 + i;
+			size_t len = chars - i < block ? chars - i : block;
+			while (len > 0) {
+				size_t line = LogEncFindLineEnd(p, len);
+				const unsigned int *q = p;
+				size_t rest = line;
+				while (rest > 0) {
+					BYTE buf[1024];
+					size_t out_len;
+					size_t n = LogEncUTF8(q, rest, buf, sizeof(buf), &out_len);
+					PutBuf(buf, out_len);
+					q += n;
+					rest -= n;
+				}
+				p += line;
+				len -= line;
+			}
+		}
+		t2 = Now() - t2;
+
+		// UTF-16LE runs
+		t3 = Now();
+		for (i = 0; i < chars; i += block) {
+			const unsigned int *p = u32 + i;
+			size_t len = chars - i < block ? chars - i : block;
+			while (len > 0) {
+				BYTE buf[1024];
+				size_t out_len;
+				size_t n = LogEncUTF16(p, len, FALSE, buf, sizeof(buf), &out_len);
+				PutBuf(buf, out_len);
+				p += n;
+				len -= n;
+			}
+		}
+		t3 = Now() - t3;
+
+		printf("%-10s per char %7.1f Mchar/s, UTF-8 run %7.1f Mchar/s, UTF-16 run %7.1f Mchar/s\n",
+			   text_list[t].name,
+			   (double)chars / 1e6 / t1, (double)chars / 1e6 / t2, (double)chars / 1e6 / t3);
+	}
+	free(u32);
+	free(put_buf);
+}
+
+int main(int argc, char *argv[])
+{
+	size_t mchars = 64;
+
+	if (argc > 1) {
+		mchars = (size_t)atoi(argv[1]);
+	}
+
+	TestFindLineEnd();
+	TestEncode();
+	printf("log_enc: %s\n", errors == 0 ? "OK" : "NG");
+
+	Bench(mchars * 1024 * 1024);
+
+	return errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,263 @@
+/*
+ * log_gz_test
+ *	filesys_log_gz.cpp: write/append/read round trip, recovery from a torn
+ *	file (crash while logging), time based block cut and seek by time
+ *
+ *	usage: log_gz_test.exe   (creates log_gz_test.gz in the current directory)
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <windows.h>
+
+#include "filesys_log_gz.h"
+
+#define LOG_FILE "log_gz_test.gz"
+
+static unsigned char *ref;		// data written so far
+static size_t ref_len;
+static int errors;
+
+#define CHECK(cond) \
+	do { \
+		if (!(cond)) { \
+			printf("%s(%d): NG %s\n", __FILE__, __LINE__, #cond); \
+			errors++; \
+		} \
+	} while (0)
+
+static unsigned int rand_state = 1;
+
+static unsigned int Rand(void)
+{
+	rand_state = rand_state * 1103515245 + 12345;
+	return (rand_state >> 16) & 0x7fff;
+}
+
+static HANDLE OpenWrite(BOOL truncate)
+{
+	return CreateFileA(LOG_FILE, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, NULL,
+					   truncate ? CREATE_ALWAYS : OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+}
+
+static uint64_t FileSize(HANDLE h)
+{
+	LARGE_INTEGER size;
+	GetFileSizeEx(h, &size);
+	return (uint64_t)size.QuadPart;
+}
+
+/* write len bytes of log like text, sometimes flush */
+static void WriteText(LogGz *z, size_t len, BOOL flush)
+{
+	static const char chars[] = "abcdefgh log line 0123";
+	char buf[4096];
+
+	ref = (unsigned char *)realloc(ref, ref_len + len);
+	while (len > 0) {
+		size_t n = Rand() % sizeof(buf) + 1;
+		size_t i;
+		if (n > len) {
+			n = len;
+		}
+		for (i = 0; i < n; i++) {
+			buf[i] = (Rand() % 40 == 0) ? '\n' : chars[Rand() % (sizeof(chars) - 1)];
+		}
+		CHECK(LogGzWrite(z, buf, (DWORD)n) == 0);
+		memcpy(ref + ref_len, buf, n);
+		ref_len += n;
+		len -= n;
+		if (flush && Rand() % 50 == 0) {
+			CHECK(LogGzFlush(z) == 0);
+		}
+	}
+}
+
+static void Session(size_t len, BOOL truncate, BOOL flush)
+{
+	HANDLE h = OpenWrite(truncate);
+	LogGz *z = LogGzOpen(h);
+	CHECK(z != NULL);
+	if (z != NULL) {
+		WriteText(z, len, flush);
+		CHECK(LogGzClose(z) == 0);
+	}
+	CloseHandle(h);
+}
+
+static LogGzReader *OpenRead(HANDLE *h)
+{
+	*h = CreateFileA(LOG_FILE, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL,
+					 OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	return LogGzReaderOpen(*h);
+}
+
+/* read the whole file sequentially and at random positions, compare with ref */
+static void Verify(const char *name)
+{
+	HANDLE h;
+	LogGzReader *r = OpenRead(&h);
+	unsigned char buf[5000];
+	uint64_t pos = 0;
+	int before = errors;
+	int i;
+
+	CHECK(r != NULL);
+	if (r == NULL) {
+		CloseHandle(h);
+		printf("%s: NG\n", name);
+		return;
+	}
+	CHECK(LogGzReaderSize(r) == ref_len);
+	while (pos < ref_len) {
+		DWORD read = LogGzReaderRead(r, pos, buf, Rand() % sizeof(buf) + 1);
+		if (read == 0 || memcmp(buf, ref + pos, read) != 0) {
+			CHECK(!"sequential read");
+			break;
+		}
+		pos += read;
+	}
+	for (i = 0; i < 200 && ref_len > 0; i++) {
+		DWORD len = Rand() % sizeof(buf) + 1;
+		DWORD read;
+		pos = (((uint64_t)Rand() << 15) | Rand()) % ref_len;
+		if (len > ref_len - pos) {
+			len = (DWORD)(ref_len - pos);
+		}
+		read = LogGzReaderRead(r, pos, buf, len);
+		if (read != len || memcmp(buf, ref + pos, read) != 0) {
+			CHECK(!"random read");
+			break;
+		}
+	}
+	CHECK(LogGzReaderRead(r, ref_len, buf, 1) == 0);
+	LogGzReaderClose(r);
+	CloseHandle(h);
+	printf("%s: %s\n", name, errors == before ? "OK" : "NG");
+}
+
+static void TestRoundTrip(void)
+{
+	Session(3 * 1024 * 1024, TRUE, TRUE);
+	Verify("write");
+	Session(1024 * 1024, FALSE, FALSE);
+	Verify("append");
+}
+
+/* a crash leaves no index/trailer and a half written block at the end */
+static void TestRecover(void)
+{
+	HANDLE h = OpenWrite(FALSE);
+	LogGz *z = LogGzOpen(h);
+	uint64_t complete_size;
+	size_t complete_len;
+	LARGE_INTEGER li;
+
+	CHECK(z != NULL);
+	if (z == NULL) {
+		CloseHandle(h);
+		return;
+	}
+	WriteText(z, 500 * 1024, FALSE);
+	CHECK(LogGzFlush(z) == 0);
+	complete_size = FileSize(h);
+	complete_len = ref_len;
+	WriteText(z, 100 * 1024, FALSE);
+	CHECK(LogGzClose(z) == 0);
+
+	li.QuadPart = (LONGLONG)(complete_size + 100);
+	SetFilePointerEx(h, li, NULL, FILE_BEGIN);
+	SetEndOfFile(h);
+	CloseHandle(h);
+	ref_len = complete_len;
+	Verify("recover(read)");
+
+	Session(500 * 1024, FALSE, TRUE);
+	Verify("recover(append)");
+}
+
+static void TestNotLog(void)
+{
+	HANDLE h = OpenWrite(TRUE);
+	DWORD wrote;
+	HANDLE rh;
+	LogGzReader *r;
+	int before = errors;
+
+	WriteFile(h, "plain text\r\n", 12, &wrote, NULL);
+	CHECK(LogGzOpen(h) == NULL);
+	CHECK(FileSize(h) == 12);
+	r = OpenRead(&rh);
+	CHECK(r == NULL);
+	CloseHandle(rh);
+	CloseHandle(h);
+	printf("not log: %s\n", errors == before ? "OK" : "NG");
+}
+
+/* an idle block is written after LOG_GZ_BLOCK_TIME even without flush */
+static void TestTime(void)
+{
+	HANDLE h = OpenWrite(TRUE);
+	LogGz *z = LogGzOpen(h);
+	HANDLE rh;
+	LogGzReader *r;
+	char buf[8];
+	uint32_t second;
+	int before = errors;
+
+	ref_len = 0;
+	CHECK(z != NULL);
+	if (z == NULL) {
+		CloseHandle(h);
+		return;
+	}
+	printf("time: wait %d sec\n", LOG_GZ_BLOCK_TIME + 1);
+	CHECK(LogGzWrite(z, "abc", 3) == 0);
+	Sleep((LOG_GZ_BLOCK_TIME + 1) * 1000);
+	CHECK(LogGzIdle(z) == 0);
+
+	// readable while the writer still has the file open
+	r = OpenRead(&rh);
+	CHECK(r != NULL);
+	if (r != NULL) {
+		CHECK(LogGzReaderSize(r) == 3);
+		CHECK(LogGzReaderRead(r, 0, buf, sizeof(buf)) == 3 && memcmp(buf, "abc", 3) == 0);
+		LogGzReaderClose(r);
+	}
+	CloseHandle(rh);
+
+	second = (uint32_t)time(NULL);
+	CHECK(LogGzWrite(z, "def", 3) == 0);
+	CHECK(LogGzClose(z) == 0);
+	CloseHandle(h);
+
+	r = OpenRead(&rh);
+	CHECK(r != NULL);
+	if (r != NULL) {
+		CHECK(LogGzReaderSeekTime(r, 0) == 0);
+		CHECK(LogGzReaderSeekTime(r, second - 1) == 0);
+		CHECK(LogGzReaderSeekTime(r, 0xffffffff) == 3);
+		CHECK(LogGzReaderRead(r, LogGzReaderSeekTime(r, 0xffffffff), buf, sizeof(buf)) == 3 &&
+			  memcmp(buf, "def", 3) == 0);
+		LogGzReaderClose(r);
+	}
+	CloseHandle(rh);
+	printf("time: %s\n", errors == before ? "OK" : "NG");
+}
+
+int main(int argc, char *argv[])
+{
+	(void)argc;
+	(void)argv;
+
+	TestRoundTrip();
+	TestRecover();
+	TestNotLog();
+	TestTime();
+
+	DeleteFileA(LOG_FILE);
+	free(ref);
+	printf("%s\n", errors == 0 ? "all OK" : "NG");
+	return errors == 0 ? 0 : 1;
+}
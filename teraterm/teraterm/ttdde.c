@@ -952,6 +952,22 @@ static HDDEDATA AcceptExecute(HSZ TopicHSz, HDDEDATA Data)
 		}
 		break;
 
+	case CmdSftpCmnd:
+		{
+			wchar_t *ParamFileNameW = ToWcharU8(ParamFileName);
+			BOOL r = SftpCommand(ParamFileNameW);
+			free(ParamFileNameW);
+			if (r == FALSE) {
+				// ]̃G[ SFTP R\[ƃOɏoĂ
+				if (!SftpIsSupported()) {
+					const char *msg = "ttxssh.dll not support sftp";
+					MessageBox(NULL, msg, "Tera Term: sftpcmd command error", MB_OK | MB_ICONERROR);
+				}
+				result = DDE_FNOTPROCESSED;
+			}
+		}
+		break;
+
 	case CmdScpRcv:
 		{
 			wchar_t *ParamFileNameW = ToWcharU8(ParamFileName);
@@ -201,14 +201,21 @@ static DWORD BeepOverUsedCount = 0;
 
 static _locale_t CLocale = NULL;
 
+// Oւ܂Ƃ߂ďo͂镶
+#define LOG_RUN_MAX	256
+
 typedef struct {
 	CheckEOLData_t *check_eol;
 	int log_cr_type;
+	unsigned int log_run[LOG_RUN_MAX];	// O֏o͂镶, VTParse() ̍Ō FLogPutUTF32Run() ŏo͂
+	size_t log_run_len;
 } vtterm_work_t;
 
 static CharSetData *charset_data;
 static vtterm_work_t vtterm_work;
 
+static void FlushLogRun(vtterm_work_t *vtterm);
+
 static void ClearParams(void)
 {
 	ICount = 0;
@@ -358,6 +365,7 @@ void ResetTerminal() /*reset variables but don't update screen */
 			CheckEOLClear(vtterm->check_eol);
 		}
 		vtterm->log_cr_type = 0;
+		FlushLogRun(vtterm);
 	}
 }
 
@@ -415,6 +423,28 @@ static void DDEPut1U32(unsigned int u32)
 	}
 }
 
+/**
+ *	߂ĂO֏o
+ */
+static void FlushLogRun(vtterm_work_t *vtterm)
+{
+	if (vtterm->log_run_len > 0) {
+		FLogPutUTF32Run(vtterm->log_run, vtterm->log_run_len);
+		vtterm->log_run_len = 0;
+	}
+}
+
+/**
+ *	O֏o͂镶߂
+ */
+static void PutLogRun(vtterm_work_t *vtterm, unsigned int u32)
+{
+	vtterm->log_run[vtterm->log_run_len++] = u32;
+	if (vtterm->log_run_len == LOG_RUN_MAX) {
+		FlushLogRun(vtterm);
+	}
+}
+
 /**
  *	O֐ݒ肳ꂽsR[ho
  */
@@ -423,16 +453,16 @@ static void OutputLogNewLine(vtterm_work_t *vtterm)
 	switch(vtterm->log_cr_type) {
 	case 0:
 		// CR + LF
-		FLogPutUTF32(CR);
-		FLogPutUTF32(LF);
+		PutLogRun(vtterm, CR);
+		PutLogRun(vtterm, LF);
 		break;
 	case 1:
 		// CR
-		FLogPutUTF32(CR);
+		PutLogRun(vtterm, CR);
 		break;
 	case 2:
 		// LF
-		FLogPutUTF32(LF);
+		PutLogRun(vtterm, LF);
 		break;
 	}
 }
@@ -464,7 +494,7 @@ static void OutputLogUTF32(unsigned int u32)
 
 		if ((r & CheckEOLOutputChar) != 0) {
 			// u32o
-			FLogPutUTF32(u32);
+			PutLogRun(vtterm, u32);
 		}
 	}
 
@@ -5325,6 +5355,50 @@ static int CommRead1Byte_(PComVar cv, LPBYTE b)
 	return CommRead1Byte(cv, b);
 }
 
+/**
+ *	Mobt@̕\̘A܂Ƃ߂ď
+ *	䕶ȂǂŎ~܂̂ŁAc͏]ǂ1byte
+ *	macroMobt@AOobt@ɗ]T镪
+ */
+static void ParseFirstSpan(void)
+{
+	const BYTE *ptr;
+	int len;
+	size_t done;
+
+	if (ParseMode != ModeFirst) {
+		return;
+	}
+
+	len = CommPeekSpan(&cv, &ptr);
+	if (len <= 0) {
+		return;
+	}
+	if (DDELog) {
+		int free_count = InBuffSize - 10 - DDEGetCount();
+		if (len > free_count) {
+			len = free_count;
+		}
+	}
+	if (FLogIsOpend()) {
+		// UTF-16o͂̂Ƃ 1byte ő 2byte ɂȂ
+		int free_count = (FLogGetFreeCount() - FILESYS_LOG_FREE_SPACE) / 2;
+		if (len > free_count) {
+			len = free_count;
+		}
+	}
+	if (len <= 0) {
+		return;
+	}
+
+	done = ParseFirstRun(charset_data, ptr, len);
+	if (done == 0) {
+		return;
+	}
+	PrevCharacter = ptr[done - 1];
+	CommSkipSpan(&cv, (int)done);
+}
+
 int VTParse()
 {
 	BYTE b;
@@ -5399,10 +5473,17 @@ int VTParse()
 			LastPutCharacter = 0;
 		}
 
-		if (ChangeEmu==0)
+		if (ChangeEmu==0) {
+#if !defined(DEBUG_DUMP_INPUTCODE)
+			ParseFirstSpan();
+#endif
 			c = CommRead1Byte_(&cv,&b);
+		}
 	}
 
+	// ߂ĂOo
+	FlushLogRun(&vtterm_work);
+
 	BuffUpdateScroll();
 
 	BuffSetCaretWidth();
@@ -1807,6 +1807,7 @@ void CVTWindow::OnDestroy()
 	EndDisp();
 	sendfiledlgUnInit();
 	FLogOpenDialogUnInit();
+	FLogRotateUnInit();
 
 	FreeBuffer();
 
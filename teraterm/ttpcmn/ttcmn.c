@@ -504,6 +504,9 @@ int WINAPI CommReadRawByte(PComVar cv, LPBYTE b)
 	if ( cv->InBuffCount>0 ) {
 		*b = cv->InBuff[cv->InPtr];
 		cv->InPtr++;
+		if ( cv->InPtr>=cv->InBuffLen ) {
+			cv->InPtr = 0;
+		}
 		cv->InBuffCount--;
 		if ( cv->InBuffCount==0 ) {
 			cv->InPtr = 0;
@@ -529,12 +532,16 @@ void WINAPI CommInsert1Byte(PComVar cv, BYTE b)
 		return;
 	}
 
-	if (cv->InPtr == 0) {
-		memmove(&(cv->InBuff[1]),&(cv->InBuff[0]),cv->InBuffCount);
+	if ( cv->InBuffCount>=cv->InBuffLen ) {
+		// ߂ꏊȂ(ǂݏoȂ̂Œʏ͋NȂ)
+		assert(FALSE);
+		return;
 	}
-	else {
-		cv->InPtr--;
+
+	if (cv->InPtr == 0) {
+		cv->InPtr = cv->InBuffLen;
 	}
+	cv->InPtr--;
 	cv->InBuff[cv->InPtr] = b;
 	cv->InBuffCount++;
 
@@ -601,6 +608,81 @@ int WINAPI CommRead1Byte(PComVar cv, LPBYTE b)
 	return c;
 }
 
+/**
+ *	Mobt@̘ÄԂ(ǂݏo͍sȂ)
+ *	CommRead1Byte() ϊȂŕԂoCg̕тԂ
+ *	telnet̏ԑJڂKvȃoCg(IAC, CR)̎OŎ~܂
+ *	Oobt@̏I[Ő܂Ԃꍇ͏I[܂łԂ
+ *	oCg CommSkipSpan() œǂݎ̂Ă邱
+ *
+ *	@param[out]	ptr		Ä̐擪
+ *	@return				Ä̃oCg
+ */
+int WINAPI CommPeekSpan(PComVar cv, const BYTE **ptr)
+{
+	const BYTE *p;
+	int len;
+	int i;
+	BOOL check_iac;
+	BOOL check_cr;
+
+	*ptr = NULL;
+	if ( ! cv->Ready || (cv->InBuffCount <= 0) ) {
+		return 0;
+	}
+	if ( cv->TelMode || cv->IACFlag || cv->TelCRFlag ) {
+		return 0;
+	}
+
+	p = &cv->InBuff[cv->InPtr];
+	len = cv->InBuffLen - cv->InPtr;
+	if (len > cv->InBuffCount) {
+		len = cv->InBuffCount;
+	}
+	check_iac = (cv->PortType==IdTCPIP);
+	check_cr = cv->TelFlag && ! cv->TelBinRecv;
+	for (i = 0; i < len; i++) {
+		if ((check_iac && p[i] == 0xFF) || (check_cr && p[i] == 0x0D)) {
+			break;
+		}
+	}
+
+	*ptr = p;
+	return i;
+}
+
+/**
+ *	CommPeekSpan() œ̈ǂݎ̂Ă
+ *
+ *	@param	len		ǂݎ̂ĂoCg
+ */
+void WINAPI CommSkipSpan(PComVar cv, int len)
+{
+	int i;
+
+	if ( ! cv->Ready || (len <= 0) ) {
+		return;
+	}
+	assert(len <= cv->InBuffCount);
+
+	if (cv->Log1Bin != NULL) {
+		const BYTE *p = &cv->InBuff[cv->InPtr];
+		for (i = 0; i < len; i++) {
+			cv->Log1Bin(p[i]);
+		}
+	}
+
+	assert(cv->InPtr + len <= cv->InBuffLen);
+	cv->InPtr += len;
+	if ( cv->InPtr>=cv->InBuffLen ) {
+		cv->InPtr = 0;
+	}
+	cv->InBuffCount -= len;
+	if ( cv->InBuffCount==0 ) {
+		cv->InPtr = 0;
+	}
+}
+
 int WINAPI CommRawOut(PComVar cv, /*const*/ PCHAR B, int C)
 {
 	int a;
@@ -718,31 +800,31 @@ static BOOL WriteOutBuff(PComVar cv, const char *TempStr, int TempLen)
 static BOOL WriteInBuff(PComVar cv, const char *TempStr, int TempLen)
 {
 	BOOL Full;
+	int WritePtr;
+	int len;
 
 	if (TempLen == 0) {
 		return TRUE;
 	}
 
-	Full = InBuffSize-cv->InBuffCount-TempLen < 0;
+	Full = cv->InBuffLen-cv->InBuffCount-TempLen < 0;
 	if (! Full) {
-		memcpy(&(cv->InBuff[cv->InBuffCount]),TempStr,TempLen);
+		// Oobt@̏I[Ő܂Ԃď
+		WritePtr = (cv->InPtr + cv->InBuffCount) % cv->InBuffLen;
+		len = cv->InBuffLen - WritePtr;
+		if (len > TempLen) {
+			len = TempLen;
+		}
+		memcpy(&(cv->InBuff[WritePtr]),TempStr,len);
+		if (len < TempLen) {
+			memcpy(&(cv->InBuff[0]),TempStr+len,TempLen-len);
+		}
 		cv->InBuffCount = cv->InBuffCount + TempLen;
 		return TRUE;
 	}
 	return FALSE;
 }
 
-/**
- *	̓obt@̐擪ɋ󂫂l߂
- */
-static void PackInBuff(PComVar cv)
-{
-	if ( (cv->InPtr>0) && (cv->InBuffCount>0) ) {
-		memmove(cv->InBuff,&(cv->InBuff[cv->InPtr]),cv->InBuffCount);
-		cv->InPtr = 0;
-	}
-}
-
 int WINAPI CommBinaryBuffOut(PComVar cv, PCHAR B, int C)
 {
 	int a, i, Len;
@@ -944,8 +1026,6 @@ int WINAPI CommBinaryEcho(PComVar cv, PCHAR B, int C)
 	if ( ! cv->Ready )
 		return C;
 
-	PackInBuff(cv);
-
 	i = 0;
 	a = 1;
 	while ((a>0) && (i<C)) {
@@ -36,7 +36,9 @@ extern "C" {
 #endif
 
 WORD UpdateCRC(BYTE b, WORD CRC);
+WORD UpdateCRCBuf(const BYTE *buf, size_t len, WORD CRC);
 LONG UpdateCRC32(BYTE b, LONG CRC);
+LONG UpdateCRC32Buf(const BYTE *buf, size_t len, LONG CRC);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,179 @@
+/*
+ * crc_test
+ *	ftlib.c: check values, buffer functions against the bitwise
+ *	definition, and throughput of bitwise / per byte table / slicing-by-8
+ *
+ *	usage: crc_test.exe [MB]   (benchmark size, default 256)
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <windows.h>
+
+#include "ftlib.h"
+
+static int errors;
+
+#define CHECK(cond) \
+	do { \
+		if (!(cond)) { \
+			printf("%s(%d): NG %s\n", __FILE__, __LINE__, #cond); \
+			errors++; \
+		} \
+	} while (0)
+
+/* the old bit by bit implementation */
+static WORD BitCRC16(const BYTE *buf, size_t len, WORD CRC)
+{
+	size_t n;
+	int i;
+	for (n = 0; n < len; n++) {
+		CRC ^= (WORD)(buf[n] << 8);
+		for (i = 0; i < 8; i++) {
+			CRC = (CRC & 0x8000) ? (WORD)((CRC << 1) ^ 0x1021) : (WORD)(CRC << 1);
+		}
+	}
+	return CRC;
+}
+
+static LONG BitCRC32(const BYTE *buf, size_t len, LONG CRC)
+{
+	DWORD crc = (DWORD)CRC;
+	size_t n;
+	int i;
+	for (n = 0; n < len; n++) {
+		crc ^= buf[n];
+		for (i = 0; i < 8; i++) {
+			crc = (crc & 1) ? ((crc >> 1) ^ 0xedb88320) : (crc >> 1);
+		}
+	}
+	return (LONG)crc;
+}
+
+static WORD ByteCRC16(const BYTE *buf, size_t len, WORD CRC)
+{
+	size_t n;
+	for (n = 0; n < len; n++) {
+		CRC = UpdateCRC(buf[n], CRC);
+	}
+	return CRC;
+}
+
+static LONG ByteCRC32(const BYTE *buf, size_t len, LONG CRC)
+{
+	size_t n;
+	for (n = 0; n < len; n++) {
+		CRC = UpdateCRC32(buf[n], CRC);
+	}
+	return CRC;
+}
+
+static void TestCheckValue(void)
+{
+	const BYTE *check = (const BYTE *)"123456789";
+
+	// CRC-16/XMODEM and CRC-32/ISO-HDLC check values
+	CHECK(UpdateCRCBuf(check, 9, 0) == 0x31c3);
+	CHECK(ByteCRC16(check, 9, 0) == 0x31c3);
+	CHECK((DWORD)~UpdateCRC32Buf(check, 9, (LONG)0xffffffff) == 0xcbf43926);
+	CHECK((DWORD)~ByteCRC32(check, 9, (LONG)0xffffffff) == 0xcbf43926);
+}
+
+/* every length and alignment up to 64 bytes, and chained calls */
+static void TestCompare(void)
+{
+	BYTE buf[64 + 8];
+	size_t i, off, len;
+
+	srand(1);
+	for (i = 0; i < sizeof(buf); i++) {
+		buf[i] = (BYTE)rand();
+	}
+	for (off = 0; off < 8; off++) {
+		for (len = 0; len <= 64; len++) {
+			const BYTE *p = buf + off;
+			WORD crc16 = BitCRC16(p, len, 0x1234);
+			LONG crc32 = BitCRC32(p, len, (LONG)0xffffffff);
+			CHECK(UpdateCRCBuf(p, len, 0x1234) == crc16);
+			CHECK(ByteCRC16(p, len, 0x1234) == crc16);
+			CHECK(UpdateCRC32Buf(p, len, (LONG)0xffffffff) == crc32);
+			CHECK(ByteCRC32(p, len, (LONG)0xffffffff) == crc32);
+			CHECK(UpdateCRCBuf(p + len / 3, len - len / 3, UpdateCRCBuf(p, len / 3, 0x1234)) == crc16);
+			CHECK(UpdateCRC32Buf(p + len / 3, len - len / 3, UpdateCRC32Buf(p, len / 3, (LONG)0xffffffff)) == crc32);
+		}
+	}
+}
+
+static double Now(void)
+{
+	LARGE_INTEGER freq, count;
+	QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&count);
+	return (double)count.QuadPart / (double)freq.QuadPart;
+}
+
+static const struct {
+	const char *name;
+	int kind;
+} bench_list[] = {
+	{ "CRC16 bitwise", 0 },
+	{ "CRC16 UpdateCRC", 1 },
+	{ "CRC16 UpdateCRCBuf", 2 },
+	{ "CRC32 bitwise", 3 },
+	{ "CRC32 UpdateCRC32", 4 },
+	{ "CRC32 UpdateCRC32Buf", 5 },
+};
+
+/* ZMODEM data subpackets are at most 1024 bytes, call the functions per packet */
+static void Bench(size_t size)
+{
+	const size_t packet = 1024;
+	BYTE *buf = (BYTE *)malloc(size);
+	size_t i, k;
+
+	if (buf == NULL) {
+		printf("no memory\n");
+		errors++;
+		return;
+	}
+	for (i = 0; i < size; i++) {
+		buf[i] = (BYTE)(i * 7 + (i >> 10));
+	}
+	for (k = 0; k < sizeof(bench_list) / sizeof(bench_list[0]); k++) {
+		LONG c = 0;
+		volatile LONG r;
+		double t = Now();
+		for (i = 0; i + packet <= size; i += packet) {
+			switch (bench_list[k].kind) {
+			case 0: c ^= BitCRC16(buf + i, packet, 0); break;
+			case 1: c ^= ByteCRC16(buf + i, packet, 0); break;
+			case 2: c ^= UpdateCRCBuf(buf + i, packet, 0); break;
+			case 3: c ^= BitCRC32(buf + i, packet, (LONG)0xffffffff); break;
+			case 4: c ^= ByteCRC32(buf + i, packet, (LONG)0xffffffff); break;
+			case 5: c ^= UpdateCRC32Buf(buf + i, packet, (LONG)0xffffffff); break;
+			}
+		}
+		t = Now() - t;
+		r = c;  // keep the result
+		(void)r;
+		printf("%-24s %8.1f MB/s\n", bench_list[k].name, (double)size / (1024 * 1024) / t);
+	}
+	free(buf);
+}
+
+int main(int argc, char *argv[])
+{
+	size_t mb = 256;
+
+	if (argc > 1) {
+		mb = (size_t)atoi(argv[1]);
+	}
+
+	TestCheckValue();
+	TestCompare();
+	printf("crc: %s\n", errors == 0 ? "OK" : "NG");
+
+	Bench(mb * 1024 * 1024);
+
+	return errors == 0 ? 0 : 1;
+}
@@ -226,10 +226,7 @@ static WORD XCalcCheck(PXVar xv, const BYTE *PktBuf)
 			Check = Check + (BYTE) (PktBuf[3 + i]);
 		return (Check & 0xff);
 	} else {					/* CRC */
-		Check = 0;
-		for (i = 0; i <= xv->DataLen - 1; i++)
-			Check = UpdateCRC(PktBuf[3 + i], Check);
-		return (Check);
+		return UpdateCRCBuf(&PktBuf[3], xv->DataLen, 0);
 	}
 }
 
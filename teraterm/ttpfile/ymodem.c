@@ -276,10 +276,7 @@ static WORD YCalcCheck(PYVar yv, const PCHAR PktBuf, const WORD len)
 	else
 	{
 		// CRC.
-		Check = 0;
-		for (i = 0 ; i <= len - 1 ; i++)
-			Check = UpdateCRC(PktBuf[3 + i],Check);
-		return (Check);
+		return UpdateCRCBuf((const BYTE *)&PktBuf[3], len, 0);
 	}
 }
 
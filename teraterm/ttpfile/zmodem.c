@@ -329,11 +329,10 @@ static void ZShHdr(PZVar zv, BYTE HdrType)
 	zv->PktOut[3] = ZHEX;
 	zv->PktOutCount = 4;
 	ZPutHex(zv, &(zv->PktOutCount), HdrType);
-	zv->CRC = UpdateCRC(HdrType, 0);
 	for (i = 0; i <= 3; i++) {
 		ZPutHex(zv, &(zv->PktOutCount), zv->TxHdr[i]);
-		zv->CRC = UpdateCRC(zv->TxHdr[i], zv->CRC);
 	}
+	zv->CRC = UpdateCRCBuf(zv->TxHdr, 4, UpdateCRC(HdrType, 0));
 	ZPutHex(zv, &(zv->PktOutCount), HIBYTE(zv->CRC));
 	ZPutHex(zv, &(zv->PktOutCount), LOBYTE(zv->CRC));
 	zv->PktOut[zv->PktOutCount] = 0x8D;
@@ -419,11 +418,10 @@ static void ZSbHdr(PZVar zv, BYTE HdrType)
 	zv->PktOut[2] = ZBIN;
 	zv->PktOutCount = 3;
 	ZPutBin(zv, &(zv->PktOutCount), HdrType);
-	zv->CRC = UpdateCRC(HdrType, 0);
 	for (i = 0; i <= 3; i++) {
 		ZPutBin(zv, &(zv->PktOutCount), zv->TxHdr[i]);
-		zv->CRC = UpdateCRC(zv->TxHdr[i], zv->CRC);
 	}
+	zv->CRC = UpdateCRCBuf(zv->TxHdr, 4, UpdateCRC(HdrType, 0));
 	ZPutBin(zv, &(zv->PktOutCount), HIBYTE(zv->CRC));
 	ZPutBin(zv, &(zv->PktOutCount), LOBYTE(zv->CRC));
 
@@ -563,7 +561,7 @@ static void ZSendFileHdr(PZVar zv)
 
 static void ZSendFileDat(PFileVarProto fv, PZVar zv)
 {
-	int i, j;
+	int j;
 	TFileIO *file = fv->file;
 	char *filename;
 
@@ -577,9 +575,7 @@ static void ZSendFileDat(PFileVarProto fv, PZVar zv)
 	filename = file->GetSendFilename(file, zv->FullName, FALSE, TRUE, FALSE);
 	strncpy_s(zv->PktOut, sizeof(zv->PktOut), filename, _TRUNCATE);
 	zv->PktOutCount = strlen(zv->PktOut);
-	zv->CRC = 0;
-	for (i = 0; i <= zv->PktOutCount - 1; i++)
-		zv->CRC = UpdateCRC(zv->PktOut[i], zv->CRC);
+	zv->CRC = UpdateCRCBuf(zv->PktOut, zv->PktOutCount, 0);
 	ZPutBin(zv, &(zv->PktOutCount), 0);
 	zv->CRC = UpdateCRC(0, zv->CRC);
 	/* file size */
@@ -593,11 +589,9 @@ static void ZSendFileDat(PFileVarProto fv, PZVar zv)
 				sizeof(zv->PktOut) - zv->PktOutCount, _TRUNCATE,
 				"%lu %lo %o", zv->FileSize, zv->FileMtime,
 				0644 | _S_IFREG);
-	j = strlen(&(zv->PktOut[zv->PktOutCount])) - 1;
-	for (i = 0; i <= j; i++) {
-		zv->CRC = UpdateCRC(zv->PktOut[zv->PktOutCount], zv->CRC);
-		zv->PktOutCount++;
-	}
+	j = strlen(&(zv->PktOut[zv->PktOutCount]));
+	zv->CRC = UpdateCRCBuf(&(zv->PktOut[zv->PktOutCount]), j, zv->CRC);
+	zv->PktOutCount += j;
 
 	ZPutBin(zv, &(zv->PktOutCount), 0);
 	zv->CRC = UpdateCRC(0, zv->CRC);
@@ -817,18 +811,13 @@ static void ZTimeOutProc(PFileVarProto fv, PComVar cv)
 
 static BOOL ZCheckHdr(PFileVarProto fv, PZVar zv)
 {
-	int i;
 	BOOL Ok;
 
 	if (zv->CRC32) {
-		zv->CRC3 = 0xFFFFFFFF;
-		for (i = 0; i <= 8; i++)
-			zv->CRC3 = UpdateCRC32(zv->PktIn[i], zv->CRC3);
+		zv->CRC3 = UpdateCRC32Buf(zv->PktIn, 9, 0xFFFFFFFF);
 		Ok = zv->CRC3 == 0xDEBB20E3;
 	} else {
-		zv->CRC = 0;
-		for (i = 0; i <= 6; i++)
-			zv->CRC = UpdateCRC(zv->PktIn[i], zv->CRC);
+		zv->CRC = UpdateCRCBuf(zv->PktIn, 7, 0);
 		Ok = zv->CRC == 0;
 	}
 
@@ -4652,7 +4652,6 @@ exit1:
 	onig_region_free(region, 1);
 exit2:
 	onig_free(reg);
-	onig_end();
 
 	return Err;
 }
@@ -5848,6 +5847,26 @@ static WORD TTLScpRecv(void)
 	return SendCmnd(CmdScpRcv, 0);
 }
 
+// SYNOPSIS:
+//   sftpcmd "put -a c:\fw\image.bin /tmp/"
+//   sftpcmd "get -r /var/log c:\log"
+static WORD TTLSftpCmnd(void)
+{
+	TStrVal Str;
+	WORD Err;
+
+	Err = 0;
+	GetStrVal(Str,&Err);
+
+	if ((Err==0) &&
+	    ((strlen(Str)==0) || (GetFirstChar()!=0)))
+		Err = ErrSyntax;
+	if (Err!=0) return Err;
+
+	SetFile(Str);
+	return SendCmnd(CmdSftpCmnd, 0);
+}
+
 #if defined(OUTPUTDEBUGSTRING_ENABLE)
 static WORD TTLOutputDebugstring(void)
 {
@@ -6225,6 +6244,8 @@ static int ExecCmnd(void)
 			Err = TTLScpSend(); break;      // add 'scpsend' (2008.1.1 yutaka)
 		case RsvScpRecv:
 			Err = TTLScpRecv(); break;      // add 'scprecv' (2008.1.4 yutaka)
+		case RsvSftpCmnd:
+			Err = TTLSftpCmnd(); break;
 		case RsvSend:
 			Err = TTLSend(); break;
 		case RsvSendText:
@@ -201,22 +201,25 @@ const char *GetMacroFileName(void)
 // ݎs̃}Nt@C̍sԍԂ (2005.7.18 yutaka)
 static int getCurrentLineNumber(BINT curpos, BINT *lineno, BINT linenomax)
 {
-	BINT i, no;
-
-	no = 0;
-	for (i = 0 ; i < linenomax ; i++) {
-		if (curpos < lineno[i]) {
-			no = i;
-			break;
+	BINT lo, hi, mid;
+
+	// curpos < lineno[i] ƂȂŏ i 񕪒T
+	lo = 0;
+	hi = linenomax;
+	while (lo < hi) {
+		mid = lo + (hi - lo) / 2;
+		if (curpos < lineno[mid]) {
+			hi = mid;
+		}
+		else {
+			lo = mid + 1;
 		}
 	}
+	// Ȃ΍Ō̍s (linenomax) ɂȂ
 	// Ō̍sp[XہAsԍԂĂȂCB
 	// (2014.7.6 yutaka)
-	if (no == 0 && i == linenomax) {
-		no = linenomax;
-	}
 
-	return (no);
+	return (int)(lo);
 }
 
 
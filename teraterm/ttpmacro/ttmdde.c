@@ -98,7 +98,13 @@ static int RBufCount = 0;
   // for 'Wait' command
 static PCHAR PWaitStr[10];
 static int WaitStrLen[10];
-static int WaitCount[10];
+  // PWaitStr[] I[g}g (Aho-Corasick)
+  // Jڕ\͏Ԑ x 256 DFAɂĂ̂ŁA1oCgɂ1̎QƂōς
+static WORD *WaitNext = NULL;	// [ * 256 + MoCg] -> ̏
+static WORD *WaitOutput = NULL;	// [] -> vp^[ (bit i  PWaitStr[i])
+static BOOL WaitDirty = TRUE;	// PWaitStr[] ύXꂽ̂ō蒼Kv
+static WORD WaitState = 0;
+static WORD Wait4allState[MAXNWIN];
   // for "WaitRecv" command
 static TStrVal Wait2SubStr;
 static int Wait2Count, Wait2Len;
@@ -114,6 +120,55 @@ static BOOL RecvLnClear = TRUE;
 // regex action flag
 enum regex_type RegexActionType;
 
+// RpCς݂̐K\
+// waitregex Ȃǂł͉sƂɃp^[}b`ŝŁARpCȂ悤ێĂ
+typedef struct {
+	regex_t *reg;
+	char *pattern;
+	int pattern_len;
+	OnigOptionType option;
+	OnigEncoding enc;
+	OnigSyntaxType *syntax;
+} RegexCache;
+
+static RegexCache WaitRegex[10];	// waitregex p (PWaitStr[] ɑΉ)
+static RegexCache StrRegex;			// strmatch, strreplace p
+static OnigRegion *RegexRegion = NULL;
+
+static void RegexCacheClear(RegexCache *c)
+{
+	if (c->reg != NULL) {
+		onig_free(c->reg);
+		c->reg = NULL;
+	}
+	free(c->pattern);
+	c->pattern = NULL;
+	c->pattern_len = 0;
+}
+
+static void RegexCacheFreeAll(void)
+{
+	int i;
+
+	for (i = 0; i < 10; i++) {
+		RegexCacheClear(&WaitRegex[i]);
+	}
+	RegexCacheClear(&StrRegex);
+	if (RegexRegion != NULL) {
+		onig_region_free(RegexRegion, 1 /* 1:free self, 0:free contents only */);
+		RegexRegion = NULL;
+	}
+	onig_end();
+}
+
+static void FreeWaitMachine(void)
+{
+	free(WaitNext);
+	WaitNext = NULL;
+	free(WaitOutput);
+	WaitOutput = NULL;
+}
+
 // for wait4all
 BOOL Wait4allGotIndex = FALSE;
 int Wait4allFoundNum = 0;
@@ -267,8 +322,8 @@ BOOL InitDDE(HWND HWin)
 	for (i = 0 ; i<=9 ; i++) {
 		PWaitStr[i] = NULL;
 		WaitStrLen[i] = 0;
-		WaitCount[i] = 0;
 	}
+	WaitDirty = TRUE;
 
 	if (DdeInitialize(&Inst, DdeCallbackProc,
 	                  APPCMD_CLIENTONLY |
@@ -316,6 +371,10 @@ void EndDDE()
 {
 	DWORD Temp;
 
+	RegexCacheFreeAll();
+	FreeWaitMachine();
+	WaitDirty = TRUE;
+
 	Linked = FALSE;
 	SyncMode = FALSE;
 
@@ -506,8 +565,8 @@ void ClearWait()
 		}
 		PWaitStr[i] = NULL;
 		WaitStrLen[i] = 0;
-		WaitCount[i] = 0;
 	}
+	WaitDirty = TRUE;
 
 	RegexActionType = REGEX_NONE; // regex disabled
 }
@@ -524,7 +583,117 @@ void SetWait(int Index, const char *Str)
 	else
 		WaitStrLen[Index-1] = 0;
 
-	WaitCount[Index-1] = 0;
+	WaitDirty = TRUE;
+}
+
+// PWaitStr[] I[g}g
+//   gCADŎsJڂHđSĂ̑Jڂ𖄂߂
+static BOOL BuildWaitMachine(void)
+{
+	int i, j, c;
+	int num, head, tail;
+	WORD s, t, f;
+	WORD *fail;
+	WORD *queue;
+
+	FreeWaitMachine();
+	WaitState = 0;
+	memset(Wait4allState, 0, sizeof(Wait4allState));
+
+	num = 1;
+	for (i = 0; i < 10; i++) {
+		if (PWaitStr[i] != NULL) {
+			num += WaitStrLen[i];
+		}
+	}
+
+	WaitNext = calloc((size_t)num * 256, sizeof(WORD));
+	WaitOutput = calloc(num, sizeof(WORD));
+	fail = calloc(num, sizeof(WORD));
+	queue = malloc(num * sizeof(WORD));
+	if (WaitNext == NULL || WaitOutput == NULL || fail == NULL || queue == NULL) {
+		FreeWaitMachine();
+		free(fail);
+		free(queue);
+		return FALSE;
+	}
+
+	// gC (Jڐ0́uȂvB֖߂Jڂ̓gCɂ͖)
+	num = 1;
+	for (i = 0; i < 10; i++) {
+		const BYTE *Str = (const BYTE *)PWaitStr[i];
+		if (Str == NULL) {
+			continue;
+		}
+		s = 0;
+		for (j = 0; j < WaitStrLen[i]; j++) {
+			t = WaitNext[s * 256 + Str[j]];
+			if (t == 0) {
+				t = (WORD)num++;
+				WaitNext[s * 256 + Str[j]] = t;
+			}
+			s = t;
+		}
+		WaitOutput[s] |= (WORD)(1 << i);
+	}
+
+	// sJ
+	head = tail = 0;
+	for (c = 0; c < 256; c++) {
+		t = WaitNext[c];
+		if (t != 0) {
+			fail[t] = 0;
+			queue[tail++] = t;
+		}
+	}
+	while (head < tail) {
+		s = queue[head++];
+		f = fail[s];
+		WaitOutput[s] |= WaitOutput[f];
+		for (c = 0; c < 256; c++) {
+			t = WaitNext[s * 256 + c];
+			if (t != 0) {
+				fail[t] = WaitNext[f * 256 + c];
+				queue[tail++] = t;
+			}
+			else {
+				WaitNext[s * 256 + c] = WaitNext[f * 256 + c];
+			}
+		}
+	}
+
+	free(fail);
+	free(queue);
+	return TRUE;
+}
+
+// 1oCgi߂
+//   return vp^[̔ԍ(1-10), vȂ0
+//   ɈvƂ͔ԍ̏
+static int StepWaitMachine(WORD *state, BYTE b)
+{
+	WORD out;
+	int i;
+
+	*state = WaitNext[*state * 256 + b];
+	out = WaitOutput[*state];
+	if (out == 0) {
+		return 0;
+	}
+	for (i = 0; (out & (1 << i)) == 0; i++)
+		;
+	return i + 1;
+}
+
+static BOOL PrepareWaitMachine(void)
+{
+	if (WaitDirty) {
+		if (!BuildWaitMachine()) {
+			return FALSE;
+		}
+		WaitDirty = FALSE;
+	}
+	return WaitNext != NULL;
 }
 
 void SetRecvLnClear(BOOL v)
@@ -587,34 +756,66 @@ void SetWait2(PCHAR Str, int Len, int Pos)
 }
 
 
-// K\ɂp^[}b`siOnigurumagpj
-//
-// return : }b`ʒui1IWj
-//         0: }b`Ȃ
-int FindRegexStringOne(char *regex, int regex_len, char *target, int target_len)
+// K\̃RpCʂp^[ƃIvVL[ɂĕێ
+static regex_t *RegexCacheGet(RegexCache *c, const char *regex, int regex_len)
 {
 	int r;
-	unsigned char *start, *range, *end;
-	regex_t* reg;
 	OnigErrorInfo einfo;
-	OnigRegion *region;
 	UChar* pattern = (UChar* )regex;
-	UChar* str     = (UChar* )target;
-	int matched = 0;
-	char ch;
-	int mstart, mend;
 
+	if (c->pattern != NULL && c->pattern_len == regex_len &&
+	    memcmp(c->pattern, regex, regex_len) == 0 &&
+	    c->option == RegexOpt && c->enc == RegexEnc && c->syntax == RegexSyntax) {
+		// RpCG[ɂȂp^[ NULL ̂܂
+		return c->reg;
+	}
+
+	RegexCacheClear(c);
+	c->pattern = malloc(regex_len + 1);
+	if (c->pattern == NULL) {
+		return NULL;
+	}
+	memcpy(c->pattern, regex, regex_len);
+	c->pattern[regex_len] = 0;
+	c->pattern_len = regex_len;
+	c->option = RegexOpt;
+	c->enc = RegexEnc;
+	c->syntax = RegexSyntax;
 
-	r = onig_new(&reg, pattern, pattern + regex_len,
+	r = onig_new(&c->reg, pattern, pattern + regex_len,
 		RegexOpt, RegexEnc, RegexSyntax, &einfo);
 	if (r != ONIG_NORMAL) {
 		char s[ONIG_MAX_ERROR_MESSAGE_LEN];
 		onig_error_code_to_str(s, r, &einfo);
 		fprintf(stderr, "ERROR: %s\n", s);
-		return -1;
+		c->reg = NULL;
+		return NULL;
 	}
 
-	region = onig_region_new();
+	return c->reg;
+}
+
+// RpCς݂̐K\Ńp^[}b`s
+//
+// return : }b`ʒui1IWj
+//         0: }b`Ȃ
+static int RegexSearch(regex_t *reg, char *target, int target_len)
+{
+	int r;
+	unsigned char *start, *range, *end;
+	OnigRegion *region;
+	UChar* str     = (UChar* )target;
+	int matched = 0;
+	char ch;
+	int mstart, mend;
+
+	if (RegexRegion == NULL) {
+		RegexRegion = onig_region_new();
+		if (RegexRegion == NULL) {
+			return -1;
+		}
+	}
+	region = RegexRegion;
 
 	end   = str + target_len;
 	start = str;
@@ -667,17 +868,29 @@ int FindRegexStringOne(char *regex, int regex_len, char *target, int target_len)
 		return -1;
 	}
 
-	onig_region_free(region, 1 /* 1:free self, 0:free contents only */);
-	onig_free(reg);
-	onig_end();
-
 	return (matched);
 }
 
+// K\ɂp^[}b`siOnigurumagpj
+//
+// return : }b`ʒui1IWj
+//         0: }b`Ȃ
+int FindRegexStringOne(char *regex, int regex_len, char *target, int target_len)
+{
+	regex_t* reg;
+
+	reg = RegexCacheGet(&StrRegex, regex, regex_len);
+	if (reg == NULL) {
+		return -1;
+	}
+	return RegexSearch(reg, target, target_len);
+}
+
 // K\ɂp^[}b`s
 int FindRegexString(void)
 {
 	int i;
+	regex_t* reg;
 
 	if (RegexActionType == REGEX_NONE)
 		return 0;  // not match
@@ -686,7 +899,10 @@ int FindRegexString(void)
 		return 0;  // not match
 
 	for (i = 0 ; i < 10 ; i++) {
-		if (PWaitStr[i] && FindRegexStringOne(PWaitStr[i], WaitStrLen[i], RecvLnBuff, RecvLnPtr) > 0) { // matched
+		if (PWaitStr[i] == NULL)
+			continue;
+		reg = RegexCacheGet(&WaitRegex[i], PWaitStr[i], WaitStrLen[i]);
+		if (reg != NULL && RegexSearch(reg, RecvLnBuff, RecvLnPtr) > 0) { // matched
 			// }b`s inputstr ֊i[
 			LockVar();
 			SetInputStr(GetRecvLnBuff());  // Ńobt@NA
@@ -699,7 +915,6 @@ int FindRegexString(void)
 	return 0;
 }
 
-
 // 'wait':
 // ttmacro process sleeps to wait specified word(s).
 //
@@ -710,8 +925,10 @@ int FindRegexString(void)
 int Wait()
 {
 	BYTE b;
-	int i, j, Found, ret;
-	PCHAR Str;
+	int Found, ret;
+	BOOL Machine;
+
+	Machine = (RegexActionType == REGEX_NONE) && PrepareWaitMachine();
 
 	Found = 0;
 	while ((Found==0) && Read1Byte(&b))
@@ -726,33 +943,8 @@ int Wait()
 
 		PutRecvLnBuff(b);
 
-		if (RegexActionType == REGEX_NONE) { // K\Ȃ̏ꍇ1oCg(wait command)
-			for (i = 9 ; i >= 0 ; i--) {
-				Str = PWaitStr[i];
-				if (Str!=NULL) {
-					if ((BYTE)Str[WaitCount[i]]==b) {
-						WaitCount[i]++;
-					}
-					else if (WaitCount[i]>0) {
-						for (j=WaitCount[i]-1; j>=0; j--) {
-							if ((BYTE)Str[j] == b) {
-								if (j== 0 || strncmp(Str, Str+(WaitCount[i]-j), j)==0) {
-									break;
-								}
-							}
-						}
-						if (j >= 0) {
-							WaitCount[i] = j+1;
-						}
-						else {
-							WaitCount[i] = 0;
-						}
-					}
-					if (WaitCount[i]==WaitStrLen[i]) {
-						Found = i+1;
-					}
-				}
-			}
+		if (Machine) { // K\Ȃ̏ꍇ1oCg(wait command)
+			Found = StepWaitMachine(&WaitState, b);
 		}
 	}
 
@@ -816,29 +1008,17 @@ BOOL WaitN()
 static int Wait4allOneBuffer(int index)
 {
 	BYTE b;
-	int i, Found;
-	PCHAR Str;
+	int Found;
+
+	if (!PrepareWaitMachine()) {
+		return 0;
+	}
 
+	// Mobt@ƂɏƍԂ
 	Found = 0;
 	while ((Found==0) && read_macro_1byte(index, &b))
 	{
-		for (i = 9 ; i >= 0 ; i--) {
-			Str = PWaitStr[i];
-			if (Str!=NULL) {
-				if ((BYTE)Str[WaitCount[i]]==b) {
-					WaitCount[i]++;
-				}
-				else if (WaitCount[i]>0) {
-					WaitCount[i] = 0;
-					if ((BYTE)Str[0]==b) {
-						WaitCount[i] = 1;
-					}
-				}
-				if (WaitCount[i]==WaitStrLen[i]) {
-					Found = i+1;
-				}
-			}
-		}
+		Found = StepWaitMachine(&Wait4allState[index], b);
 	}
 
 //	if (Found>0) ClearWait();
@@ -83,6 +83,18 @@ typedef struct {
 static Variable_t *Variables;
 static int VariableCount;
 
+// ϐ Variables[] ̓YnbV\ (I[vAhX@, 󂫂-1)
+static int *VarHash;
+static int VarHashSize;	// 2ׂ̂
+
+// CheckReservedWord() ̌ (\łȂO܂)
+#define RSV_CACHE_SIZE 256
+typedef struct {
+	char Name[MaxNameLen];
+	WORD WordId;
+} TRsvCache;
+static TRsvCache RsvCache[RSV_CACHE_SIZE];
+
 // g[N̉͊JnʒuXVB
 static void UpdateLineParsePtr(void)
 {
@@ -90,10 +102,55 @@ static void UpdateLineParsePtr(void)
 }
 
 
+static unsigned int NameHash(const char *Name)
+{
+	unsigned int h = 2166136261U;	// FNV-1a
+	while (*Name != 0) {
+		h ^= (unsigned char)tolower((unsigned char)*Name);
+		h *= 16777619U;
+		Name++;
+	}
+	return h;
+}
+
+static void VarHashInsert(int index)
+{
+	unsigned int mask = VarHashSize - 1;
+	unsigned int i = NameHash(Variables[index].Name) & mask;
+	while (VarHash[i] >= 0) {
+		i = (i + 1) & mask;
+	}
+	VarHash[i] = index;
+}
+
+// ϐ̒ǉ/폜ɍ蒼Bgp1/2ȉɕۂ
+static void VarHashRebuild(void)
+{
+	int i;
+	int size = 64;
+	while (size < VariableCount * 2) {
+		size *= 2;
+	}
+	free(VarHash);
+	VarHash = (int *)malloc(sizeof(int) * size);
+	if (VarHash == NULL) {
+		// CheckVar() ͐`Tœ
+		VarHashSize = 0;
+		return;
+	}
+	VarHashSize = size;
+	memset(VarHash, 0xff, sizeof(int) * size);
+	for (i = 0; i < VariableCount; i++) {
+		VarHashInsert(i);
+	}
+}
+
 BOOL InitVar()
 {
 	Variables = NULL;
 	VariableCount = 0;
+	VarHash = NULL;
+	VarHashSize = 0;
 	return TRUE;
 }
 
@@ -119,6 +176,9 @@ void EndVar()
 	free(Variables);
 	Variables = NULL;
 	VariableCount = 0;
+	free(VarHash);
+	VarHash = NULL;
+	VarHashSize = 0;
 }
 
 void DispErr(WORD Err)
@@ -173,7 +233,7 @@ void UnlockVar()
 {
 }
 
-BOOL CheckReservedWord(PCHAR Str, LPWORD WordId)
+static BOOL CheckReservedWordNoCache(PCHAR Str, LPWORD WordId)
 {
 	*WordId = 0;
 
@@ -379,6 +439,7 @@ BOOL CheckReservedWord(PCHAR Str, LPWORD WordId)
 		else if (_stricmp(Str,"setsync")==0) *WordId = RsvSetSync;
 		else if (_stricmp(Str,"settime")==0) *WordId = RsvSetTime;
 		else if (_stricmp(Str,"settitle")==0) *WordId = RsvSetTitle;
+		else if (_stricmp(Str,"sftpcmd")==0) *WordId = RsvSftpCmnd;
 		else if (_stricmp(Str,"show")==0) *WordId = RsvShow;
 		else if (_stricmp(Str,"showtt")==0) *WordId = RsvShowTT;
 		else if (_stricmp(Str,"sprintf")==0) *WordId = RsvSprintf;  // add 'sprintf' (2007.5.1 yutaka)
@@ -446,6 +507,24 @@ BOOL CheckReservedWord(PCHAR Str, LPWORD WordId)
 	return (*WordId!=0);
 }
 
+// [vł͓ʎqxׂ̂ŁAʂoĂ
+BOOL CheckReservedWord(PCHAR Str, LPWORD WordId)
+{
+	TRsvCache *c;
+
+	if (strlen(Str) >= MaxNameLen) {
+		return CheckReservedWordNoCache(Str, WordId);
+	}
+
+	c = &RsvCache[NameHash(Str) & (RSV_CACHE_SIZE - 1)];
+	if (c->Name[0] == 0 || _stricmp(c->Name, Str) != 0) {
+		CheckReservedWordNoCache(Str, &c->WordId);
+		strncpy_s(c->Name, sizeof(c->Name), Str, _TRUNCATE);
+	}
+	*WordId = c->WordId;
+	return (*WordId!=0);
+}
+
 /* CRgĂ邩ǂ */
 int IsCommentClosed(void)
 {
@@ -853,6 +932,24 @@ BOOL CheckVar(const char *Name, TVariableType *VarType, PVarId VarId)
 {
 	int i;
 	const Variable_t *v = Variables;
+
+	if (VarHash != NULL) {
+		unsigned int mask = VarHashSize - 1;
+		unsigned int h = NameHash(Name) & mask;
+		while ((i = VarHash[h]) >= 0) {
+			v = &Variables[i];
+			if (_stricmp(v->Name, Name) == 0) {
+				*VarType = v->Type;
+				*VarId = (TVarId)i;
+				return TRUE;
+			}
+			h = (h + 1) & mask;
+		}
+		*VarType = TypUnknown;
+		*VarId = 0;
+		return FALSE;
+	}
+
 	for (i = 0; i < VariableCount; v++,i++) {
 		if (_stricmp(v->Name, Name) == 0) {
 			*VarType = v->Type;
@@ -877,6 +974,12 @@ static Variable_t *NewVar(const char *name, TVariableType type)
 	VariableCount++;
 	v->Name = _strdup(name);
 	v->Type = type;
+	if (VarHash == NULL || VariableCount * 2 > VarHashSize) {
+		VarHashRebuild();
+	}
+	else {
+		VarHashInsert(VariableCount - 1);
+	}
 	return v;
 }
 
@@ -956,6 +1059,7 @@ void DelLabVar(WORD ILevel)
 		v++;
 	}
 	Variables = (Variable_t *)realloc(Variables, sizeof(Variable_t) * VariableCount);
+	VarHashRebuild();
 }
 
 void CopyLabel(WORD ILabel, BINT *Ptr, LPWORD Level)
@@ -296,6 +296,7 @@ typedef enum {
 #define RsvDelPassword2 221
 #define RsvIsPassword2  222
 #define RsvGetTTPos     223
+#define RsvSftpCmnd     224
 
 #define RsvOperator     1000
 #define RsvBNot         1001
@@ -1065,10 +1065,28 @@ void PASCAL _ReadIniFile(const wchar_t *FName, PTTSet ts)
 	ts->LogRotateSize = GetPrivateProfileInt(Section, "LogRotateSize", 0, FName);
 	ts->LogRotateSizeType = GetPrivateProfileInt(Section, "LogRotateSizeType", 0, FName);
 	ts->LogRotateStep = GetPrivateProfileInt(Section, "LogRotateStep", 0, FName);
+	ts->LogRotateInterval = GetPrivateProfileInt(Section, "LogRotateInterval", 0, FName);
+	ts->LogRotateCompress = GetOnOff(Section, "LogRotateCompress", FName, FALSE);
 
 	/* Deferred Log Write Mode (2013.4.20 yutaka) */
 	ts->DeferredLogWriteMode = GetOnOff(Section, "DeferredLogWriteMode", FName, TRUE);
 
+	/* Log flush mode */
+	GetPrivateProfileString(Section, "LogFlushMode", "close",
+	                        Temp, sizeof(Temp), FName);
+	if (_stricmp(Temp, "line") == 0)
+		ts->LogFlushMode = LOG_FLUSH_LINE;
+	else if (_stricmp(Temp, "interval") == 0)
+		ts->LogFlushMode = LOG_FLUSH_INTERVAL;
+	else
+		ts->LogFlushMode = LOG_FLUSH_CLOSE;
+	ts->LogFlushInterval = GetPrivateProfileInt(Section, "LogFlushInterval", 1000, FName);
+	if (ts->LogFlushInterval < 10)
+		ts->LogFlushInterval = 10;
+
+	/* Compressed log */
+	ts->LogCompress = GetOnOff(Section, "LogCompress", FName, FALSE);
+
 
 	/* XMODEM option */
 	GetPrivateProfileString(Section, "XmodemOpt", "",
@@ -1498,6 +1516,14 @@ void PASCAL _ReadIniFile(const wchar_t *FName, PTTSet ts)
 	ts->ConnectingTimeout =
 		GetPrivateProfileInt(Section, "ConnectingTimeout", 0, FName);
 
+	// Receive buffer size
+	ts->ReceiveBufferSize =
+		GetPrivateProfileInt(Section, "ReceiveBufferSize", 64*1024, FName);
+	if (ts->ReceiveBufferSize < InBuffSize)
+		ts->ReceiveBufferSize = InBuffSize;
+	if (ts->ReceiveBufferSize > InBuffSizeMax)
+		ts->ReceiveBufferSize = InBuffSizeMax;
+
 	// mouse cursor
 	GetPrivateProfileString(Section, "MouseCursor", "IBEAM",
 	                        Temp, sizeof(Temp), FName);
@@ -2189,6 +2215,7 @@ void PASCAL _WriteIniFile(const wchar_t *FName, PTTSet ts)
 
 	// new configuration
 	WriteInt(Section, "ConnectingTimeout", FName, ts->ConnectingTimeout);
+	WriteInt(Section, "ReceiveBufferSize", FName, ts->ReceiveBufferSize);
 
 	WriteOnOff(Section, "DisablePasteMouseRButton", FName,
 	           (WORD) (ts->PasteFlag & CPF_DISABLE_RBUTTON));
@@ -2565,10 +2592,29 @@ void PASCAL _WriteIniFile(const wchar_t *FName, PTTSet ts)
 	WriteInt(Section, "LogRotateSize", FName, ts->LogRotateSize);
 	WriteInt(Section, "LogRotateSizeType", FName, ts->LogRotateSizeType);
 	WriteInt(Section, "LogRotateStep", FName, ts->LogRotateStep);
+	WriteInt(Section, "LogRotateInterval", FName, ts->LogRotateInterval);
+	WriteOnOff(Section, "LogRotateCompress", FName, ts->LogRotateCompress);
 
 	/* Deferred Log Write Mode (2013.4.20 yutaka) */
 	WriteOnOff(Section, "DeferredLogWriteMode", FName, ts->DeferredLogWriteMode);
 
+	/* Log flush mode */
+	switch (ts->LogFlushMode) {
+	case LOG_FLUSH_LINE:
+		strncpy_s(Temp, sizeof(Temp), "line", _TRUNCATE);
+		break;
+	case LOG_FLUSH_INTERVAL:
+		strncpy_s(Temp, sizeof(Temp), "interval", _TRUNCATE);
+		break;
+	default:
+		strncpy_s(Temp, sizeof(Temp), "close", _TRUNCATE);
+	}
+	WritePrivateProfileString(Section, "LogFlushMode", Temp, FName);
+	WriteUint(Section, "LogFlushInterval", FName, ts->LogFlushInterval);
+
+	/* Compressed log */
+	WriteOnOff(Section, "LogCompress", FName, ts->LogCompress);
+
 	/* XMODEM option */
 	switch (ts->XmodemOpt) {
 	case XoptCRC:
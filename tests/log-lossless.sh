@@ -0,0 +1,69 @@
+#!/bin/sh
+# ログの欠落を調べるストレステスト
+#
+# 1. Tera Term でログ採取を開始する (テキスト/バイナリ、タイムスタンプ有無は任意)
+# 2. サーバで sh log-lossless.sh gen [N [WIDTH]] を実行する
+#    番号付きの行を N 行、一気に出力する
+# 3. ログ採取を終了し、ログファイルを調べる
+#    sh log-lossless.sh check LOGFILE [N [WIDTH]]
+#    行が全部そろっていて、中身が壊れていなければ OK
+#    ログのダイアログの欠落バイト数が 0 であることも確認する
+
+MODE=$1
+if [ "$MODE" = "check" ]; then
+  LOGFILE=$2
+  shift
+fi
+N=${2:-1000000}
+WIDTH=${3:-100}
+
+case "$MODE" in
+gen)
+  awk -v n="$N" -v w="$WIDTH" '
+  BEGIN {
+    base = ""
+    while (length(base) < w + 10) base = base "0123456789abcdefghijklmnopqrstuvwxyz"
+    for (i = 1; i <= n; i++) {
+      printf "L%010d:%s\n", i, substr(base, i % 36 + 1, w)
+    }
+  }'
+  ;;
+check)
+  if [ ! -f "$LOGFILE" ]; then
+    echo "usage: $0 check LOGFILE [N [WIDTH]]"
+    exit 1
+  fi
+  # タイムスタンプやプロンプトなど、番号付きの行以外は読み飛ばす
+  tr -d '\r' < "$LOGFILE" | awk -v n="$N" -v w="$WIDTH" '
+  BEGIN {
+    base = ""
+    while (length(base) < w + 10) base = base "0123456789abcdefghijklmnopqrstuvwxyz"
+    expect = 1
+    errors = 0
+  }
+  match($0, /L[0-9]+:/) {
+    i = substr($0, RSTART + 1, RLENGTH - 2) + 0
+    body = substr($0, RSTART + RLENGTH)
+    if (i != expect) {
+      if (errors++ < 10) printf "line %d: expected %d, found %d\n", NR, expect, i
+    }
+    else if (body != substr(base, i % 36 + 1, w)) {
+      if (errors++ < 10) printf "line %d: %d is broken\n", NR, i
+    }
+    expect = i + 1
+  }
+  END {
+    if (expect != n + 1) {
+      printf "last line %d, expected %d\n", expect - 1, n
+      errors++
+    }
+    printf "%d lines, %d errors: %s\n", n, errors, errors == 0 ? "OK" : "NG"
+    exit errors != 0
+  }'
+  ;;
+*)
+  echo "usage: $0 gen [N [WIDTH]]"
+  echo "       $0 check LOGFILE [N [WIDTH]]"
+  exit 1
+  ;;
+esac
@@ -0,0 +1,21 @@
+@echo off
+rem TTL C^v^̃x`}[N
+rem   macro-benchmark.bat [N] [ttpmacro.exe]
+rem ttpmacro.exe ւĎsAʂrB
+rem Ԃ PowerShell  Measure-Command  ms PʂŌvB
+rem none (Ȃ}N) ̎Ԃ ttpmacro ̋NƏIɂ鎞ԂɂȂB
+
+setlocal
+set N=%1
+if "%N%"=="" set N=200000
+set TTMACRO=%2
+if "%TTMACRO%"=="" set TTMACRO=%~dp0\..\teraterm\Debug\ttpmacro.exe
+set MACROFILE=%~dpn0.ttl
+
+echo ttpmacro: %TTMACRO%
+echo N=%N%
+for %%k in (none for while array) do (
+  for /f %%t in ('powershell -NoProfile -Command "[int](Measure-Command { Start-Process -Wait -FilePath '%TTMACRO%' -ArgumentList '/V','\"%MACROFILE%\"','%%k','%N%' }).TotalMilliseconds"') do echo %%k: %%t ms
+)
+endlocal
+pause
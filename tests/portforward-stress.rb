@@ -0,0 +1,67 @@
+#!/usr/bin/ruby
+# coding: UTF-8
+#
+# ポートフォワードのストレステスト
+#
+# 接続を OPEN 本開いたまま、新しい接続を開いては一番古い接続を閉じることを
+# COUNT 回繰り返し、1000 接続ごとの時間を表示する。
+# チャネルの検索が表の大きさによらなければ、開いている本数を増やしても
+# 1000 接続あたりの時間はほぼ変わらない。
+#
+# 接続先はサーバの sshd (localhost:22) で、各接続で SSH のバナーを読む。
+#
+# ローカルフォワード
+#   Tera Term で /ssh-L8022:localhost:22 を指定してサーバに接続後、
+#   ruby portforward-stress.rb [COUNT [OPEN]]
+# ダイナミックフォワード(SOCKS5)
+#   Tera Term で /ssh-D1080 を指定してサーバに接続後、
+#   SOCKS=1080 ruby portforward-stress.rb [COUNT [OPEN]]
+#
+
+require 'socket'
+
+COUNT = (ARGV[0] || 5000).to_i
+OPEN = (ARGV[1] || 200).to_i
+PORT = (ENV['PORT'] || 8022).to_i
+SOCKS = ENV['SOCKS'] && ENV['SOCKS'].to_i
+
+def connect
+  if SOCKS
+    s = TCPSocket.open("localhost", SOCKS)
+    s.write [5, 1, 0].pack("C*")
+    raise "SOCKS auth" unless s.read(2) == [5, 0].pack("C*")
+    host = "localhost"
+    s.write [5, 1, 0, 3, host.size].pack("C*") + host + [22].pack("n")
+    reply = s.read(10)
+    raise "SOCKS connect" unless reply && reply.getbyte(1) == 0
+  else
+    s = TCPSocket.open("localhost", PORT)
+  end
+  banner = s.gets
+  raise "no banner" unless banner && banner.start_with?("SSH-")
+  s
+end
+
+opened = []
+errors = 0
+start = lap = Time.now
+
+COUNT.times do |i|
+  begin
+    opened << connect
+  rescue => e
+    errors += 1
+    puts "#{i}: #{e}" if errors <= 10
+  end
+  opened.shift.close if opened.size > OPEN
+  if (i + 1) % 1000 == 0
+    now = Time.now
+    puts "#{i + 1} connections, #{opened.size} open: #{((now - lap) * 1000).round} ms / 1000"
+    lap = now
+  end
+end
+
+opened.each { |s| s.close }
+
+elapsed = Time.now - start
+puts "END: #{COUNT} connections in #{(elapsed * 1000).round} ms, #{(COUNT / elapsed).round} conn/s, #{errors} errors."
@@ -0,0 +1,88 @@
+#!/bin/bash
+# スクロールのベンチマーク
+#   Tera Term 上で実行する
+#   bash scroll-benchmark.sh [N]
+# 桁数を変えながら、スクロール領域内のスクロール(LF, IL/DL)と
+# スクロール領域付きのバックスクロールへの送り出しを N 回行い、時間(ms)を表示する。
+# スクロールが行の参照の入れ替えになっていれば、時間は桁数によらずほぼ一定になる。
+# 桁数は CSI 8 t で変えるので WindowCtrlSequence=on にしておく。
+# 端末の処理を待つため、最後に DA を送って応答を待ってから時間を測る。
+
+N=${1:-20000}
+COLS="80 250 500 1000"
+ROWS=24
+
+CSI() {
+  printf "\033[%s" "$1"
+}
+
+Pos() {
+  CSI "$1;$2H"
+}
+
+# 端末がここまでの出力を処理し終えるのを待つ
+Sync() {
+  local r
+  CSI "c"
+  IFS= read -r -s -d c r
+}
+
+ms() {
+  date +%s%3N
+}
+
+# 各行を桁数分の文字で埋める
+Fill() {
+  local line
+  line=$(printf "%*s" "$1" "" | tr ' ' '#')
+  Pos 1 1
+  for ((i = 1; i < ROWS; i++)); do
+    printf "%s\r\n" "$line"
+  done
+  printf "%s" "$line"
+}
+
+# $1 を N 回繰り返した文字列
+Repeat() {
+  yes "$1" | head -n "$N" | tr -d '\n'
+}
+
+LF=$(yes "" | head -n "$N")
+IL=$(Repeat "$(CSI L)")
+DL=$(Repeat "$(CSI M)")
+
+# $1: 桁数, $2: 名前, $3: スクロール領域, $4: 開始位置, $5: 出力
+Bench() {
+  local cols=$1 name=$2 start end
+  CSI "r"
+  Fill "$cols"
+  CSI "$3r"
+  Pos $4
+  Sync
+  start=$(ms)
+  printf "%s" "$5"
+  Sync
+  end=$(ms)
+  RESULT="$RESULT$(printf "%-8s %6d %8d" "$name" "$cols" $((end - start)))\n"
+}
+
+stty_save=$(stty -g)
+stty raw -echo
+RESULT=""
+for c in $COLS; do
+  CSI "8;$ROWS;${c}t"
+  Sync
+  Bench "$c" "region" "2;$((ROWS - 1))" "$((ROWS - 1)) 1" "$LF"
+  Bench "$c" "IL" "2;$((ROWS - 1))" "2 1" "$IL"
+  Bench "$c" "DL" "2;$((ROWS - 1))" "2 1" "$DL"
+  Bench "$c" "top" "1;$((ROWS - 1))" "$((ROWS - 1)) 1" "$LF"
+done
+CSI "r"
+CSI "8;24;80t"
+CSI "2J"
+Pos 1 1
+stty "$stty_save"
+
+echo "N=$N"
+printf "%-8s %6s %8s\n" "test" "cols" "ms"
+printf "$RESULT"
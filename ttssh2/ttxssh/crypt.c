@@ -42,6 +42,7 @@
 #include "cipher.h"
 #include "ssh.h"
 #include "ssherr.h"
+#include "openbsd-compat.h"
 
 #define do_crc(buf, len) (~(uint32)crc32(0xFFFFFFFF, (buf), (len)))
 #define get_uint32(buf) get_uint32_MSBfirst((buf))
@@ -73,8 +74,9 @@
 
 #define CMP(a,b) memcmp(a, b, SSH_BLOCKSIZE)
 
-static unsigned char *encbuff = NULL;
-static unsigned int encbufflen = 0;
+// E&M ŕ MAC ̌vZ݂ɍsP
+// (f[^LbVɎcĂ邤 MAC vZ邽)
+#define DECRYPT_MAC_CHUNK (16 * 1024)
 
 static void crc_update(uint32 *a, uint32 b)
 {
@@ -201,12 +203,10 @@ BOOL CRYPT_detect_attack(PTInstVar pvar, unsigned char *buf, int bytes)
 
 BOOL CRYPT_encrypt_aead(PTInstVar pvar, unsigned char *data, unsigned int bytes, unsigned int aadlen, unsigned int authlen)
 {
-	unsigned char *newbuff = NULL;
 	unsigned int block_size = pvar->ssh2_keys[MODE_OUT].enc.block_size;
 	unsigned char lastiv[1];
 	char tmp[80];
 	struct sshcipher_ctx *cc = pvar->cc[MODE_OUT];
-	unsigned int newbuff_len = bytes;
 
 	if (bytes == 0)
 		return TRUE;
@@ -220,25 +220,15 @@ BOOL CRYPT_encrypt_aead(PTInstVar pvar, unsigned char *data, unsigned int bytes,
 		return FALSE;
 	}
 
+	// Í͂̏(data)ōs
 	if (cc->cipher->id == SSH2_CIPHER_CHACHAPOLY) {
 		// chacha20-poly1305 ł aadlen Í̑Ώ
 		//   aadlen  bytes ͕ʁXɈÍ
 		// chachapoly_crypt ̒ŔF؃f[^(AEAD tag)
-		newbuff_len += aadlen + authlen;
-	}
-	if (newbuff_len > encbufflen) {
-		if ((newbuff = realloc(encbuff, newbuff_len)) == NULL)
-			goto err;
-		encbuff = newbuff;
-		encbufflen = newbuff_len;
-	}
-
-	if (cc->cipher->id == SSH2_CIPHER_CHACHAPOLY) {
 		if (chachapoly_crypt(cc->cp_ctx, pvar->ssh_state.sender_sequence_number,
-		                     encbuff, data, bytes, aadlen, authlen, 1) != 0) {
+		                     data, data, bytes, aadlen, authlen, 1) != 0) {
 			goto err;
 		}
-		memcpy(data, encbuff, aadlen + bytes + authlen);
 		return TRUE;
 	}
 
@@ -249,11 +239,9 @@ BOOL CRYPT_encrypt_aead(PTInstVar pvar, unsigned char *data, unsigned int bytes,
 		goto err;
 
 	// AES-GCM ł aadlen ÍȂ̂ŁA̐悾Í
-	if (EVP_Cipher(cc->evp, encbuff, data+aadlen, bytes) < 0)
+	if (EVP_Cipher(cc->evp, data+aadlen, data+aadlen, bytes) < 0)
 		goto err;
 
-	memcpy(data+aadlen, encbuff, bytes);
-
 	if (EVP_Cipher(cc->evp, NULL, NULL, 0) < 0)
 		goto err;
 
@@ -272,12 +260,10 @@ err:
 
 BOOL CRYPT_decrypt_aead(PTInstVar pvar, unsigned char *data, unsigned int bytes, unsigned int aadlen, unsigned int authlen)
 {
-	unsigned char *newbuff = NULL;
 	unsigned int block_size = pvar->ssh2_keys[MODE_IN].enc.block_size;
 	unsigned char lastiv[1];
 	char tmp[80];
 	struct sshcipher_ctx *cc = pvar->cc[MODE_IN];
-	unsigned int newbuff_len = bytes;
 
 	if (bytes == 0)
 		return TRUE;
@@ -291,23 +277,14 @@ BOOL CRYPT_decrypt_aead(PTInstVar pvar, unsigned char *data, unsigned int bytes,
 		return FALSE;
 	}
 
+	// ͂̏(data)ōs
 	if (cc->cipher->id == SSH2_CIPHER_CHACHAPOLY) {
 		// chacha20-poly1305 ł aadlen ÍĂ
-		newbuff_len += aadlen;
-	}
-	if (newbuff_len > encbufflen) {
-		if ((newbuff = realloc(encbuff, newbuff_len)) == NULL)
-			goto err;
-		encbuff = newbuff;
-		encbufflen = newbuff_len;
-	}
-
-	if (cc->cipher->id == SSH2_CIPHER_CHACHAPOLY) {
+		// chachapoly_crypt ͔F؃f[^(AEAD tag)؂Ă畜
 		if (chachapoly_crypt(cc->cp_ctx, pvar->ssh_state.receiver_sequence_number,
-		                     encbuff, data, bytes, aadlen, authlen, 0) != 0) {
+		                     data, data, bytes, aadlen, authlen, 0) != 0) {
 			goto err;
 		}
-		memcpy(data, encbuff, aadlen + bytes);
 		return TRUE;
 	}
 
@@ -321,11 +298,10 @@ BOOL CRYPT_decrypt_aead(PTInstVar pvar, unsigned char *data, unsigned int bytes,
 		goto err;
 
 	// AES-GCM ł aadlen ÍȂ̂ŁA̐悾
-	if (EVP_Cipher(cc->evp, encbuff, data+aadlen, bytes) < 0)
+	if (EVP_Cipher(cc->evp, data+aadlen, data+aadlen, bytes) < 0)
 		goto err;
 
-	memcpy(data+aadlen, encbuff, bytes);
-
+	// F؃f[^(AEAD tag)̌؂͕ƓpX̍Ōōs
 	if (EVP_Cipher(cc->evp, NULL, NULL, 0) < 0)
 		goto err;
 
@@ -345,7 +321,6 @@ static void no_encrypt(PTInstVar pvar, unsigned char *buf, unsigned int bytes)
 
 static void crypt_SSH2_encrypt(PTInstVar pvar, unsigned char *buf, unsigned int bytes)
 {
-	unsigned char *newbuff;
 	int block_size = pvar->ssh2_keys[MODE_OUT].enc.block_size;
 	char tmp[80];
 
@@ -362,26 +337,17 @@ static void crypt_SSH2_encrypt(PTInstVar pvar, unsigned char *buf, unsigned int
 		return;
 	}
 
-	if (bytes > encbufflen) {
-		if ((newbuff = realloc(encbuff, bytes)) == NULL)
-			return;
-		encbuff = newbuff;
-		encbufflen = bytes;
-	}
-
-	if (EVP_Cipher(pvar->cc[MODE_OUT]->evp, encbuff, buf, bytes) == 0) {
+	// Í͂̏(buf)ōs
+	if (EVP_Cipher(pvar->cc[MODE_OUT]->evp, buf, buf, bytes) == 0) {
 		UTIL_get_lang_msg("MSG_ENCRYPT_ERROR2", pvar, "%s encrypt error(2)");
 		_snprintf_s(tmp, sizeof(tmp), _TRUNCATE, pvar->UIMsg,
 		            get_cipher_name(pvar->crypt_state.sender_cipher));
 		notify_fatal_error(pvar, tmp, TRUE);
-	} else {
-		memcpy(buf, encbuff, bytes);
 	}
 }
 
 static void crypt_SSH2_decrypt(PTInstVar pvar, unsigned char *buf, unsigned int bytes)
 {
-	unsigned char *newbuff;
 	int block_size = pvar->ssh2_keys[MODE_IN].enc.block_size;
 	char tmp[80];
 
@@ -398,20 +364,12 @@ static void crypt_SSH2_decrypt(PTInstVar pvar, unsigned char *buf, unsigned int
 		return;
 	}
 
-	if (bytes > encbufflen) {
-		if ((newbuff = malloc(bytes)) == NULL)
-			return;
-		encbuff = newbuff;
-		encbufflen = bytes;
-	}
-
-	if (EVP_Cipher(pvar->cc[MODE_IN]->evp, encbuff, buf, bytes) == 0) {
+	// ͂̏(buf)ōs
+	if (EVP_Cipher(pvar->cc[MODE_IN]->evp, buf, buf, bytes) == 0) {
 		UTIL_get_lang_msg("MSG_DECRYPT_ERROR2", pvar, "%s decrypt error(2)");
 		_snprintf_s(tmp, sizeof(tmp), _TRUNCATE, pvar->UIMsg,
 		            get_cipher_name(pvar->crypt_state.receiver_cipher));
 		notify_fatal_error(pvar, tmp, TRUE);
-	} else {
-		memcpy(buf, encbuff, bytes);
 	}
 }
 
@@ -705,6 +663,60 @@ error:
 	return FALSE;
 }
 
+// E&M p̕ HMAC ̌
+//   data  len oCg MAC ̑ΏۂŁA擪 already_decrypted oCg͕ς݁B
+//   c DECRYPT_MAC_CHUNK A HMAC ɒʂB
+// {֐ SSH2 ł̂ݎgpB
+BOOL CRYPT_decrypt_verify_receiver_MAC(PTInstVar pvar, uint32 sequence_number,
+                                       char *data, int len, int already_decrypted, char *MAC)
+{
+	struct Mac *mac;
+	unsigned char b[4];
+	unsigned char ourmac[SSH_DIGEST_MAX_LENGTH];
+	int offset;
+
+	mac = &pvar->ssh2_keys[MODE_IN].mac;
+
+	// HMAC܂LłȂꍇ́AsB
+	if (mac == NULL || mac->enabled == 0) {
+		CRYPT_decrypt(pvar, data + already_decrypted, len - already_decrypted);
+		return TRUE;
+	}
+
+	if (mac->key == NULL || mac->hmac_ctx == NULL || mac->mac_len > sizeof(ourmac)) {
+		logprintf(LOG_LEVEL_VERBOSE, "HMAC key is NULL(seq %lu len %d)", sequence_number, len);
+		return FALSE;
+	}
+
+	set_uint32_MSBfirst(b, sequence_number);
+	if (ssh_hmac_init(mac->hmac_ctx, NULL, 0) < 0 ||
+	    ssh_hmac_update(mac->hmac_ctx, b, sizeof(b)) < 0 ||
+	    ssh_hmac_update(mac->hmac_ctx, data, already_decrypted) < 0) {
+		return FALSE;
+	}
+
+	// DECRYPT_MAC_CHUNK ̓ubN̔{Ȃ̂ŁArŋ؂Ăʂ͕ςȂ
+	for (offset = already_decrypted; offset < len; offset += DECRYPT_MAC_CHUNK) {
+		int n = min(len - offset, DECRYPT_MAC_CHUNK);
+
+		CRYPT_decrypt(pvar, data + offset, n);
+		if (ssh_hmac_update(mac->hmac_ctx, data + offset, n) < 0) {
+			return FALSE;
+		}
+	}
+
+	if (ssh_hmac_final(mac->hmac_ctx, ourmac, sizeof(ourmac)) < 0) {
+		return FALSE;
+	}
+	if (timingsafe_bcmp(ourmac, MAC, mac->mac_len) != 0) {
+		logprintf(LOG_LEVEL_VERBOSE, "HMAC key is not matched(seq %lu len %d)", sequence_number, len);
+		logprintf_hexdump(LOG_LEVEL_VERBOSE, MAC, mac->mac_len, "MAC:");
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
 unsigned int CRYPT_get_sender_MAC_size(PTInstVar pvar)
 {
 	struct Mac *mac;
@@ -1186,10 +1198,6 @@ void CRYPT_free_public_key(CRYPTPublicKey * key)
 
 void CRYPT_end(PTInstVar pvar)
 {
-	free(encbuff);
-	encbuff = NULL;
-	encbufflen = 0;
-
 	destroy_public_key(&pvar->crypt_state.host_key);
 	destroy_public_key(&pvar->crypt_state.server_key);
 
@@ -134,6 +134,8 @@ int CRYPT_generate_RSA_challenge_response(PTInstVar pvar, unsigned char *challen
 unsigned int CRYPT_get_receiver_MAC_size(PTInstVar pvar);
 BOOL CRYPT_verify_receiver_MAC(PTInstVar pvar, uint32 sequence_number,
   char *data, int len, char *MAC);
+BOOL CRYPT_decrypt_verify_receiver_MAC(PTInstVar pvar, uint32 sequence_number,
+  char *data, int len, int already_decrypted, char *MAC);
 unsigned int CRYPT_get_sender_MAC_size(PTInstVar pvar);
 
 BOOL CRYPT_build_sender_MAC(PTInstVar pvar, uint32 sequence_number,
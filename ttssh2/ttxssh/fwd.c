@@ -46,6 +46,13 @@ See LICENSE.TXT for the license.
 #define WM_SOCK_GOTNAME (WM_APP+9997)
 
 #define CHANNEL_READ_BUF_SIZE 8192
+// [Jǂ񂾃f[^1 CHANNEL_DATA ɂ܂Ƃ߂
+#define CHANNEL_READ_BUF_MAX (256 * 1024)
+// ʓ]̒[㑱̃f[^Ƃ܂Ƃ߂邽߂ɑ҂ő厞(ms)
+#define CHANNEL_COALESCE_DELAY 10
+#define FWD_COALESCE_TIMER_ID(channel_num) (0x1000 + (channel_num))
+// `l\ŏɊmۂƂ̗vf (ȍ~͔{XɍL)
+#define FWD_CHANNEL_ADD_NUM 16
 
 static LRESULT CALLBACK accept_wnd_proc(HWND wnd, UINT msg, WPARAM wParam,
                                         LPARAM lParam);
@@ -71,6 +78,35 @@ static int find_request_num(PTInstVar pvar, SOCKET s)
 	return -1;
 }
 
+// SOCKET ̒l 4 ̔{ɂȂ邱Ƃ̂ŁA 2bit ̂ĂĂg
+#define FWD_SOCKET_HASH(s) ((int)(((UINT_PTR)(s) >> 2) & (FWD_SOCKET_HASH_SIZE - 1)))
+
+/* local_socket ̒lςƂ͕KʂAsocket_hash Ǐ] */
+static void set_channel_socket(PTInstVar pvar, int channel_num, SOCKET s)
+{
+	FWDChannel *channel = pvar->fwd_state.channels + channel_num;
+	int *p;
+
+	if (channel->local_socket != INVALID_SOCKET) {
+		p = &pvar->fwd_state.socket_hash[FWD_SOCKET_HASH(channel->local_socket)];
+		while (*p >= 0) {
+			if (*p == channel_num) {
+				*p = channel->hash_next;
+				break;
+			}
+			p = &pvar->fwd_state.channels[*p].hash_next;
+		}
+	}
+
+	channel->local_socket = s;
+	channel->hash_next = -1;
+	if (s != INVALID_SOCKET) {
+		p = &pvar->fwd_state.socket_hash[FWD_SOCKET_HASH(s)];
+		channel->hash_next = *p;
+		*p = channel_num;
+	}
+}
+
 static int find_channel_num(PTInstVar pvar, SOCKET s)
 {
 	int i;
@@ -78,7 +114,8 @@ static int find_channel_num(PTInstVar pvar, SOCKET s)
 	if (s == INVALID_SOCKET)
 		return -1;
 
-	for (i = 0; i < pvar->fwd_state.num_channels; i++) {
+	for (i = pvar->fwd_state.socket_hash[FWD_SOCKET_HASH(s)]; i >= 0;
+	     i = pvar->fwd_state.channels[i].hash_next) {
 		if (pvar->fwd_state.channels[i].local_socket == s) {
 			return i;
 		}
@@ -237,13 +274,33 @@ static void send_local_connection_closure(PTInstVar pvar, int channel_num)
 	}
 }
 
+/* readbuf ɂ߂f[^ SSH T[o֑ */
+static void flush_local_read_buffer(PTInstVar pvar, int channel_num)
+{
+	FWDChannel *channel = pvar->fwd_state.channels + channel_num;
+
+	if (channel->read_timer) {
+		KillTimer(pvar->fwd_state.accept_wnd, FWD_COALESCE_TIMER_ID(channel_num));
+		channel->read_timer = FALSE;
+	}
+
+	if (channel->readbuf_len > 0) {
+		if ((channel->status & FWD_CLOSED_REMOTE_OUT) == 0) {
+			SSH_channel_send(pvar, channel_num, channel->remote_num, channel->readbuf, channel->readbuf_len, 0);
+		}
+		channel->readbuf_len = 0;
+	}
+}
+
 static void closed_local_connection(PTInstVar pvar, int channel_num)
 {
 	FWDChannel *channel = pvar->fwd_state.channels + channel_num;
 
 	if (channel->local_socket != INVALID_SOCKET) {
+		// EOF ɁA߂Ăf[^𑗂Ă
+		flush_local_read_buffer(pvar, channel_num);
 		safe_closesocket(pvar, channel->local_socket);
-		channel->local_socket = INVALID_SOCKET;
+		set_channel_socket(pvar, channel_num, INVALID_SOCKET);
 
 		send_local_connection_closure(pvar, channel_num);
 	}
@@ -267,6 +324,8 @@ static void really_delete_request(PTInstVar pvar, int request_num)
 void FWD_free_channel(PTInstVar pvar, uint32 local_channel_num)
 {
 	FWDChannel *channel = &pvar->fwd_state.channels[local_channel_num];
+	// 2Ă΂邱Ƃ̂ŁAgpꍇ󂫃X^bNɖ߂
+	BOOL was_used = (channel->status != 0);
 
 	if (channel->type == TYPE_AGENT) { // TYPE_AGENT łɗ̂ SSH1 ̂
 		buffer_free(channel->agent_msg);
@@ -276,6 +335,14 @@ void FWD_free_channel(PTInstVar pvar, uint32 local_channel_num)
 	}
 	else { // TYPE_PORTFWD
 		UTIL_destroy_sock_write_buf(&channel->writebuf);
+		if (channel->read_timer) {
+			KillTimer(pvar->fwd_state.accept_wnd, FWD_COALESCE_TIMER_ID(local_channel_num));
+			channel->read_timer = FALSE;
+		}
+		free(channel->readbuf);
+		channel->readbuf = NULL;
+		channel->readbuf_size = 0;
+		channel->readbuf_len = 0;
 		if (channel->filter != NULL) {
 			channel->filter(channel->filter_closure, FWD_FILTER_CLEANUP, NULL, NULL);
 			channel->filter = NULL;
@@ -284,7 +351,7 @@ void FWD_free_channel(PTInstVar pvar, uint32 local_channel_num)
 		channel->status = 0;
 		if (channel->local_socket != INVALID_SOCKET) {
 			safe_closesocket(pvar, channel->local_socket);
-			channel->local_socket = INVALID_SOCKET;
+			set_channel_socket(pvar, local_channel_num, INVALID_SOCKET);
 		}
 	}
 
@@ -299,6 +366,10 @@ void FWD_free_channel(PTInstVar pvar, uint32 local_channel_num)
 		}
 		channel->request_num = -1;
 	}
+
+	if (was_used) {
+		pvar->fwd_state.free_channels[pvar->fwd_state.num_free_channels++] = local_channel_num;
+	}
 }
 
 void FWD_channel_input_eof(PTInstVar pvar, uint32 local_channel_num)
@@ -452,46 +523,68 @@ static void channel_opening_error(PTInstVar pvar, int channel_num, int err)
 	FWD_free_channel(pvar, channel_num);
 }
 
-static int alloc_channel(PTInstVar pvar, int new_status,
-                         int new_request_num)
+// 󂫃`lԍԂB󂫂ȂΕ\{ɍL
+// 󂫃`l̓X^bNŊǗAS`l𑖍Ȃ
+// @retval	-1	s
+static int get_free_channel(PTInstVar pvar)
 {
-	int i;
-	int new_num_channels;
-	int new_channel = -1;
-	FWDChannel *channel;
+	if (pvar->fwd_state.num_free_channels == 0) {
+		int old_num = pvar->fwd_state.num_channels;
+		int new_num = old_num == 0 ? FWD_CHANNEL_ADD_NUM : old_num * 2;
+		FWDChannel *p;
+		int *ids;
+		int i;
 
-	for (i = 0; i < pvar->fwd_state.num_channels && new_channel < 0; i++) {
-		if (pvar->fwd_state.channels[i].status == 0) {
-			new_channel = i;
+		p = (FWDChannel *) realloc(pvar->fwd_state.channels, sizeof(FWDChannel) * new_num);
+		if (p == NULL) {
+			return -1;
 		}
-	}
-
-	if (new_channel < 0) {
-		new_num_channels = pvar->fwd_state.num_channels + 1;
-		pvar->fwd_state.channels =
-			(FWDChannel *) realloc(pvar->fwd_state.channels,
-			                           sizeof(FWDChannel) *
-			                           new_num_channels);
+		pvar->fwd_state.channels = p;
+		ids = (int *) realloc(pvar->fwd_state.free_channels, sizeof(int) * new_num);
+		if (ids == NULL) {
+			return -1;
+		}
+		pvar->fwd_state.free_channels = ids;
 
-		for (; i < new_num_channels; i++) {
-			channel = pvar->fwd_state.channels + i;
+		memset(&p[old_num], 0, sizeof(FWDChannel) * (new_num - old_num));
+		for (i = old_num; i < new_num; i++) {
+			FWDChannel *channel = p + i;
 
 			channel->status = 0;
 			channel->local_socket = INVALID_SOCKET;
+			channel->hash_next = -1;
 			channel->request_num = -1;
-			channel->filter = NULL;
-			channel->filter_closure = NULL;
+			channel->type = TYPE_PORTFWD;
 			UTIL_init_sock_write_buf(&channel->writebuf);
 		}
+		// Ⴂԍg悤tɐς
+		for (i = new_num - 1; i >= old_num; i--) {
+			ids[pvar->fwd_state.num_free_channels++] = i;
+		}
+		pvar->fwd_state.num_channels = new_num;
+		logprintf(LOG_LEVEL_VERBOSE, "%s: new num_channels %d", __FUNCTION__, new_num);
+	}
+
+	return pvar->fwd_state.free_channels[--pvar->fwd_state.num_free_channels];
+}
 
-		new_channel = pvar->fwd_state.num_channels;
-		pvar->fwd_state.num_channels = new_num_channels;
+static int alloc_channel(PTInstVar pvar, int new_status,
+                         int new_request_num)
+{
+	int new_channel;
+	FWDChannel *channel;
+
+	new_channel = get_free_channel(pvar);
+	if (new_channel < 0) {
+		return -1;
 	}
 
 	channel = pvar->fwd_state.channels + new_channel;
 
 	channel->status = new_status;
 	channel->request_num = new_request_num;
+	channel->type = TYPE_PORTFWD;
+	channel->write_suspended = FALSE;
 	pvar->fwd_state.requests[new_request_num].num_channels++;
 	UTIL_init_sock_write_buf(&channel->writebuf);
 
@@ -500,26 +593,12 @@ static int alloc_channel(PTInstVar pvar, int new_status,
 
 static int alloc_agent_channel(PTInstVar pvar, int remote_channel_num)
 {
-	int i;
-	int new_num_channels;
-	int new_channel = -1;
+	int new_channel;
 	FWDChannel *channel;
 
-	for (i = 0; i < pvar->fwd_state.num_channels && new_channel < 0; i++) {
-		if (pvar->fwd_state.channels[i].status == 0) {
-			new_channel = i;
-		}
-	}
-
+	new_channel = get_free_channel(pvar);
 	if (new_channel < 0) {
-		new_num_channels = pvar->fwd_state.num_channels + 1;
-		pvar->fwd_state.channels =
-			(FWDChannel *) realloc(pvar->fwd_state.channels,
-			                           sizeof(FWDChannel) *
-			                           new_num_channels);
-
-		new_channel = pvar->fwd_state.num_channels;
-		pvar->fwd_state.num_channels = new_num_channels;
+		return -1;
 	}
 
 	channel = pvar->fwd_state.channels + new_channel;
@@ -571,16 +650,17 @@ static void make_local_connection(PTInstVar pvar, int channel_num)
 	for (channel->to_host_addrs = request->to_host_addrs;
 	     channel->to_host_addrs;
 	     channel->to_host_addrs = channel->to_host_addrs->ai_next) {
-		channel->local_socket = socket(channel->to_host_addrs->ai_family,
-		                               channel->to_host_addrs->ai_socktype,
-		                               channel->to_host_addrs->ai_protocol);
+		set_channel_socket(pvar, channel_num,
+		                   socket(channel->to_host_addrs->ai_family,
+		                          channel->to_host_addrs->ai_socktype,
+		                          channel->to_host_addrs->ai_protocol));
 		if (channel->local_socket == INVALID_SOCKET)
 			continue;
 		if (WSAAsyncSelect
 		    (channel->local_socket, make_accept_wnd(pvar), WM_SOCK_IO,
 		     FD_CONNECT | FD_READ | FD_CLOSE | FD_WRITE) == SOCKET_ERROR) {
 			closesocket(channel->local_socket);
-			channel->local_socket = INVALID_SOCKET;
+			set_channel_socket(pvar, channel_num, INVALID_SOCKET);
 			continue;
 		}
 		if (connect(channel->local_socket,
@@ -594,7 +674,7 @@ static void make_local_connection(PTInstVar pvar, int channel_num)
 		} else {
 			/* connect() failed */
 			closesocket(channel->local_socket);
-			channel->local_socket = INVALID_SOCKET;
+			set_channel_socket(pvar, channel_num, INVALID_SOCKET);
 			continue;
 		}
 	}
@@ -639,9 +719,13 @@ static void accept_local_connection(PTInstVar pvar, int request_num, int listeni
 	port = atoi(strport);
 
 	channel_num = alloc_channel(pvar, FWD_LOCAL_CONNECTED, request_num);
+	if (channel_num < 0) {
+		safe_closesocket(pvar, s);
+		return;
+	}
 	channel = pvar->fwd_state.channels + channel_num;
 
-	channel->local_socket = s;
+	set_channel_socket(pvar, channel_num, s);
 
 	if (request->spec.type == FWD_LOCAL_TO_REMOTE) {
 		logprintf(LOG_LEVEL_VERBOSE,
@@ -685,6 +769,18 @@ static void write_local_connection_buffer(PTInstVar pvar, int channel_num)
 		if (!UTIL_sock_write_more
 			(pvar, &channel->writebuf, channel->local_socket)) {
 			channel_error(pvar, "writing", channel_num, WSAGetLastError());
+			return;
+		}
+		if (channel->write_suspended && channel->writebuf.datalen <= FWD_WRITE_LOW_WATER_MARK(pvar)) {
+			// ݂ǂ̂ŁASSHT[owindow size̍XVĊJ
+			Channel_t *c = ssh2_local_channel_lookup(channel_num);
+
+			channel->write_suspended = FALSE;
+			logprintf(LOG_LEVEL_NOTICE, "%s: channel=%d write resumed, %d bytes queued",
+			          __FUNCTION__, channel_num, channel->writebuf.datalen);
+			if (c != NULL) {
+				SSH2_resume_channel_window(pvar, c);
+			}
 		}
 		if (channel->writebuf.datalen == 0 && (channel->status & FWD_CLOSED_REMOTE_IN) == FWD_CLOSED_REMOTE_IN) {
 			// NCAgւ̃f[^ׂđIĂA[g EOF Mς݂Ȃ
@@ -700,9 +796,19 @@ static void write_local_connection_buffer(PTInstVar pvar, int channel_num)
 	}
 }
 
-static void read_local_connection(PTInstVar pvar, int channel_num)
+/*
+ * [Jǂ񂾃f[^ readbuf ɂ߂āAȂׂ remote_maxpacket
+ * (remote_window 菬 remote_window) ̑傫
+ * CHANNEL_DATA ɂ܂Ƃ߂đB
+ * ǂރf[^ȂȂ_Ŏc͑邪AOɖt̃pPbg
+ * Ă(ʓ])ꍇA[ CHANNEL_COALESCE_DELAY ms
+ * ҂Č㑱̃f[^Ƃ܂Ƃ߂BΘbIȒʐM͒xȂB
+ */
+static void recv_local_connection(PTInstVar pvar, int channel_num)
 {
 	FWDChannel *channel = pvar->fwd_state.channels + channel_num;
+	BOOL sent_full = FALSE;
+	int limit = CHANNEL_READ_BUF_SIZE;
 
 	logprintf(LOG_LEVEL_VERBOSE, "%s: channel=%d", __FUNCTION__, channel_num);
 
@@ -711,58 +817,107 @@ static void read_local_connection(PTInstVar pvar, int channel_num)
 	}
 
 	while (channel->local_socket != INVALID_SOCKET) {
-		char buf[CHANNEL_READ_BUF_SIZE];
+		Channel_t *c = NULL;
+		int packet_size = CHANNEL_READ_BUF_SIZE;
 		int amount;
 		int err = ERROR_SUCCESS;
 
 		// recv̈ꎞ~Ȃ΁Aɖ߂B
 		if (SSHv2(pvar)) {
-			Channel_t* c = ssh2_local_channel_lookup(channel_num);
+			c = ssh2_local_channel_lookup(channel_num);
 			// ڑmĂȂԂ̊Ԃ c == NULL ԂĂ
 			if (c != NULL && c->bufchain_recv_suspended) {
 				logprintf(LOG_LEVEL_NOTICE, "%s: channel=%d recv was skipped for flow control",
 					__FUNCTION__, channel_num);
+				flush_local_read_buffer(pvar, channel_num);
 				return;
 			}
 		}
 
+		// 1ɑ傫߂
+		if (c != NULL && c->remote_maxpacket > 0) {
+			packet_size = (int)min(c->remote_maxpacket, CHANNEL_READ_BUF_MAX);
+		}
+		limit = packet_size;
+		if (c != NULL && c->remote_window > 0 && c->remote_window < (unsigned int)limit) {
+			limit = (int)c->remote_window;
+		}
+
+		if (channel->readbuf_size < packet_size) {
+			char *p = realloc(channel->readbuf, packet_size);
+			if (p == NULL) {
+				channel_error(pvar, "reading", channel_num, WSAENOBUFS);
+				return;
+			}
+			channel->readbuf = p;
+			channel->readbuf_size = packet_size;
+		}
+		if (channel->filter != NULL || channel->readbuf_len >= limit) {
+			flush_local_read_buffer(pvar, channel_num);
+		}
+
 		// M(mubLO[h)
-		amount = recv(channel->local_socket, buf, sizeof(buf), 0);
+		amount = recv(channel->local_socket, channel->readbuf + channel->readbuf_len,
+		              limit - channel->readbuf_len, 0);
 
 		if (amount > 0) {
 			// Mf[^
-			char *new_buf = buf;
-			FwdFilterResult action = FWD_FILTER_RETAIN;
-
 #if 1
 			logprintf(LOG_LEVEL_VERBOSE, "%s: recv()=%d", __FUNCTION__, amount);
 #else
-			logprintf_hexdump(LOG_LEVEL_VERBOSE, buf, amount, "%s: recv()=%d", __FUNCTION__, amount);
+			logprintf_hexdump(LOG_LEVEL_VERBOSE, channel->readbuf + channel->readbuf_len, amount,
+			                  "%s: recv()=%d", __FUNCTION__, amount);
 #endif
 
 			if (channel->filter != NULL) {
+				// filter (SOCKS Ȃ) ɂ͎M܂܂̒Pʂœn
+				char *new_buf = channel->readbuf;
+				FwdFilterResult action;
+
 				action = channel->filter(channel->filter_closure, FWD_FILTER_FROM_CLIENT, &amount, (unsigned char**)&new_buf);
-			}
 
-			if (amount > 0 && (channel->status & FWD_CLOSED_REMOTE_OUT) == 0) {
-				// |[gtH[fBOɂăNCAg̑MvASSHʐMɏ悹ăT[o܂ő͂B
-				SSH_channel_send(pvar, channel_num, channel->remote_num, new_buf, amount, 0);
-			}
+				if (amount > 0 && (channel->status & FWD_CLOSED_REMOTE_OUT) == 0) {
+					// |[gtH[fBOɂăNCAg̑MvASSHʐMɏ悹ăT[o܂ő͂B
+					SSH_channel_send(pvar, channel_num, channel->remote_num, new_buf, amount, 0);
+				}
 
-			switch (action) {
-			case FWD_FILTER_REMOVE:
-				channel->filter(channel->filter_closure, FWD_FILTER_CLEANUP, NULL, NULL);
-				channel->filter = NULL;
-				channel->filter_closure = NULL;
-				break;
-			case FWD_FILTER_CLOSECHANNEL:
-				closed_local_connection(pvar, channel_num);
-				break;
+				switch (action) {
+				case FWD_FILTER_REMOVE:
+					channel->filter(channel->filter_closure, FWD_FILTER_CLEANUP, NULL, NULL);
+					channel->filter = NULL;
+					channel->filter_closure = NULL;
+					break;
+				case FWD_FILTER_CLOSECHANNEL:
+					closed_local_connection(pvar, channel_num);
+					break;
+				}
+			}
+			else {
+				channel->readbuf_len += amount;
+				if (channel->readbuf_len >= limit) {
+					flush_local_read_buffer(pvar, channel_num);
+					sent_full = TRUE;
+				}
 			}
 		} else if (amount == 0 || (err = WSAGetLastError()) == WSAEWOULDBLOCK) {
 			// Mf[^Ȃ
-			logprintf(LOG_LEVEL_VERBOSE, "%s: recv()=%d err=%s(%d)", __FUNCTION__, amount,
-					  err == WSAEWOULDBLOCK ? "WSAEWOULDBLOCK" : "-", err);
+			logprintf(LOG_LEVEL_VERBOSE, "%s: recv()=%d err=%s(%d) pending=%d", __FUNCTION__, amount,
+					  err == WSAEWOULDBLOCK ? "WSAEWOULDBLOCK" : "-", err, channel->readbuf_len);
+			if (amount != 0 && sent_full && channel->readbuf_len > 0 && channel->readbuf_len < limit / 2) {
+				// ʓ]̒[Ȃ̂ŁA҂Č㑱̃f[^Ƃ܂Ƃ߂
+				if (!channel->read_timer) {
+					if (SetTimer(pvar->fwd_state.accept_wnd, FWD_COALESCE_TIMER_ID(channel_num),
+					             CHANNEL_COALESCE_DELAY, NULL) != 0) {
+						channel->read_timer = TRUE;
+					}
+				}
+				if (!channel->read_timer) {
+					flush_local_read_buffer(pvar, channel_num);
+				}
+			}
+			else {
+				flush_local_read_buffer(pvar, channel_num);
+			}
 			return;
 		} else {
 			channel_error(pvar, "reading", channel_num, err);
@@ -771,6 +926,14 @@ static void read_local_connection(PTInstVar pvar, int channel_num)
 	}
 }
 
+// ǂ߂邾ǂōpPbǵA܂Ƃ߂1 send() ő
+static void read_local_connection(PTInstVar pvar, int channel_num)
+{
+	SSH_begin_send_batch(pvar);
+	recv_local_connection(pvar, channel_num);
+	SSH_end_send_batch(pvar);
+}
+
 static void failed_to_host_addr(PTInstVar pvar, int request_num, int err)
 {
 	int i;
@@ -793,6 +956,15 @@ static void found_to_host_addr(PTInstVar pvar, int request_num)
 	}
 }
 
+// [Jւ݂̏܂ĂāASSHwindow̍XV~߂Ă邩
+BOOL FWD_is_write_suspended(PTInstVar pvar, int local_channel_num)
+{
+	if (!FWD_check_local_channel_num(pvar, local_channel_num))
+		return FALSE;
+
+	return pvar->fwd_state.channels[local_channel_num].write_suspended;
+}
+
 // local connection̎M̒~эĊJ̔fs
 //
 // notify: TRUE    recvĊJ
@@ -928,10 +1100,10 @@ static LRESULT CALLBACK accept_wnd_proc(HWND wnd, UINT msg, WPARAM wParam,
 							 channel->to_host_addrs;
 							 channel->to_host_addrs =
 							 channel->to_host_addrs->ai_next) {
-							channel->local_socket =
+							set_channel_socket(pvar, channel_num,
 								socket(channel->to_host_addrs->ai_family,
 								       channel->to_host_addrs->ai_socktype,
-								       channel->to_host_addrs->ai_protocol);
+								       channel->to_host_addrs->ai_protocol));
 							if (channel->local_socket == INVALID_SOCKET)
 								continue;
 							if (WSAAsyncSelect
@@ -940,7 +1112,7 @@ static LRESULT CALLBACK accept_wnd_proc(HWND wnd, UINT msg, WPARAM wParam,
 							     FD_CONNECT | FD_READ | FD_CLOSE | FD_WRITE
 							    ) == SOCKET_ERROR) {
 								closesocket(channel->local_socket);
-								channel->local_socket = INVALID_SOCKET;
+								set_channel_socket(pvar, channel_num, INVALID_SOCKET);
 								continue;
 							}
 							if (connect(channel->local_socket,
@@ -955,7 +1127,7 @@ static LRESULT CALLBACK accept_wnd_proc(HWND wnd, UINT msg, WPARAM wParam,
 								return TRUE;
 							} else {
 								closesocket(channel->local_socket);
-								channel->local_socket = INVALID_SOCKET;
+								set_channel_socket(pvar, channel_num, INVALID_SOCKET);
 								continue;
 							}
 						}
@@ -987,6 +1159,17 @@ static LRESULT CALLBACK accept_wnd_proc(HWND wnd, UINT msg, WPARAM wParam,
 			}
 			return TRUE;
 		}
+
+	case WM_TIMER:{
+			int channel_num = (int)(wParam - FWD_COALESCE_TIMER_ID(0));
+
+			if (channel_num >= 0 && channel_num < pvar->fwd_state.num_channels) {
+				// [܂Ƃ߂҂Ԃ߂̂ő
+				flush_local_read_buffer(pvar, channel_num);
+				return 0;
+			}
+			break;
+		}
 	}
 
 	return CallWindowProc(pvar->fwd_state.old_accept_wnd_proc, wnd, msg,
@@ -1618,6 +1801,10 @@ static void create_local_channel(PTInstVar pvar, uint32 remote_channel_num,
 	}
 
 	channel_num = alloc_channel(pvar, FWD_REMOTE_CONNECTED, request_num);
+	if (channel_num < 0) {
+		SSH_fail_channel_open(pvar, remote_channel_num);
+		return;
+	}
 	channel = pvar->fwd_state.channels + channel_num;
 
 	channel->remote_num = remote_channel_num;
@@ -1812,45 +1999,6 @@ void FWD_failed_open(PTInstVar pvar, uint32 local_channel_num, int reason)
 	FWD_free_channel(pvar, local_channel_num);
 }
 
-static BOOL blocking_write(PTInstVar pvar, SOCKET s, const char *data,
-                           int length)
-{
-	u_long do_block = 0;
-
-#if 0
-	return (pvar->PWSAAsyncSelect) (s, make_accept_wnd(pvar), 0,
-	                                0) == SOCKET_ERROR
-	    || ioctlsocket(s, FIONBIO, &do_block) == SOCKET_ERROR
-	    || (pvar->Psend) (s, data, length, 0) != length
-	    || (pvar->PWSAAsyncSelect) (s, pvar->fwd_state.accept_wnd,
-	                                WM_SOCK_ACCEPT,
-	                                FD_READ | FD_CLOSE | FD_WRITE) == SOCKET_ERROR;
-#else
-	if ( (pvar->PWSAAsyncSelect) (s, make_accept_wnd(pvar), 0, 0) == SOCKET_ERROR ) {
-			goto error;
-	}
-
-	if ( ioctlsocket(s, FIONBIO, &do_block) == SOCKET_ERROR ) {
-			goto error;
-	}
-
-	if ( (pvar->Psend) (s, data, length, 0) != length ) {
-			goto error;
-	}
-
-	if ( (pvar->PWSAAsyncSelect) (s, pvar->fwd_state.accept_wnd,
-	                                WM_SOCK_ACCEPT,
-									FD_READ | FD_CLOSE | FD_WRITE) == SOCKET_ERROR ) {
-			goto error;
-	}
-
-	return (TRUE);
-
-error:
-	return (FALSE);
-#endif
-}
-
 void FWD_received_data(PTInstVar pvar, uint32 local_channel_num,
                        unsigned char *data, int length)
 {
@@ -1869,12 +2017,12 @@ void FWD_received_data(PTInstVar pvar, uint32 local_channel_num,
 
 	s = channel->local_socket;
 	if (length > 0 && s != INVALID_SOCKET) {
-		// SSHT[oXAvP[V瑗ĂX11f[^A
-		// Tera TermƓPCɓĂXT[oɁAubLO[hgāA
-		// MB
-		// XT[oɑMɔ FD_WRITE ́AKvȂߖB
+		// SSHT[o瑗Ăf[^A[J̃\Pbg֑MB
+		// \Pbg̓mubLÔ܂܂ɂāAȂ̓`lƂ
+		// writebuf ɗ߁AFD_WRITE őB肪ǂ܂ȂȂĂATera Term 
+		// ̃`l~܂邱Ƃ͂ȂB
 		//OutputDebugPrintf("%s: send %d\n", __FUNCTION__, length);
-		if (!UTIL_sock_buffered_write(pvar, &channel->writebuf, blocking_write, s, data, length)) {
+		if (!UTIL_sock_queued_write(pvar, &channel->writebuf, s, data, length)) {
 			closed_local_connection(pvar, local_channel_num);
 
 			UTIL_get_lang_msg("MSG_FWD_COMM_ERROR", pvar,
@@ -1888,6 +2036,13 @@ void FWD_received_data(PTInstVar pvar, uint32 local_channel_num,
 				logputs(LOG_LEVEL_ERROR, pvar->UIMsg);
 			}
 		}
+		else if (SSHv2(pvar) && !channel->write_suspended &&
+		         channel->writebuf.datalen >= pvar->session_settings.WriteBufferSize) {
+			// ܂肷̂ŁAFD_WRITE Ō܂SSHT[owindow sizeXVȂ
+			channel->write_suspended = TRUE;
+			logprintf(LOG_LEVEL_NOTICE, "%s: channel=%d write suspended, %d bytes queued",
+			          __FUNCTION__, local_channel_num, channel->writebuf.datalen);
+		}
 	}
 
 	switch (action) {
@@ -1904,12 +2059,19 @@ void FWD_received_data(PTInstVar pvar, uint32 local_channel_num,
 
 void FWD_init(PTInstVar pvar)
 {
+	int i;
+
 	pvar->fwd_state.requests = NULL;
 	pvar->fwd_state.num_requests = 0;
 	pvar->fwd_state.num_server_listening_specs = -1;	/* forwarding prep not yet done */
 	pvar->fwd_state.server_listening_specs = NULL;
 	pvar->fwd_state.num_channels = 0;
 	pvar->fwd_state.channels = NULL;
+	pvar->fwd_state.free_channels = NULL;
+	pvar->fwd_state.num_free_channels = 0;
+	for (i = 0; i < FWD_SOCKET_HASH_SIZE; i++) {
+		pvar->fwd_state.socket_hash[i] = -1;
+	}
 	pvar->fwd_state.X11_auth_data = NULL;
 	pvar->fwd_state.accept_wnd = NULL;
 	pvar->fwd_state.in_interactive_mode = FALSE;
@@ -1925,6 +2087,7 @@ void FWD_end(PTInstVar pvar)
 		}
 		free(pvar->fwd_state.channels);
 	}
+	free(pvar->fwd_state.free_channels);
 
 	if (pvar->fwd_state.requests != NULL) {
 		for (i = 0; i < pvar->fwd_state.num_requests; i++) {
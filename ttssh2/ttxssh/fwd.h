@@ -40,6 +40,11 @@ See LICENSE.TXT for the license.
 #define FWD_HIGH_WATER_MARK (1 * 1024 * 1024)  // 1MB
 #define FWD_LOW_WATER_MARK (0)  // 0MB
 
+// [Jւ݂̏܂ɁASSHwindow̍XV~߂臒l
+// Kp FWDChannel.writebuf.datalen
+//    WriteBufferSize ݒA͂ 1/4
+#define FWD_WRITE_LOW_WATER_MARK(pvar) ((pvar)->session_settings.WriteBufferSize / 4)
+
 #define FWD_REMOTE_CONNECTED  0x01
 #define FWD_LOCAL_CONNECTED   0x02
 #define FWD_BOTH_CONNECTED    (FWD_REMOTE_CONNECTED | FWD_LOCAL_CONNECTED)
@@ -70,6 +75,12 @@ typedef struct {
   SOCKET local_socket;
   int request_num;
   UTILSockWriteBuf writebuf;
+  BOOL write_suspended;  // writebuf ܂Ă̂ window XVȂ
+  int hash_next;         // socket_hash ̓oPcɂȂ鎟̃`lԍ (-1 ŏI[)
+  char *readbuf;         // [Jǂ񂾂A܂ SSH őĂȂf[^
+  int readbuf_size;
+  int readbuf_len;
+  BOOL read_timer;       // readbuf ̑o҂^C}[Ă
 
   void *filter_closure;
   FWDFilter filter;
@@ -116,6 +127,9 @@ typedef struct {
 #define FWD_DELETED                      0x01
 
 #define MAX_LISTENING_SOCKETS 4096
+
+// local_socket  `lԍ̃nbV\̑傫 (2ׂ̂)
+#define FWD_SOCKET_HASH_SIZE 256
 typedef struct {
   int num_listening_sockets;
   SOCKET *listening_sockets;
@@ -138,6 +152,9 @@ typedef struct {
   FWDRequest *requests;
   int num_channels;
   FWDChannel *channels;
+  int *free_channels;      // 󂫃`lԍ̃X^bN
+  int num_free_channels;   // free_channels ɐς܂Ă鐔
+  int socket_hash[FWD_SOCKET_HASH_SIZE];  // oPc擪̃`lԍ (-1 ͋)
   struct _X11AuthData *X11_auth_data;
   BOOL in_interactive_mode;
 } FWDState;
@@ -170,5 +187,6 @@ int FWD_check_local_channel_num(PTInstVar pvar, int local_num);
 int FWD_agent_open(PTInstVar pvar, uint32 remote_channel_num);
 BOOL FWD_agent_forward_confirm(PTInstVar pvar);
 void FWD_suspend_resume_local_connection(PTInstVar pvar, Channel_t* c, int notify);
+BOOL FWD_is_write_suspended(PTInstVar pvar, int local_channel_num);
 
 #endif
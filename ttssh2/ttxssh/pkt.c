@@ -53,21 +53,33 @@ void PKT_init(PTInstVar pvar)
 static int recv_data(PTInstVar pvar, unsigned long up_to_amount)
 {
 	int amount_read;
+	char *tail;
 
-	/* Shuffle data to the start of the buffer */
-	if (pvar->pkt_state.datastart != 0) {
-		memmove(pvar->pkt_state.buf,
-		        pvar->pkt_state.buf + pvar->pkt_state.datastart,
-		        pvar->pkt_state.datalen);
+	/* ̃f[^Ȃ擪g */
+	if (pvar->pkt_state.datalen == 0) {
 		pvar->pkt_state.datastart = 0;
 	}
 
-	buf_ensure_size(&pvar->pkt_state.buf, &pvar->pkt_state.buflen, up_to_amount);
+	/*
+	 * obt@ up_to_amount 2{mۂĂAς݂̃f[^
+	 * datastart i߂邾Ŏ̂ĂBɋ󂫂ȂȂ
+	 * ̃f[^擪֋l߂B
+	 * (pPbg͂̏ŕ̂ŁAÔ悤ɐ܂ԂƂ͂Ȃ)
+	 */
+	buf_ensure_size(&pvar->pkt_state.buf, &pvar->pkt_state.buflen, up_to_amount * 2);
 
 	_ASSERT(pvar->pkt_state.buf != NULL);
 
+	if (pvar->pkt_state.datastart + up_to_amount > pvar->pkt_state.buflen) {
+		memmove(pvar->pkt_state.buf,
+		        pvar->pkt_state.buf + pvar->pkt_state.datastart,
+		        pvar->pkt_state.datalen);
+		pvar->pkt_state.datastart = 0;
+	}
+
+	tail = pvar->pkt_state.buf + pvar->pkt_state.datastart + pvar->pkt_state.datalen;
 	amount_read = (pvar->Precv) (pvar->socket,
-	                             pvar->pkt_state.buf + pvar->pkt_state.datalen,
+	                             tail,
 	                             up_to_amount - pvar->pkt_state.datalen,
 	                             0);
 
@@ -77,7 +89,7 @@ static int recv_data(PTInstVar pvar, unsigned long up_to_amount)
 			int i;
 
 			for (i = 0; i < amount_read; i++) {
-				if (pvar->pkt_state.buf[pvar->pkt_state.datalen + i] == '\n') {
+				if (tail[i] == '\n') {
 					pvar->pkt_state.seen_newline = 1;
 				}
 			}
@@ -150,16 +162,17 @@ int PKT_recv(PTInstVar pvar, char *buf, int buflen)
 			 * We're looking for the initial ID string and either we've seen the
 			 * terminating newline, or we've exceeded the limit at which we should see a newline.
 			 */
+			char *id = pvar->pkt_state.buf + pvar->pkt_state.datastart;
 			unsigned int i;
 
-			for (i = 0; pvar->pkt_state.buf[i] != '\n' && i < pvar->pkt_state.datalen; i++) {
+			for (i = 0; id[i] != '\n' && i < pvar->pkt_state.datalen; i++) {
 			}
-			if (pvar->pkt_state.buf[i] == '\n') {
+			if (id[i] == '\n') {
 				i++;
 			}
 
 			// SSHT[õo[W`FbNs
-			if (SSH_handle_server_ID(pvar, pvar->pkt_state.buf, i)) {
+			if (SSH_handle_server_ID(pvar, id, i)) {
 				pvar->pkt_state.seen_server_ID = 1;
 
 				if (SSHv2(pvar)) {
@@ -48,6 +48,7 @@
 #include "fwd.h"
 #include "ssh.h"
 #include "sftp.h"
+#include "codeconv.h"
 
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -139,6 +140,72 @@ static const struct CMD cmds[] = {
 static PTInstVar g_pvar;
 static Channel_t *g_channel;
 
+// ڑIOɃ}N󂯕tR}h
+typedef struct sftp_pending {
+	char *cmdline;
+	struct sftp_pending *next;
+} sftp_pending_t;
+
+static sftp_pending_t *g_pending;
+static BOOL g_opening;
+
+// get/put Ȃǂ̓]Wu
+enum sftp_job_type {
+	SFTP_JOB_GET, SFTP_JOB_PUT, SFTP_JOB_CHDIR,
+};
+
+typedef struct sftp_job {
+	enum sftp_job_type type;
+	char *remote;      // [g̃pX (UTF-8)
+	char *local;       // [J̃pX (UTF-8)
+	int resume;        // ɂ镪̑]
+	int recursive;     // fBNgċAIɓ]
+	struct sftp_job *next;
+} sftp_job_t;
+
+// ҂ READ/WRITE v
+typedef struct sftp_request {
+	int used;
+	unsigned int id;
+	unsigned long long offset;
+	unsigned int len;
+} sftp_request_t;
+
+enum sftp_xfer_state {
+	SFTP_XFER_IDLE,
+	SFTP_XFER_STAT,
+	SFTP_XFER_OPEN,
+	SFTP_XFER_DATA,
+	SFTP_XFER_CLOSE,
+	SFTP_XFER_MKDIR,
+	SFTP_XFER_OPENDIR,
+	SFTP_XFER_READDIR,
+	SFTP_XFER_CLOSEDIR,
+	SFTP_XFER_REALPATH,
+};
+
+typedef struct sftp_xfer {
+	enum sftp_xfer_state state;
+	sftp_job_t *job;                 // ̃Wu
+	unsigned int ctl_id;             // READ/WRITE ȊO̗v ID
+	char *handle;                    // [g̃t@C/fBNg̃nh
+	unsigned int handle_len;
+	FILE *localfp;
+	unsigned long long local_pos;    // localfp ݈̌ʒu
+	unsigned long long filesize;     // sȏꍇ͍ől
+	unsigned long long start_offset; // ĊJʒu
+	unsigned long long next_offset;  // ɗvʒu
+	unsigned long long transferred;
+	int eof;
+	int error;
+	unsigned int num_req;            // ҂̗v
+	sftp_request_t *reqs;            // num_requests 
+	DWORD start_tick;
+	DWORD bw_tick;                   // ш搧̋Ԃ̊Jn
+	unsigned long long bw_bytes;     // bw_tick ȍ~ɗv
+	UINT_PTR bw_timer;
+} sftp_xfer_t;
+
 static void sftp_console_message(PTInstVar pvar, Channel_t *c, char *fmt, ...)
 {
 	char tmp[1024];
@@ -190,42 +257,22 @@ static void sftp_buffer_free(buffer_t *message)
 static void sftp_send_msg(PTInstVar pvar, Channel_t *c, buffer_t *msg)
 {
 	char *p;
-	int len;
+	unsigned int len, n;
 
 	len = buffer_len(msg);
 	p = buffer_ptr(msg);
 	// ŏɃbZ[WTCYi[B
 	set_uint32(p, len - 4);
-	// yC[h̑MB
-	SSH2_send_channel_data(pvar, c, p, len, 0);
-}
-
-// T[oMSFTPpPbgobt@Ɋi[B
-static void sftp_get_msg(PTInstVar pvar, Channel_t *c, unsigned char *data, unsigned int buflen, buffer_t **message)
-{
-	buffer_t *msg = *message;
-	int msg_len;
-
-	// obt@mۂAf[^ׂĕ荞ށBȍ~ buffer_t ^ʂđ삷B
-	// ق OpenSSH ̃R[hƂ̐eaǂȂ邽߁B
-	buffer_clear(msg);
-	buffer_append(msg, data, buflen);
-	buffer_rewind(msg);
-
-	msg_len = buffer_get_int(msg);
-	if (msg_len > SFTP_MAX_MSG_LENGTH) {
-		// TODO:
-		sftp_syslog(pvar, "Received message too long %u", msg_len);
-		goto error;
-	}
-	if (msg_len + 4 != buflen) {
-		// TODO:
-		sftp_syslog(pvar, "Buffer length %u is invalid", buflen);
-		goto error;
+	// yC[h̑MB̍őpPbgTCY𒴂镪͕đB
+	while (len > 0) {
+		n = len;
+		if (c->remote_maxpacket > 0 && n > c->remote_maxpacket) {
+			n = c->remote_maxpacket;
+		}
+		SSH2_send_channel_data(pvar, c, p, n, 0);
+		p += n;
+		len -= n;
 	}
-
-error:
-	return;
 }
 
 static void sftp_send_string_request(PTInstVar pvar, Channel_t *c, unsigned int id, unsigned int code,
@@ -252,10 +299,31 @@ void sftp_do_init(PTInstVar pvar, Channel_t *c)
 	// SFTPǗ\̂̏
 	memset(&c->sftp, 0, sizeof(c->sftp));
 	c->sftp.state = SFTP_INIT;
-	c->sftp.transfer_buflen = DEFAULT_COPY_BUFLEN;
-	c->sftp.num_requests = DEFAULT_NUM_REQUESTS;
+	c->sftp.transfer_buflen = pvar->settings.SftpBlockSize;
+	if (c->sftp.transfer_buflen < SFTP_MIN_COPY_BUFLEN) {
+		c->sftp.transfer_buflen = SFTP_MIN_COPY_BUFLEN;
+	}
+	if (c->sftp.transfer_buflen > SFTP_MAX_COPY_BUFLEN) {
+		c->sftp.transfer_buflen = SFTP_MAX_COPY_BUFLEN;
+	}
+	c->sftp.num_requests = pvar->settings.SftpRequests;
+	if (c->sftp.num_requests < 1) {
+		c->sftp.num_requests = 1;
+	}
+	if (c->sftp.num_requests > SFTP_MAX_NUM_REQUESTS) {
+		c->sftp.num_requests = SFTP_MAX_NUM_REQUESTS;
+	}
 	c->sftp.exts = 0;
-	c->sftp.limit_kbps = 0;
+	c->sftp.limit_kbps = (pvar->settings.SftpLimitKbps > 0) ? pvar->settings.SftpLimitKbps : 0;
+
+	c->sftp.xfer = calloc(1, sizeof(sftp_xfer_t));
+	if (c->sftp.xfer != NULL) {
+		c->sftp.xfer->reqs = calloc(c->sftp.num_requests, sizeof(sftp_request_t));
+		if (c->sftp.xfer->reqs == NULL) {
+			free(c->sftp.xfer);
+			c->sftp.xfer = NULL;
+		}
+	}
 
 	// lSVG[V̊Jn
 	sftp_buffer_alloc(&msg);
@@ -314,11 +382,6 @@ static void sftp_do_init_recv(PTInstVar pvar, Channel_t *c, buffer_t *msg)
 	if (c->sftp.version == 0) {
 		c->sftp.transfer_buflen = min(c->sftp.transfer_buflen, 20480);
 	}
-	c->sftp.limit_kbps = 0;
-	if (c->sftp.limit_kbps > 0) {
-		// TODO:
-	}
-
 	sftp_syslog(pvar, "Connected to SFTP server.");
 
 error:
@@ -364,47 +427,1136 @@ static const char *fx2txt(int status)
     /* NOTREACHED */
 }
 
-static char *sftp_do_realpath_recv(PTInstVar pvar, Channel_t *c, buffer_t *msg)
+static char *sftp_do_realpath_recv(PTInstVar pvar, Channel_t *c, buffer_t *msg)
+{
+	unsigned int type, expected_id, count, id;
+	char *filename = NULL, *longname;
+
+	type = buffer_get_char(msg);
+	id = buffer_get_int(msg);
+
+	expected_id = c->sftp.msg_id - 1;
+	if (id != expected_id) {
+		sftp_syslog(pvar, "ID mismatch (%u != %u)", id, expected_id);
+		goto error;
+	}
+
+	if (type == SSH2_FXP_STATUS) {
+		unsigned int status = buffer_get_int(msg);
+
+		sftp_syslog(pvar, "Couldn't canonicalise: %s", fx2txt(status));
+		goto error;
+	} else if (type != SSH2_FXP_NAME) {
+        sftp_syslog(pvar, "Expected SSH2_FXP_NAME(%u) packet, got %u",
+            SSH2_FXP_NAME, type);
+		goto error;
+	}
+
+	count = buffer_get_int(msg);
+	if (count != 1) {
+		sftp_syslog(pvar, "Got multiple names (%d) from SSH_FXP_REALPATH", count);
+		goto error;
+	}
+
+	filename = buffer_get_string_msg(msg, NULL);
+	longname = buffer_get_string_msg(msg, NULL);
+	//a = decode_attrib(&msg);
+
+	sftp_console_message(pvar, c, "SSH_FXP_REALPATH %s -> %s", c->sftp.path, filename);
+
+	free(longname);
+
+error:
+	return (filename);
+}
+
+/*
+ * t@C]GW
+ *
+ * get/put  sftp_job_t Ƃ c->sftp.jobs ɐς݁A擪1B
+ * t@C̒g READ/WRITE ő num_requests ܂ŉ҂ɑA
+ * sœ͂̓ItZbgŏƍďB
+ */
+
+// [g̑
+typedef struct sftp_attrib {
+	unsigned int flags;
+	unsigned long long size;
+	unsigned int perm;
+	unsigned int atime;
+	unsigned int mtime;
+} sftp_attrib_t;
+
+#define SFTP_S_IFMT   0170000
+#define SFTP_S_IFDIR  0040000
+#define SFTP_S_IFREG  0100000
+
+static void sftp_pump(PTInstVar pvar, Channel_t *c);
+static void sftp_next_job(PTInstVar pvar, Channel_t *c);
+
+static void sftp_put_uint64(buffer_t *msg, unsigned long long v)
+{
+	buffer_put_int(msg, (unsigned int)(v >> 32));
+	buffer_put_int(msg, (unsigned int)(v & 0xffffffff));
+}
+
+static void sftp_decode_attrib(buffer_t *msg, sftp_attrib_t *a)
+{
+	memset(a, 0, sizeof(*a));
+	a->flags = buffer_get_int(msg);
+	if (a->flags & SSH2_FILEXFER_ATTR_SIZE) {
+		a->size = (unsigned long long)buffer_get_int(msg) << 32;
+		a->size |= buffer_get_int(msg);
+	}
+	if (a->flags & SSH2_FILEXFER_ATTR_UIDGID) {
+		buffer_get_int(msg);
+		buffer_get_int(msg);
+	}
+	if (a->flags & SSH2_FILEXFER_ATTR_PERMISSIONS) {
+		a->perm = buffer_get_int(msg);
+	}
+	if (a->flags & SSH2_FILEXFER_ATTR_ACMODTIME) {
+		a->atime = buffer_get_int(msg);
+		a->mtime = buffer_get_int(msg);
+	}
+	if (a->flags & SSH2_FILEXFER_ATTR_EXTENDED) {
+		unsigned int i, count = buffer_get_int(msg);
+
+		for (i = 0; i < count && buffer_remain_len(msg) > 0; i++) {
+			free(buffer_get_string_msg(msg, NULL));
+			free(buffer_get_string_msg(msg, NULL));
+		}
+	}
+}
+
+// nhɎv (CLOSE, READDIR)
+static void sftp_send_handle_request(PTInstVar pvar, Channel_t *c, unsigned int id, unsigned int code,
+                                     char *handle, unsigned int handle_len)
+{
+	sftp_send_string_request(pvar, c, id, code, handle, handle_len);
+}
+
+// pXƑɎv (OPEN, MKDIR)
+static void sftp_send_open(PTInstVar pvar, Channel_t *c, unsigned int id, char *path, unsigned int pflags)
+{
+	buffer_t *msg;
+
+	sftp_buffer_alloc(&msg);
+	buffer_put_char(msg, SSH2_FXP_OPEN);
+	buffer_put_int(msg, id);
+	buffer_put_string(msg, path, strlen(path));
+	buffer_put_int(msg, pflags);
+	buffer_put_int(msg, 0);  // attrs
+	sftp_send_msg(pvar, c, msg);
+	sftp_syslog(pvar, "Sent message SSH2_FXP_OPEN I:%u P:%s M:0x%04x", id, path, pflags);
+	sftp_buffer_free(msg);
+}
+
+static void sftp_send_mkdir(PTInstVar pvar, Channel_t *c, unsigned int id, char *path)
+{
+	buffer_t *msg;
+
+	sftp_buffer_alloc(&msg);
+	buffer_put_char(msg, SSH2_FXP_MKDIR);
+	buffer_put_int(msg, id);
+	buffer_put_string(msg, path, strlen(path));
+	buffer_put_int(msg, SSH2_FILEXFER_ATTR_PERMISSIONS);
+	buffer_put_int(msg, 0777);
+	sftp_send_msg(pvar, c, msg);
+	sftp_syslog(pvar, "Sent message SSH2_FXP_MKDIR I:%u P:%s", id, path);
+	sftp_buffer_free(msg);
+}
+
+/*
+ * [Jt@C̑ (pX UTF-8)
+ */
+static FILE *sftp_fopen(const char *pathU8, const wchar_t *mode)
+{
+	wchar_t *pathW = ToWcharU8(pathU8);
+	FILE *fp = NULL;
+
+	if (pathW != NULL) {
+		_wfopen_s(&fp, pathW, mode);
+		free(pathW);
+	}
+	return fp;
+}
+
+static int sftp_stat(const char *pathU8, struct __stat64 *st)
+{
+	wchar_t *pathW = ToWcharU8(pathU8);
+	int r = -1;
+
+	if (pathW != NULL) {
+		r = _wstat64(pathW, st);
+		free(pathW);
+	}
+	return r;
+}
+
+static char *sftp_path_join(const char *dir, const char *name, char sep)
+{
+	size_t len = strlen(dir) + 1 + strlen(name) + 1;
+	char *p = malloc(len);
+
+	if (p == NULL) {
+		return NULL;
+	}
+	if (dir[0] != '\0' && dir[strlen(dir) - 1] != sep) {
+		_snprintf_s(p, len, _TRUNCATE, "%s%c%s", dir, sep, name);
+	}
+	else {
+		_snprintf_s(p, len, _TRUNCATE, "%s%s", dir, name);
+	}
+	return p;
+}
+
+static const char *sftp_basename(const char *path)
+{
+	const char *p = strrchr(path, '/');
+	const char *q = strrchr(path, '\\');
+
+	if (q > p) {
+		p = q;
+	}
+	return (p != NULL) ? p + 1 : path;
+}
+
+// [g̃t@C[J̃t@CƂĎg邩
+//   ؂蕶hCuw܂ނ́A"."/".."AfoCX͎gȂ
+static int sftp_local_name_ok(const char *name)
+{
+	static const char *devices[] = {
+		"CON", "PRN", "AUX", "NUL", "CONIN$", "CONOUT$",
+		"COM1", "COM2", "COM3", "COM4", "COM5", "COM6", "COM7", "COM8", "COM9",
+		"LPT1", "LPT2", "LPT3", "LPT4", "LPT5", "LPT6", "LPT7", "LPT8", "LPT9",
+	};
+	const unsigned char *p;
+	size_t len, base_len, i;
+
+	len = strlen(name);
+	if (len == 0 || strcmp(name, ".") == 0 || strcmp(name, "..") == 0) {
+		return 0;
+	}
+	for (p = (const unsigned char *)name; *p != '\0'; p++) {
+		if (*p < 0x20 || *p == '/' || *p == '\\' || *p == ':') {
+			return 0;
+		}
+	}
+	//  '.'  ' '  Windows 菜߁Aʂ̖OɂȂĂ܂
+	if (name[len - 1] == '.' || name[len - 1] == ' ') {
+		return 0;
+	}
+	// foCX͊gqĂĂfoCXw
+	base_len = strcspn(name, ". ");
+	for (i = 0; i < _countof(devices); i++) {
+		if (base_len == strlen(devices[i]) && _strnicmp(name, devices[i], base_len) == 0) {
+			return 0;
+		}
+	}
+	return 1;
+}
+
+// GetFullPathNameW() ̌ʂmۂĕԂ
+static wchar_t *sftp_full_path(const char *pathU8)
+{
+	wchar_t *pathW = ToWcharU8(pathU8);
+	wchar_t *full = NULL;
+	DWORD len;
+
+	if (pathW == NULL) {
+		return NULL;
+	}
+	len = GetFullPathNameW(pathW, 0, NULL, NULL);
+	if (len > 0) {
+		full = malloc(sizeof(wchar_t) * (len + 1));
+		if (full != NULL && GetFullPathNameW(pathW, len + 1, full, NULL) == 0) {
+			free(full);
+			full = NULL;
+		}
+	}
+	free(pathW);
+	return full;
+}
+
+// [J̃fBNg dir ̉ɁA[g̃t@C name ̃pX
+//   name gȂA܂ dir ̊OwƂ NULL ԂăOɎc
+static char *sftp_local_path_join(PTInstVar pvar, Channel_t *c, const char *dir, const char *name)
+{
+	char *local;
+	wchar_t *dir_full, *local_full;
+	int ok = 0;
+
+	if (!sftp_local_name_ok(name)) {
+		goto reject;
+	}
+	local = sftp_path_join(dir, name, '\\');
+	if (local == NULL) {
+		return NULL;
+	}
+
+	// Ô߁AKpX dir ̒ɂ邱Ƃm߂
+	dir_full = sftp_full_path(dir[0] != '\0' ? dir : ".");
+	local_full = sftp_full_path(local);
+	if (dir_full != NULL && local_full != NULL) {
+		size_t dir_len = wcslen(dir_full);
+		size_t local_len = wcslen(local_full);
+
+		if (dir_len > 0 && dir_full[dir_len - 1] == L'\\') {
+			dir_len--;
+		}
+		if (local_len > dir_len + 1 && _wcsnicmp(dir_full, local_full, dir_len) == 0 &&
+		    local_full[dir_len] == L'\\' && wcschr(local_full + dir_len + 1, L'\\') == NULL) {
+			ok = 1;
+		}
+	}
+	free(dir_full);
+	free(local_full);
+	if (ok) {
+		return local;
+	}
+	free(local);
+
+reject:
+	sftp_do_syslog(pvar, LOG_LEVEL_WARNING, "%s: refusing unsafe remote file name \"%s\"", __FUNCTION__, name);
+	sftp_console_message(pvar, c, "Skipping unsafe remote file name \"%s\"", name);
+	return NULL;
+}
+
+// ΃pXȂ烊[g̃JgfBNgOɂ
+static char *sftp_make_absolute(Channel_t *c, const char *path)
+{
+	if (path[0] == '/' || c->sftp.cwd[0] == '\0') {
+		return _strdup(path);
+	}
+	return sftp_path_join(c->sftp.cwd, path, '/');
+}
+
+/*
+ * WuǗ
+ */
+static void sftp_free_job(sftp_job_t *job)
+{
+	if (job != NULL) {
+		free(job->remote);
+		free(job->local);
+		free(job);
+	}
+}
+
+static sftp_job_t *sftp_add_job(Channel_t *c, enum sftp_job_type type, const char *remote, const char *local,
+                                int resume, int recursive)
+{
+	sftp_job_t *job = calloc(1, sizeof(sftp_job_t));
+
+	if (job == NULL) {
+		return NULL;
+	}
+	job->type = type;
+	job->remote = _strdup(remote);
+	job->local = (local != NULL) ? _strdup(local) : NULL;
+	job->resume = resume;
+	job->recursive = recursive;
+	if (job->remote == NULL || (local != NULL && job->local == NULL)) {
+		sftp_free_job(job);
+		return NULL;
+	}
+
+	if (c->sftp.jobs_tail != NULL) {
+		c->sftp.jobs_tail->next = job;
+	}
+	else {
+		c->sftp.jobs = job;
+	}
+	c->sftp.jobs_tail = job;
+	return job;
+}
+
+static sftp_request_t *sftp_find_request(Channel_t *c, unsigned int id)
+{
+	sftp_xfer_t *x = c->sftp.xfer;
+	unsigned int i;
+
+	for (i = 0; i < c->sftp.num_requests; i++) {
+		if (x->reqs[i].used && x->reqs[i].id == id) {
+			return &x->reqs[i];
+		}
+	}
+	return NULL;
+}
+
+static sftp_request_t *sftp_alloc_request(Channel_t *c)
+{
+	sftp_xfer_t *x = c->sftp.xfer;
+	unsigned int i;
+
+	for (i = 0; i < c->sftp.num_requests; i++) {
+		if (!x->reqs[i].used) {
+			x->reqs[i].used = 1;
+			return &x->reqs[i];
+		}
+	}
+	return NULL;
+}
+
+// ݂̃WuIāÃWuJn
+static void sftp_end_job(PTInstVar pvar, Channel_t *c)
+{
+	sftp_xfer_t *x = c->sftp.xfer;
+
+	if (x->localfp != NULL) {
+		fclose(x->localfp);
+	}
+	if (x->bw_timer != 0) {
+		KillTimer(NULL, x->bw_timer);
+	}
+	free(x->handle);
+	sftp_free_job(x->job);
+	memset(x->reqs, 0, sizeof(sftp_request_t) * c->sftp.num_requests);
+	{
+		sftp_request_t *reqs = x->reqs;
+		memset(x, 0, sizeof(*x));
+		x->reqs = reqs;
+	}
+
+	sftp_next_job(pvar, c);
+}
+
+static void sftp_job_error(PTInstVar pvar, Channel_t *c, const char *what, unsigned int status)
+{
+	sftp_job_t *job = c->sftp.xfer->job;
+
+	sftp_console_message(pvar, c, "%s \"%s\": %s", what,
+	                     (job->type == SFTP_JOB_PUT) ? job->local : job->remote, fx2txt(status));
+}
+
+/*
+ * ш搧
+ *   1bƂ limit_kbps ܂ŗvoA^C}[Ŏ1b܂ő҂B
+ */
+static VOID CALLBACK sftp_bwlimit_timer(HWND hwnd, UINT msg, UINT_PTR id, DWORD time)
+{
+	KillTimer(NULL, id);
+	if (g_channel != NULL && g_channel->sftp.xfer != NULL && g_channel->sftp.xfer->bw_timer == id) {
+		g_channel->sftp.xfer->bw_timer = 0;
+		sftp_pump(g_pvar, g_channel);
+	}
+}
+
+static BOOL sftp_bwlimit_wait(Channel_t *c, unsigned int len)
+{
+	sftp_xfer_t *x = c->sftp.xfer;
+	unsigned long long rate;
+	DWORD now, elapsed;
+
+	if (c->sftp.limit_kbps == 0) {
+		return FALSE;
+	}
+	if (x->bw_timer != 0) {
+		return TRUE;
+	}
+
+	rate = c->sftp.limit_kbps * 1024 / 8;
+	now = GetTickCount();
+	elapsed = now - x->bw_tick;
+	if (elapsed >= 1000) {
+		x->bw_tick = now;
+		x->bw_bytes = 0;
+		elapsed = 0;
+	}
+	// 1b̗ʂ傫ȗvłAԂ̍ŏ1͒ʂ
+	if (x->bw_bytes == 0 || x->bw_bytes + len <= rate) {
+		x->bw_bytes += len;
+		return FALSE;
+	}
+
+	x->bw_timer = SetTimer(NULL, 0, 1000 - elapsed, sftp_bwlimit_timer);
+	return (x->bw_timer != 0);
+}
+
+/*
+ * READ/WRITE ̑M
+ */
+static void sftp_send_read(PTInstVar pvar, Channel_t *c, sftp_request_t *req)
+{
+	sftp_xfer_t *x = c->sftp.xfer;
+	buffer_t *msg;
+
+	sftp_buffer_alloc(&msg);
+	buffer_put_char(msg, SSH2_FXP_READ);
+	buffer_put_int(msg, req->id);
+	buffer_put_string(msg, x->handle, x->handle_len);
+	sftp_put_uint64(msg, req->offset);
+	buffer_put_int(msg, req->len);
+	sftp_send_msg(pvar, c, msg);
+	sftp_buffer_free(msg);
+}
+
+static BOOL sftp_send_write(PTInstVar pvar, Channel_t *c, sftp_request_t *req)
+{
+	sftp_xfer_t *x = c->sftp.xfer;
+	buffer_t *msg;
+	char *p;
+	BOOL ret = TRUE;
+
+	sftp_buffer_alloc(&msg);
+	buffer_put_char(msg, SSH2_FXP_WRITE);
+	buffer_put_int(msg, req->id);
+	buffer_put_string(msg, x->handle, x->handle_len);
+	sftp_put_uint64(msg, req->offset);
+	buffer_put_int(msg, req->len);
+	// t@C瑗Mobt@֒ړǂݍ
+	p = buffer_append_space(msg, req->len);
+	if (p == NULL || fread(p, 1, req->len, x->localfp) != req->len) {
+		ret = FALSE;
+	}
+	else {
+		sftp_send_msg(pvar, c, msg);
+	}
+	sftp_buffer_free(msg);
+	return ret;
+}
+
+// ]It@C
+static void sftp_close_file(PTInstVar pvar, Channel_t *c)
+{
+	sftp_xfer_t *x = c->sftp.xfer;
+
+	x->state = SFTP_XFER_CLOSE;
+	x->ctl_id = c->sftp.msg_id++;
+	sftp_send_handle_request(pvar, c, x->ctl_id, SSH2_FXP_CLOSE, x->handle, x->handle_len);
+}
+
+// ҂̗v num_requests ɂȂ܂ READ/WRITE 𑗂
+static void sftp_pump(PTInstVar pvar, Channel_t *c)
+{
+	sftp_xfer_t *x = c->sftp.xfer;
+	sftp_request_t *req;
+	unsigned int len;
+
+	if (x == NULL || x->state != SFTP_XFER_DATA) {
+		return;
+	}
+
+	while (!x->eof && !x->error && x->num_req < c->sftp.num_requests) {
+		len = c->sftp.transfer_buflen;
+		if (x->job->type == SFTP_JOB_PUT) {
+			if (x->next_offset >= x->filesize) {
+				x->eof = 1;
+				break;
+			}
+			if (x->filesize - x->next_offset < len) {
+				len = (unsigned int)(x->filesize - x->next_offset);
+			}
+			// [g̃EBhE󂭂܂őM܂ĂԂ͒ǉȂ
+			if (c->bufchain != NULL && x->num_req > 0) {
+				break;
+			}
+		}
+		else if (x->next_offset >= x->filesize && x->num_req > 0) {
+			// t@C̑傫𒴂镪́AO̗vIĂ EOF m߂
+			break;
+		}
+		if (sftp_bwlimit_wait(c, len)) {
+			break;
+		}
+
+		req = sftp_alloc_request(c);
+		if (req == NULL) {
+			break;
+		}
+		req->id = c->sftp.msg_id++;
+		req->offset = x->next_offset;
+		req->len = len;
+
+		if (x->job->type == SFTP_JOB_GET) {
+			sftp_send_read(pvar, c, req);
+		}
+		else if (!sftp_send_write(pvar, c, req)) {
+			sftp_console_message(pvar, c, "Couldn't read from local file \"%s\"", x->job->local);
+			req->used = 0;
+			x->error = 1;
+			break;
+		}
+		x->next_offset += len;
+		x->num_req++;
+	}
+
+	if ((x->eof || x->error) && x->num_req == 0) {
+		sftp_close_file(pvar, c);
+	}
+}
+
+// READ ̉ (DATA/STATUS)
+static void sftp_read_recv(PTInstVar pvar, Channel_t *c, sftp_request_t *req, unsigned int type, buffer_t *msg)
+{
+	sftp_xfer_t *x = c->sftp.xfer;
+
+	if (type == SSH2_FXP_DATA && buffer_remain_len(msg) >= 4) {
+		char *data = buffer_tail_ptr(msg);
+		unsigned int len = get_uint32(data);
+
+		if (len > req->len || len > (unsigned int)buffer_remain_len(msg) - 4) {
+			sftp_console_message(pvar, c, "Received more data than asked for %u > %u", len, req->len);
+			x->error = 1;
+		}
+		else if (!x->error) {
+			// ͏sœ͂̂ŁAvItZbg̈ʒuɏ
+			if (x->local_pos != req->offset) {
+				_fseeki64(x->localfp, req->offset, SEEK_SET);
+			}
+			if (fwrite(data + 4, 1, len, x->localfp) != len) {
+				sftp_console_message(pvar, c, "Couldn't write to local file \"%s\"", x->job->local);
+				x->error = 1;
+			}
+			x->local_pos = req->offset + len;
+			x->transferred += len;
+
+			if (len == 0) {
+				// 0̉͂̈ʒut@C̏I
+				x->eof = 1;
+			}
+			else if (len < req->len && !x->error) {
+				// vZꍇ͎cv
+				// ̗v EOF ɂȂĂĂA̗v̎cɂ̓f[^邩Ȃ
+				// 0̉ SSH2_FX_EOF ܂ő
+				req->id = c->sftp.msg_id++;
+				req->offset += len;
+				req->len -= len;
+				sftp_send_read(pvar, c, req);
+				return;
+			}
+		}
+	}
+	else if (type == SSH2_FXP_STATUS) {
+		unsigned int status = buffer_get_int(msg);
+
+		if (status == SSH2_FX_EOF) {
+			x->eof = 1;
+		}
+		else if (!x->error) {
+			sftp_job_error(pvar, c, "Couldn't read from remote file", status);
+			x->error = 1;
+		}
+	}
+	else {
+		sftp_syslog(pvar, "Expected SSH2_FXP_DATA(%u) packet, got %u", SSH2_FXP_DATA, type);
+		x->error = 1;
+	}
+
+	req->used = 0;
+	x->num_req--;
+}
+
+// WRITE ̉ (STATUS)
+static void sftp_write_recv(PTInstVar pvar, Channel_t *c, sftp_request_t *req, unsigned int type, buffer_t *msg)
+{
+	sftp_xfer_t *x = c->sftp.xfer;
+	unsigned int status = SSH2_FX_BAD_MESSAGE;
+
+	if (type == SSH2_FXP_STATUS) {
+		status = buffer_get_int(msg);
+	}
+	if (status == SSH2_FX_OK) {
+		x->transferred += req->len;
+	}
+	else if (!x->error) {
+		sftp_job_error(pvar, c, "Couldn't write to remote file", status);
+		x->error = 1;
+	}
+
+	req->used = 0;
+	x->num_req--;
+}
+
+static void sftp_start_data(PTInstVar pvar, Channel_t *c, buffer_t *msg)
+{
+	sftp_xfer_t *x = c->sftp.xfer;
+	int len = 0;
+
+	x->handle = buffer_get_string_msg(msg, &len);
+	x->handle_len = len;
+	x->state = SFTP_XFER_DATA;
+	x->next_offset = x->start_offset;
+	x->local_pos = x->start_offset;
+	x->start_tick = GetTickCount();
+	x->bw_tick = x->start_tick;
+
+	if (x->job->type == SFTP_JOB_GET) {
+		sftp_console_message(pvar, c, "Fetching %s to %s", x->job->remote, x->job->local);
+	}
+	else {
+		sftp_console_message(pvar, c, "Uploading %s to %s", x->job->local, x->job->remote);
+	}
+	if (x->start_offset > 0) {
+		sftp_console_message(pvar, c, "Resuming at offset %I64u", x->start_offset);
+	}
+	sftp_pump(pvar, c);
+}
+
+static void sftp_open_remote(PTInstVar pvar, Channel_t *c, unsigned int pflags)
+{
+	sftp_xfer_t *x = c->sftp.xfer;
+
+	x->state = SFTP_XFER_OPEN;
+	x->ctl_id = c->sftp.msg_id++;
+	sftp_send_open(pvar, c, x->ctl_id, x->job->remote, pflags);
+}
+
+// get: [g STAT ̉
+static void sftp_get_stat_recv(PTInstVar pvar, Channel_t *c, unsigned int type, buffer_t *msg)
+{
+	sftp_xfer_t *x = c->sftp.xfer;
+	sftp_job_t *job = x->job;
+	sftp_attrib_t a;
+	struct __stat64 st;
+
+	if (type != SSH2_FXP_ATTRS) {
+		sftp_job_error(pvar, c, "Couldn't stat remote file", type == SSH2_FXP_STATUS ? buffer_get_int(msg) : SSH2_FX_BAD_MESSAGE);
+		sftp_end_job(pvar, c);
+		return;
+	}
+	sftp_decode_attrib(msg, &a);
+
+	if ((a.flags & SSH2_FILEXFER_ATTR_PERMISSIONS) && (a.perm & SFTP_S_IFMT) == SFTP_S_IFDIR) {
+		wchar_t *localW;
+
+		if (!job->recursive) {
+			sftp_console_message(pvar, c, "\"%s\" is a directory (use get -r)", job->remote);
+			sftp_end_job(pvar, c);
+			return;
+		}
+		localW = ToWcharU8(job->local);
+		if (localW != NULL) {
+			_wmkdir(localW);
+			free(localW);
+		}
+		x->state = SFTP_XFER_OPENDIR;
+		x->ctl_id = c->sftp.msg_id++;
+		sftp_send_string_request(pvar, c, x->ctl_id, SSH2_FXP_OPENDIR, job->remote, strlen(job->remote));
+		return;
+	}
+
+	x->filesize = (a.flags & SSH2_FILEXFER_ATTR_SIZE) ? a.size : (unsigned long long)-1;
+	if (job->resume && sftp_stat(job->local, &st) == 0 && st.st_size > 0) {
+		if ((a.flags & SSH2_FILEXFER_ATTR_SIZE) && (unsigned long long)st.st_size >= a.size) {
+			sftp_console_message(pvar, c, "\"%s\" is already complete", job->local);
+			sftp_end_job(pvar, c);
+			return;
+		}
+		x->localfp = sftp_fopen(job->local, L"r+b");
+		if (x->localfp != NULL) {
+			x->start_offset = st.st_size;
+			_fseeki64(x->localfp, x->start_offset, SEEK_SET);
+		}
+	}
+	else {
+		x->localfp = sftp_fopen(job->local, L"wb");
+	}
+	if (x->localfp == NULL) {
+		sftp_console_message(pvar, c, "Couldn't open local file \"%s\" for writing", job->local);
+		sftp_end_job(pvar, c);
+		return;
+	}
+	sftp_open_remote(pvar, c, SSH2_FXF_READ);
+}
+
+// put: [g STAT ̉ (ĊJʒu߂)
+static void sftp_put_stat_recv(PTInstVar pvar, Channel_t *c, unsigned int type, buffer_t *msg)
+{
+	sftp_xfer_t *x = c->sftp.xfer;
+	sftp_attrib_t a;
+
+	if (type == SSH2_FXP_ATTRS) {
+		sftp_decode_attrib(msg, &a);
+		if (a.flags & SSH2_FILEXFER_ATTR_SIZE) {
+			if (a.size >= x->filesize) {
+				sftp_console_message(pvar, c, "\"%s\" is already complete", x->job->remote);
+				sftp_end_job(pvar, c);
+				return;
+			}
+			x->start_offset = a.size;
+			_fseeki64(x->localfp, x->start_offset, SEEK_SET);
+		}
+	}
+	// [gɃt@Cΐ擪瑗
+	sftp_open_remote(pvar, c, SSH2_FXF_WRITE | SSH2_FXF_CREAT);
+}
+
+// put -r: [J̃fBNg̒gWuɐς
+static void sftp_put_enum_dir(PTInstVar pvar, Channel_t *c)
+{
+	sftp_job_t *job = c->sftp.xfer->job;
+	WIN32_FIND_DATAW fd;
+	HANDLE h;
+	char *pattern = sftp_path_join(job->local, "*", '\\');
+	wchar_t *patternW = (pattern != NULL) ? ToWcharU8(pattern) : NULL;
+
+	free(pattern);
+	if (patternW == NULL) {
+		return;
+	}
+	h = FindFirstFileW(patternW, &fd);
+	free(patternW);
+	if (h == INVALID_HANDLE_VALUE) {
+		sftp_console_message(pvar, c, "Couldn't open local directory \"%s\"", job->local);
+		return;
+	}
+	do {
+		char *name = ToU8W(fd.cFileName);
+		char *local, *remote;
+
+		if (name == NULL) {
+			continue;
+		}
+		if (strcmp(name, ".") != 0 && strcmp(name, "..") != 0) {
+			local = sftp_path_join(job->local, name, '\\');
+			remote = sftp_path_join(job->remote, name, '/');
+			if (local != NULL && remote != NULL) {
+				sftp_add_job(c, SFTP_JOB_PUT, remote, local, job->resume,
+				             (fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) ? 1 : 0);
+			}
+			free(local);
+			free(remote);
+		}
+		free(name);
+	} while (FindNextFileW(h, &fd));
+	FindClose(h);
+}
+
+// get -r: READDIR ̉
+static void sftp_readdir_recv(PTInstVar pvar, Channel_t *c, unsigned int type, buffer_t *msg)
+{
+	sftp_xfer_t *x = c->sftp.xfer;
+	sftp_job_t *job = x->job;
+	unsigned int i, count;
+
+	if (type == SSH2_FXP_NAME) {
+		count = buffer_get_int(msg);
+		for (i = 0; i < count && buffer_remain_len(msg) > 0; i++) {
+			char *filename = buffer_get_string_msg(msg, NULL);
+			char *longname = buffer_get_string_msg(msg, NULL);
+			sftp_attrib_t a;
+
+			sftp_decode_attrib(msg, &a);
+			if (filename != NULL && strcmp(filename, ".") != 0 && strcmp(filename, "..") != 0) {
+				unsigned int fmt = a.perm & SFTP_S_IFMT;
+				int dir = (a.flags & SSH2_FILEXFER_ATTR_PERMISSIONS) && fmt == SFTP_S_IFDIR;
+				int reg = !(a.flags & SSH2_FILEXFER_ATTR_PERMISSIONS) || fmt == SFTP_S_IFREG;
+
+				if (dir || reg) {
+					char *local = sftp_local_path_join(pvar, c, job->local, filename);
+					char *remote = (local != NULL) ? sftp_path_join(job->remote, filename, '/') : NULL;
+
+					if (remote != NULL && local != NULL) {
+						sftp_add_job(c, SFTP_JOB_GET, remote, local, job->resume, dir);
+					}
+					free(remote);
+					free(local);
+				}
+				else {
+					sftp_syslog(pvar, "Skipping non-regular file %s", filename);
+				}
+			}
+			free(filename);
+			free(longname);
+		}
+		x->ctl_id = c->sftp.msg_id++;
+		sftp_send_handle_request(pvar, c, x->ctl_id, SSH2_FXP_READDIR, x->handle, x->handle_len);
+		return;
+	}
+
+	if (type == SSH2_FXP_STATUS) {
+		unsigned int status = buffer_get_int(msg);
+
+		if (status != SSH2_FX_EOF) {
+			sftp_job_error(pvar, c, "Couldn't read directory", status);
+		}
+	}
+	x->state = SFTP_XFER_CLOSEDIR;
+	x->ctl_id = c->sftp.msg_id++;
+	sftp_send_handle_request(pvar, c, x->ctl_id, SSH2_FXP_CLOSE, x->handle, x->handle_len);
+}
+
+static void sftp_close_recv(PTInstVar pvar, Channel_t *c, unsigned int type, buffer_t *msg)
+{
+	sftp_xfer_t *x = c->sftp.xfer;
+	DWORD elapsed = GetTickCount() - x->start_tick;
+	unsigned int status = (type == SSH2_FXP_STATUS) ? buffer_get_int(msg) : SSH2_FX_BAD_MESSAGE;
+
+	if (status != SSH2_FX_OK && !x->error) {
+		sftp_job_error(pvar, c, "Couldn't close file", status);
+		x->error = 1;
+	}
+	if (x->error) {
+		sftp_console_message(pvar, c, "%s: transfer stopped after %I64u bytes",
+		                     sftp_basename(x->job->remote), x->start_offset + x->transferred);
+	}
+	else {
+		sftp_console_message(pvar, c, "%s: %I64u bytes in %lu.%03lu sec (%I64u KB/s)",
+		                     sftp_basename(x->job->remote), x->transferred,
+		                     elapsed / 1000, elapsed % 1000,
+		                     (elapsed > 0) ? x->transferred * 1000 / 1024 / elapsed : 0);
+	}
+	sftp_end_job(pvar, c);
+}
+
+// WůJnB҂ꍇ TRUE ԂB
+static BOOL sftp_start_job(PTInstVar pvar, Channel_t *c)
+{
+	sftp_xfer_t *x = c->sftp.xfer;
+	sftp_job_t *job = x->job;
+	struct __stat64 st;
+
+	switch (job->type) {
+	case SFTP_JOB_CHDIR:
+		x->state = SFTP_XFER_REALPATH;
+		x->ctl_id = c->sftp.msg_id++;
+		sftp_send_string_request(pvar, c, x->ctl_id, SSH2_FXP_REALPATH, job->remote, strlen(job->remote));
+		return TRUE;
+
+	case SFTP_JOB_GET:
+		x->state = SFTP_XFER_STAT;
+		x->ctl_id = c->sftp.msg_id++;
+		sftp_send_string_request(pvar, c, x->ctl_id, SSH2_FXP_STAT, job->remote, strlen(job->remote));
+		return TRUE;
+
+	case SFTP_JOB_PUT:
+		if (sftp_stat(job->local, &st) != 0) {
+			sftp_console_message(pvar, c, "Couldn't stat local file \"%s\"", job->local);
+			return FALSE;
+		}
+		if (st.st_mode & _S_IFDIR) {
+			if (!job->recursive) {
+				sftp_console_message(pvar, c, "\"%s\" is a directory (use put -r)", job->local);
+				return FALSE;
+			}
+			x->state = SFTP_XFER_MKDIR;
+			x->ctl_id = c->sftp.msg_id++;
+			sftp_send_mkdir(pvar, c, x->ctl_id, job->remote);
+			return TRUE;
+		}
+		x->filesize = st.st_size;
+		x->localfp = sftp_fopen(job->local, L"rb");
+		if (x->localfp == NULL) {
+			sftp_console_message(pvar, c, "Couldn't open local file \"%s\" for reading", job->local);
+			return FALSE;
+		}
+		if (job->resume) {
+			x->state = SFTP_XFER_STAT;
+			x->ctl_id = c->sftp.msg_id++;
+			sftp_send_string_request(pvar, c, x->ctl_id, SSH2_FXP_STAT, job->remote, strlen(job->remote));
+		}
+		else {
+			sftp_open_remote(pvar, c, SSH2_FXF_WRITE | SSH2_FXF_CREAT | SSH2_FXF_TRUNC);
+		}
+		return TRUE;
+	}
+	return FALSE;
+}
+
+static void sftp_next_job(PTInstVar pvar, Channel_t *c)
+{
+	sftp_xfer_t *x = c->sftp.xfer;
+	sftp_job_t *job;
+
+	if (c->sftp.state != SFTP_REALPATH || x == NULL || x->job != NULL) {
+		return;
+	}
+
+	while ((job = c->sftp.jobs) != NULL) {
+		c->sftp.jobs = job->next;
+		if (c->sftp.jobs == NULL) {
+			c->sftp.jobs_tail = NULL;
+		}
+		job->next = NULL;
+		x->job = job;
+		if (sftp_start_job(pvar, c)) {
+			return;
+		}
+		// ɏIWu(G[)͕ЕtĎ
+		if (x->localfp != NULL) {
+			fclose(x->localfp);
+			x->localfp = NULL;
+		}
+		sftp_free_job(job);
+		x->job = NULL;
+	}
+}
+
+// ]̉̏
+static void sftp_xfer_response(PTInstVar pvar, Channel_t *c, buffer_t *msg)
 {
-	unsigned int type, expected_id, count, id;
-	char *filename = NULL, *longname;
+	sftp_xfer_t *x = c->sftp.xfer;
+	sftp_request_t *req;
+	unsigned int type, id;
 
-	type = buffer_get_char(msg);
+	type = (unsigned char)buffer_get_char(msg);
 	id = buffer_get_int(msg);
 
-	expected_id = c->sftp.msg_id - 1; 
-	if (id != expected_id) {
-		sftp_syslog(pvar, "ID mismatch (%u != %u)", id, expected_id);
-		goto error;
+	if (x == NULL || x->job == NULL) {
+		sftp_syslog(pvar, "Unexpected message T:%u I:%u", type, id);
+		return;
 	}
 
-	if (type == SSH2_FXP_STATUS) {
-		unsigned int status = buffer_get_int(msg);
+	req = sftp_find_request(c, id);
+	if (req != NULL) {
+		if (x->job->type == SFTP_JOB_GET) {
+			sftp_read_recv(pvar, c, req, type, msg);
+		}
+		else {
+			sftp_write_recv(pvar, c, req, type, msg);
+		}
+		sftp_pump(pvar, c);
+		return;
+	}
 
-		sftp_syslog(pvar, "Couldn't canonicalise: %s", fx2txt(status));
-		goto error;
-	} else if (type != SSH2_FXP_NAME) {
-        sftp_syslog(pvar, "Expected SSH2_FXP_NAME(%u) packet, got %u",
-            SSH2_FXP_NAME, type);
-		goto error;
+	if (id != x->ctl_id) {
+		sftp_syslog(pvar, "ID mismatch (%u != %u)", id, x->ctl_id);
+		return;
 	}
 
-	count = buffer_get_int(msg);
-	if (count != 1) {
-		sftp_syslog(pvar, "Got multiple names (%d) from SSH_FXP_REALPATH", count);
-		goto error;
+	switch (x->state) {
+	case SFTP_XFER_STAT:
+		if (x->job->type == SFTP_JOB_GET) {
+			sftp_get_stat_recv(pvar, c, type, msg);
+		}
+		else {
+			sftp_put_stat_recv(pvar, c, type, msg);
+		}
+		break;
+
+	case SFTP_XFER_OPEN:
+		if (type == SSH2_FXP_HANDLE) {
+			sftp_start_data(pvar, c, msg);
+		}
+		else {
+			sftp_job_error(pvar, c, "Couldn't open remote file", type == SSH2_FXP_STATUS ? buffer_get_int(msg) : SSH2_FX_BAD_MESSAGE);
+			sftp_end_job(pvar, c);
+		}
+		break;
+
+	case SFTP_XFER_CLOSE:
+		sftp_close_recv(pvar, c, type, msg);
+		break;
+
+	case SFTP_XFER_MKDIR:
+		// ɃfBNgꍇG[ɂȂ̂ŁAʂ͌Ȃ
+		sftp_put_enum_dir(pvar, c);
+		sftp_end_job(pvar, c);
+		break;
+
+	case SFTP_XFER_OPENDIR:
+		if (type == SSH2_FXP_HANDLE) {
+			int len = 0;
+
+			x->handle = buffer_get_string_msg(msg, &len);
+			x->handle_len = len;
+			x->state = SFTP_XFER_READDIR;
+			x->ctl_id = c->sftp.msg_id++;
+			sftp_send_handle_request(pvar, c, x->ctl_id, SSH2_FXP_READDIR, x->handle, x->handle_len);
+		}
+		else {
+			sftp_job_error(pvar, c, "Couldn't open remote directory", type == SSH2_FXP_STATUS ? buffer_get_int(msg) : SSH2_FX_BAD_MESSAGE);
+			sftp_end_job(pvar, c);
+		}
+		break;
+
+	case SFTP_XFER_READDIR:
+		sftp_readdir_recv(pvar, c, type, msg);
+		break;
+
+	case SFTP_XFER_CLOSEDIR:
+		sftp_end_job(pvar, c);
+		break;
+
+	case SFTP_XFER_REALPATH:
+		if (type == SSH2_FXP_NAME && buffer_get_int(msg) == 1) {
+			char *path = buffer_get_string_msg(msg, NULL);
+
+			if (path != NULL) {
+				strncpy_s(c->sftp.cwd, sizeof(c->sftp.cwd), path, _TRUNCATE);
+				sftp_console_message(pvar, c, "Remote working directory: %s", c->sftp.cwd);
+				free(path);
+			}
+		}
+		else {
+			sftp_job_error(pvar, c, "Couldn't change directory", type == SSH2_FXP_STATUS ? buffer_get_int(msg) : SSH2_FX_BAD_MESSAGE);
+		}
+		sftp_end_job(pvar, c);
+		break;
+
+	default:
+		break;
 	}
+}
 
-	filename = buffer_get_string_msg(msg, NULL);
-	longname = buffer_get_string_msg(msg, NULL);
-	//a = decode_attrib(&msg);
 
-	sftp_console_message(pvar, c, "SSH_FXP_REALPATH %s -> %s", c->sftp.path, filename);
+// get: remote  local 
+static int sftp_process_get(PTInstVar pvar, Channel_t *c, const char *src, const char *dst, int resume, int recursive)
+{
+	char *remote = sftp_make_absolute(c, src);
+	char *local = NULL;
+	struct __stat64 st;
+	int err = 0;
 
-	free(longname);
+	if (remote == NULL) {
+		return -1;
+	}
+	if (*sftp_basename(remote) == '\0') {
+		sftp_console_message(pvar, c, "Invalid path \"%s\"", src);
+		free(remote);
+		return -1;
+	}
+	if (dst == NULL) {
+		local = sftp_local_path_join(pvar, c, "", sftp_basename(remote));
+		if (local == NULL) {
+			free(remote);
+			return -1;
+		}
+	}
+	else if (sftp_stat(dst, &st) == 0 && (st.st_mode & _S_IFDIR)) {
+		// ̃fBNgȂ炻̒ɒu
+		local = sftp_local_path_join(pvar, c, dst, sftp_basename(remote));
+		if (local == NULL) {
+			free(remote);
+			return -1;
+		}
+	}
+	else {
+		local = _strdup(dst);
+	}
+	if (local == NULL || sftp_add_job(c, SFTP_JOB_GET, remote, local, resume, recursive) == NULL) {
+		err = -1;
+	}
+	free(remote);
+	free(local);
+	return err;
+}
 
-error:
-	return (filename);
+// put: local  remote 
+static int sftp_process_put(PTInstVar pvar, Channel_t *c, const char *src, const char *dst, int resume, int recursive)
+{
+	char *remote;
+	int err = 0;
+
+	if (dst == NULL) {
+		remote = sftp_make_absolute(c, sftp_basename(src));
+	}
+	else {
+		remote = sftp_make_absolute(c, dst);
+		if (remote != NULL && remote[0] != '\0' && remote[strlen(remote) - 1] == '/') {
+			// '/' ŏIĂ΃fBNgƂ݂ȂĂ̒ɒu
+			char *p = sftp_path_join(remote, sftp_basename(src), '/');
+			free(remote);
+			remote = p;
+		}
+	}
+	if (remote == NULL || sftp_add_job(c, SFTP_JOB_PUT, remote, src, resume, recursive) == NULL) {
+		err = -1;
+	}
+	free(remote);
+	return err;
 }
 
 
@@ -427,7 +1579,7 @@ help(void)
 	    "df [-hi] [path]                    Display statistics for current directory or\r\n"
 	    "                                   filesystem containing 'path'\r\n"
 	    "exit                               Quit sftp\r\n"
-	    "get [-Ppr] remote [local]          Download file\r\n"
+	    "get [-ar] remote [local]           Download file\r\n"
 	    "help                               Display this help text\r\n"
 	    "lcd path                           Change local directory to 'path'\r\n"
 	    "lls [ls-options [path]]            Display local directory listing\r\n"
@@ -438,7 +1590,7 @@ help(void)
 	    "lumask umask                       Set local umask to 'umask'\r\n"
 	    "mkdir path                         Create remote directory\r\n"
 	    "progress                           Toggle display of progress meter\r\n"
-	    "put [-Ppr] local [remote]          Upload file\r\n"
+	    "put [-ar] local [remote]           Upload file\r\n"
 	    "pwd                                Display remote working directory\r\n"
 	    "quit                               Quit sftp\r\n"
 	    "rename oldpath newpath             Rename remote file\r\n"
@@ -612,7 +1764,7 @@ makeargv(const char *arg, int *argcp, int sloppy, char *lastquote,
 	return argv;
 }
 
-static int parse_args(const char **cpp, int *pflag, int *rflag, int *lflag, int *iflag,
+static int parse_args(const char **cpp, int *pflag, int *rflag, int *aflag, int *lflag, int *iflag,
     int *hflag, int *sflag, unsigned long *n_arg, char **path1, char **path2)
 {
     const char *cmd, *cp = *cpp;
@@ -657,30 +1809,51 @@ static int parse_args(const char **cpp, int *pflag, int *rflag, int *lflag, int
 	}
 
 	/* Get arguments and parse flags */
-	*lflag = *pflag = *rflag = *hflag = *n_arg = 0;
+	*lflag = *pflag = *rflag = *aflag = *hflag = *n_arg = 0;
 	*path1 = *path2 = NULL;
 	optidx = 1;
 	switch (cmdnum) {
-#if 0
 	case I_GET:
 	case I_PUT:
-		if ((optidx = parse_getput_flags(cmd, argv, argc,
-		    pflag, rflag)) == -1)
-			return -1;
+		/* -a: ], -r: fBNgċAIɓ] */
+		for (; optidx < argc && argv[optidx][0] == '-'; optidx++) {
+			const char *f;
+
+			for (f = argv[optidx] + 1; *f != '\0'; f++) {
+				if (*f == 'a') {
+					*aflag = 1;
+				} else if (*f == 'r') {
+					*rflag = 1;
+				} else if (*f == 'p' || *f == 'P') {
+					*pflag = 1;
+				} else {
+					sftp_console_message(g_pvar, g_channel, "%s: Invalid flag -%c", cmd, *f);
+					return -1;
+				}
+			}
+		}
 		/* Get first pathname (mandatory) */
 		if (argc - optidx < 1) {
-			error("You must specify at least one path after a "
-			    "%s command.", cmd);
+			sftp_console_message(g_pvar, g_channel,
+			    "You must specify at least one path after a %s command.", cmd);
 			return -1;
 		}
-		*path1 = xstrdup(argv[optidx]);
+		*path1 = argv[optidx];
 		/* Get second pathname (optional) */
-		if (argc - optidx > 1) {
-			*path2 = xstrdup(argv[optidx + 1]);
-			/* Destination is not globbed */
-			undo_glob_escape(*path2);
+		if (argc - optidx > 1)
+			*path2 = argv[optidx + 1];
+		break;
+	case I_CHDIR:
+	case I_LCHDIR:
+		/* Get pathname (mandatory) */
+		if (argc - optidx < 1) {
+			sftp_console_message(g_pvar, g_channel,
+			    "You must specify a path after a %s command.", cmd);
+			return -1;
 		}
+		*path1 = argv[optidx];
 		break;
+#if 0
 	case I_LINK:
 		if ((optidx = parse_link_flags(cmd, argv, argc, sflag)) == -1)
 			return -1;
@@ -700,8 +1873,6 @@ static int parse_args(const char **cpp, int *pflag, int *rflag, int *lflag, int
 	case I_RM:
 	case I_MKDIR:
 	case I_RMDIR:
-	case I_CHDIR:
-	case I_LCHDIR:
 	case I_LMKDIR:
 		/* Get pathname (mandatory) */
 		if (argc - optidx < 1) {
@@ -791,43 +1962,24 @@ static int parse_args(const char **cpp, int *pflag, int *rflag, int *lflag, int
  */
 static WNDPROC hEditProc;
 
-static LRESULT CALLBACK EditProc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
+// R}h1ssBcmdline  UTF-8B
+// get/put ̓WuɐςނŁA]͉̎Mɍ킹ĐiށB
+static int sftp_run_command(PTInstVar pvar, Channel_t *c, char *cmdline)
 {
-	char buf[512];
 	char *cmd;
     char *path1, *path2, *tmp = NULL;
-    int pflag = 0, rflag = 0, lflag = 0, iflag = 0, hflag = 0, sflag = 0;
+    int pflag = 0, rflag = 0, aflag = 0, lflag = 0, iflag = 0, hflag = 0, sflag = 0;
     int cmdnum, i = 0;
     unsigned long n_arg = 0;
 	//Attrib a, *aa;
-	char path_buf[1024] = {0};
 	int err = 0;
 	//glob_t g;
 	int err_abort;
 
-	switch (uMsg) {
-		case WM_KEYDOWN:
-		if ((int)wParam == VK_RETURN) {
-			GetWindowText(hwnd, buf, sizeof(buf));
-			SetWindowText(hwnd, "");
-			if (buf[0] != '\0') {
-				SendDlgItemMessage(GetParent(hwnd), IDC_SFTP_CONSOLE, EM_REPLACESEL, 0, (LPARAM) buf);
-				SendDlgItemMessage(GetParent(hwnd), IDC_SFTP_CONSOLE, EM_REPLACESEL, 0,
-								   (LPARAM) (char *) "\r\n");
-				goto cmd_parsed;
-			}
-		}
-		break;
-	default:
-		return (CallWindowProc(hEditProc, hwnd, uMsg, wParam, lParam));
-	}
-	return 0L;
-
-cmd_parsed:
 	// R}hC
 	path1 = path2 = NULL;
-	cmd = buf;
-	cmdnum = parse_args((const char **)&cmd, &pflag, &rflag, &lflag, &iflag, &hflag,
+	cmd = cmdline;
+	cmdnum = parse_args((const char **)&cmd, &pflag, &rflag, &aflag, &lflag, &iflag, &hflag,
 		&sflag, &n_arg, &path1, &path2);
 
 	if (iflag != 0)
@@ -844,13 +1996,49 @@ cmd_parsed:
 		/* Unrecognized command */
 		err = -1;
 		break;
-#if 0
 	case I_GET:
-		err = process_get(conn, path1, path2, *pwd, pflag, rflag);
+		err = sftp_process_get(pvar, c, path1, path2, aflag, rflag);
 		break;
 	case I_PUT:
-		err = process_put(conn, path1, path2, *pwd, pflag, rflag);
+		err = sftp_process_put(pvar, c, path1, path2, aflag, rflag);
+		break;
+	case I_CHDIR:
+		tmp = sftp_make_absolute(c, path1);
+		if (tmp == NULL || sftp_add_job(c, SFTP_JOB_CHDIR, tmp, NULL, 0, 0) == NULL) {
+			err = -1;
+		}
+		free(tmp);
+		break;
+	case I_LCHDIR:
+		{
+			wchar_t *pathW = ToWcharU8(path1);
+
+			if (pathW == NULL || _wchdir(pathW) == -1) {
+				sftp_console_message(pvar, c, "Couldn't change local directory to \"%s\"", path1);
+				err = 1;
+			}
+			free(pathW);
+		}
+		break;
+	case I_PWD:
+		sftp_console_message(pvar, c, "Remote working directory: %s", c->sftp.cwd);
+		break;
+	case I_LPWD:
+		{
+			wchar_t path_buf[MAX_PATH];
+			char *pathU8;
+
+			if (_wgetcwd(path_buf, _countof(path_buf)) == NULL ||
+			    (pathU8 = ToU8W(path_buf)) == NULL) {
+				sftp_console_message(pvar, c, "Couldn't get local cwd");
+				err = -1;
+				break;
+			}
+			sftp_console_message(pvar, c, "Local working directory: %s", pathU8);
+			free(pathU8);
+		}
 		break;
+#if 0
 	case I_RENAME:
 		path1 = make_absolute(path1, *pwd);
 		path2 = make_absolute(path2, *pwd);
@@ -884,33 +2072,6 @@ cmd_parsed:
 		path1 = make_absolute(path1, *pwd);
 		err = do_rmdir(conn, path1);
 		break;
-	case I_CHDIR:
-		path1 = make_absolute(path1, *pwd);
-		if ((tmp = do_realpath(conn, path1)) == NULL) {
-			err = 1;
-			break;
-		}
-		if ((aa = do_stat(conn, tmp, 0)) == NULL) {
-			xfree(tmp);
-			err = 1;
-			break;
-		}
-		if (!(aa->flags & SSH2_FILEXFER_ATTR_PERMISSIONS)) {
-			error("Can't change directory: Can't check target");
-			xfree(tmp);
-			err = 1;
-			break;
-		}
-		if (!S_ISDIR(aa->perm)) {
-			error("Can't change directory: \"%s\" is not "
-			    "a directory", tmp);
-			xfree(tmp);
-			err = 1;
-			break;
-		}
-		xfree(*pwd);
-		*pwd = tmp;
-		break;
 	case I_LS:
 		if (!path1) {
 			do_ls_dir(conn, *pwd, *pwd, lflag);
@@ -932,13 +2093,6 @@ cmd_parsed:
 		path1 = make_absolute(path1, *pwd);
 		err = do_df(conn, path1, hflag, iflag);
 		break;
-	case I_LCHDIR:
-		if (chdir(path1) == -1) {
-			error("Couldn't change local directory to "
-			    "\"%s\": %s", path1, strerror(errno));
-			err = 1;
-		}
-		break;
 	case I_LMKDIR:
 		if (mkdir(path1, 0777) == -1) {
 			error("Couldn't create local directory "
@@ -1003,17 +2157,6 @@ cmd_parsed:
 				break;
 		}
 		break;
-	case I_PWD:
-		printf("Remote working directory: %s\n", *pwd);
-		break;
-	case I_LPWD:
-		if (!getcwd(path_buf, sizeof(path_buf))) {
-			error("Couldn't get local cwd: %s", strerror(errno));
-			err = -1;
-			break;
-		}
-		printf("Local working directory: %s\n", path_buf);
-		break;
 #endif
 	case I_QUIT:
 		/* Processed below */
@@ -1022,7 +2165,7 @@ cmd_parsed:
 		help();
 		break;
 	case I_VERSION:
-		printf("SFTP protocol version %u\n", sftp_proto_version(&g_channel->sftp));
+		sftp_console_message(pvar, c, "SFTP protocol version %u", sftp_proto_version(&c->sftp));
 		break;
 #if 0
 	case I_PROGRESS:
@@ -1053,6 +2196,34 @@ cmd_parsed:
 		return (1);
 #endif
 
+	sftp_next_job(pvar, c);
+	return err;
+}
+
+static LRESULT CALLBACK EditProc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
+{
+	char buf[512];
+	char *bufU8;
+
+	switch (uMsg) {
+		case WM_KEYDOWN:
+		if ((int)wParam == VK_RETURN) {
+			GetWindowText(hwnd, buf, sizeof(buf));
+			SetWindowText(hwnd, "");
+			if (buf[0] != '\0') {
+				SendDlgItemMessage(GetParent(hwnd), IDC_SFTP_CONSOLE, EM_REPLACESEL, 0, (LPARAM) buf);
+				SendDlgItemMessage(GetParent(hwnd), IDC_SFTP_CONSOLE, EM_REPLACESEL, 0,
+								   (LPARAM) (char *) "\r\n");
+				if (g_channel != NULL && (bufU8 = ToU8A(buf)) != NULL) {
+					sftp_run_command(g_pvar, g_channel, bufU8);
+					free(bufU8);
+				}
+			}
+		}
+		break;
+	default:
+		return (CallWindowProc(hEditProc, hwnd, uMsg, wParam, lParam));
+	}
 	return 0L;
 }
 
@@ -1089,6 +2260,9 @@ static LRESULT CALLBACK OnSftpConsoleDlgProc(HWND hDlgWnd, UINT msg, WPARAM wp,
 					if (DlgDragDropFont != NULL) {
 						DeleteObject(DlgDragDropFont);
 					}
+					if (g_channel != NULL && g_channel->sftp.console_window == hDlgWnd) {
+						g_channel->sftp.console_window = NULL;
+					}
 					EndDialog(hDlgWnd, IDCANCEL);
 					DestroyWindow(hDlgWnd);
 					break;
@@ -1136,22 +2310,40 @@ static LRESULT CALLBACK OnSftpConsoleDlgProc(HWND hDlgWnd, UINT msg, WPARAM wp,
 	return TRUE;
 }
 
-// SFTPM -Xe[g}V[-
-void sftp_response(PTInstVar pvar, Channel_t *c, unsigned char *data, unsigned int buflen)
+// 󂯕tĂ}ÑR}hs
+static void sftp_run_pending(PTInstVar pvar, Channel_t *c)
 {
-	buffer_t *msg;
-	HWND hDlgWnd;
+	sftp_pending_t *p;
 
-	/*
-	 * Allocate buffer
-	 */
-	sftp_buffer_alloc(&msg);
-	sftp_get_msg(pvar, c, data, buflen, &msg);
+	while ((p = g_pending) != NULL) {
+		g_pending = p->next;
+		sftp_run_command(pvar, c, p->cmdline);
+		free(p->cmdline);
+		free(p);
+	}
+}
+
+static void sftp_free_pending(void)
+{
+	sftp_pending_t *p;
+
+	while ((p = g_pending) != NULL) {
+		g_pending = p->next;
+		free(p->cmdline);
+		free(p);
+	}
+}
+
+// 1 SFTP bZ[W̏ -Xe[g}V[-
+static void sftp_dispatch(PTInstVar pvar, Channel_t *c, buffer_t *msg)
+{
+	HWND hDlgWnd;
 
 	if (c->sftp.state == SFTP_INIT) {
 		// O[oϐɕۑB
 		g_pvar = pvar;
 		g_channel = c;
+		g_opening = FALSE;
 
 		sftp_do_init_recv(pvar, c, msg);
 
@@ -1169,13 +2361,148 @@ void sftp_response(PTInstVar pvar, Channel_t *c, unsigned char *data, unsigned i
 	} else if (c->sftp.state == SFTP_CONNECTED) {
 		char *remote_path;
 		remote_path = sftp_do_realpath_recv(pvar, c, msg);
+		if (remote_path != NULL) {
+			strncpy_s(c->sftp.cwd, sizeof(c->sftp.cwd), remote_path, _TRUNCATE);
+			free(remote_path);
+		}
 
 		c->sftp.state = SFTP_REALPATH;
 
+		sftp_run_pending(pvar, c);
+		sftp_next_job(pvar, c);
+
+	} else {
+		sftp_xfer_response(pvar, c, msg);
 	}
+}
 
-	/*
-	 * Free buffer
-	 */
-	sftp_buffer_free(msg);
+// SFTPM
+//   `l̃f[^ SFTP bZ[W̋؂Ƃ͊֌WȂ͂̂ŁA
+//   recvbuf ɗ߂āAbZ[W珇ɏB
+void sftp_response(PTInstVar pvar, Channel_t *c, unsigned char *data, unsigned int buflen)
+{
+	buffer_t *rb;
+	buffer_t msg;
+	unsigned int msg_len;
+	int remain;
+
+	if (c->sftp.recvbuf == NULL) {
+		c->sftp.recvbuf = buffer_init();
+		if (c->sftp.recvbuf == NULL) {
+			return;
+		}
+	}
+	rb = c->sftp.recvbuf;
+	buffer_append(rb, data, buflen);
+
+	while ((remain = buffer_remain_len(rb)) >= 4) {
+		msg_len = get_uint32(buffer_tail_ptr(rb));
+		if (msg_len > SFTP_MAX_MSG_LENGTH) {
+			sftp_syslog(pvar, "Received message too long %u", msg_len);
+			buffer_clear(rb);
+			return;
+		}
+		if ((unsigned int)remain < 4 + msg_len) {
+			break;
+		}
+
+		// recvbuf ̒w̃obt@ARs[ɓǂ
+		msg.buf = buffer_tail_ptr(rb);
+		msg.offset = 4;
+		msg.len = msg.maxlen = 4 + msg_len;
+		buffer_consume(rb, 4 + msg_len);
+
+		sftp_dispatch(pvar, c, &msg);
+	}
+
+	// ς݂̂̕ĂāAr܂ł̃bZ[W擪ɋl߂
+	remain = buffer_remain_len(rb);
+	if (remain == 0) {
+		buffer_clear(rb);
+	}
+	else if (rb->offset > 0) {
+		memmove(rb->buf, rb->buf + rb->offset, remain);
+		rb->offset = 0;
+		rb->len = remain;
+	}
+}
+
+// }N(sftpcmd)̃R}h̎sBcmdline  UTF-8B
+// SFTP ̃`l܂ΊJāAڑłĂsB
+int sftp_command(PTInstVar pvar, const char *cmdline)
+{
+	sftp_pending_t *p, **tail;
+	char *buf;
+	int ret;
+
+	if (g_channel != NULL && g_channel->sftp.state == SFTP_REALPATH) {
+		buf = _strdup(cmdline);
+		if (buf == NULL) {
+			return FALSE;
+		}
+		ret = sftp_run_command(pvar, g_channel, buf);
+		free(buf);
+		return (ret == 0);
+	}
+
+	p = calloc(1, sizeof(sftp_pending_t));
+	if (p == NULL || (p->cmdline = _strdup(cmdline)) == NULL) {
+		free(p);
+		return FALSE;
+	}
+	for (tail = &g_pending; *tail != NULL; tail = &(*tail)->next)
+		;
+	*tail = p;
+
+	if (g_channel == NULL && !g_opening) {
+		if (!SSH_sftp_transaction(pvar)) {
+			sftp_do_syslog(pvar, LOG_LEVEL_ERROR, "%s: couldn't open SFTP channel", __FUNCTION__);
+			sftp_free_pending();
+			return FALSE;
+		}
+		g_opening = TRUE;
+	}
+	return TRUE;
+}
+
+// `l폜鎞̌n
+void sftp_do_end(Channel_t *c)
+{
+	sftp_xfer_t *x = c->sftp.xfer;
+	sftp_job_t *job;
+
+	if (x != NULL) {
+		if (x->localfp != NULL) {
+			fclose(x->localfp);
+		}
+		if (x->bw_timer != 0) {
+			KillTimer(NULL, x->bw_timer);
+		}
+		free(x->handle);
+		sftp_free_job(x->job);
+		free(x->reqs);
+		free(x);
+		c->sftp.xfer = NULL;
+	}
+	while ((job = c->sftp.jobs) != NULL) {
+		c->sftp.jobs = job->next;
+		sftp_free_job(job);
+	}
+	c->sftp.jobs_tail = NULL;
+	if (c->sftp.recvbuf != NULL) {
+		buffer_free(c->sftp.recvbuf);
+		c->sftp.recvbuf = NULL;
+	}
+	if (c->sftp.console_window != NULL) {
+		DestroyWindow(c->sftp.console_window);
+		c->sftp.console_window = NULL;
+	}
+
+	if (c == g_channel) {
+		g_channel = NULL;
+	}
+	if (g_channel == NULL) {
+		sftp_free_pending();
+		g_opening = FALSE;
+	}
 }
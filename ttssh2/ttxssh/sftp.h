@@ -106,8 +106,13 @@
 
 #define DEFAULT_COPY_BUFLEN 32768   /* Size of buffer for up/download */
 #define DEFAULT_NUM_REQUESTS    64  /* # concurrent outstanding requests */
+#define SFTP_MIN_COPY_BUFLEN    1024
+#define SFTP_MAX_COPY_BUFLEN    (SFTP_MAX_MSG_LENGTH - 1024)
+#define SFTP_MAX_NUM_REQUESTS   1024
 
 void sftp_do_init(PTInstVar pvar, Channel_t *c);
 void sftp_response(PTInstVar pvar, Channel_t *c, unsigned char *data, unsigned int buflen);
+int sftp_command(PTInstVar pvar, const char *cmdline);
+void sftp_do_end(Channel_t *c);
 
 #endif
@@ -6,260 +6,358 @@ Public domain.
 Derived from public domain code by D. J. Bernstein.
 */
 
+/*
+ *  ref ͑̂̌ 8bit x 32 Ŏ̂ŒxB
+ * ed25519.c Ɠ 26bit  25bit ݂ɕׂ 10 limb ŕ\A
+ * RFC 7748  Montgomery ladder ŌvZB
+ * (32bit łłxȂȂ悤 2^51 ił͂Ȃg)
+ */
+
+#include "crypto_api.h"
+
 int crypto_scalarmult_curve25519(unsigned char *, const unsigned char *, const unsigned char *);
 
-static void add(unsigned int out[32],const unsigned int a[32],const unsigned int b[32])
+typedef struct
 {
-  unsigned int j;
-  unsigned int u;
-  u = 0;
-  for (j = 0;j < 31;++j) { u += a[j] + b[j]; out[j] = u & 255; u >>= 8; }
-  u += a[31] + b[31]; out[31] = u;
+  crypto_int32 v[10];
 }
+fe25519;
 
-static void sub(unsigned int out[32],const unsigned int a[32],const unsigned int b[32])
+/*
+ * h = h0 + 2^26 h1 + 2^51 h2 + ... + 2^230 h9 (mod 2^255-19) グāA
+ * e limb  26bit / 25bit Ɏ߂
+ */
+static void fe25519_carry(fe25519 *h,
+    crypto_int64 h0, crypto_int64 h1, crypto_int64 h2, crypto_int64 h3, crypto_int64 h4,
+    crypto_int64 h5, crypto_int64 h6, crypto_int64 h7, crypto_int64 h8, crypto_int64 h9)
 {
-  unsigned int j;
-  unsigned int u;
-  u = 218;
-  for (j = 0;j < 31;++j) {
-    u += a[j] + 65280 - b[j];
-    out[j] = u & 255;
-    u >>= 8;
+  crypto_int64 c;
+
+  c = (h0 + ((crypto_int64) 1 << 25)) >> 26; h1 += c; h0 -= c * ((crypto_int64) 1 << 26);
+  c = (h4 + ((crypto_int64) 1 << 25)) >> 26; h5 += c; h4 -= c * ((crypto_int64) 1 << 26);
+  c = (h1 + ((crypto_int64) 1 << 24)) >> 25; h2 += c; h1 -= c * ((crypto_int64) 1 << 25);
+  c = (h5 + ((crypto_int64) 1 << 24)) >> 25; h6 += c; h5 -= c * ((crypto_int64) 1 << 25);
+  c = (h2 + ((crypto_int64) 1 << 25)) >> 26; h3 += c; h2 -= c * ((crypto_int64) 1 << 26);
+  c = (h6 + ((crypto_int64) 1 << 25)) >> 26; h7 += c; h6 -= c * ((crypto_int64) 1 << 26);
+  c = (h3 + ((crypto_int64) 1 << 24)) >> 25; h4 += c; h3 -= c * ((crypto_int64) 1 << 25);
+  c = (h7 + ((crypto_int64) 1 << 24)) >> 25; h8 += c; h7 -= c * ((crypto_int64) 1 << 25);
+  c = (h4 + ((crypto_int64) 1 << 25)) >> 26; h5 += c; h4 -= c * ((crypto_int64) 1 << 26);
+  c = (h8 + ((crypto_int64) 1 << 25)) >> 26; h9 += c; h8 -= c * ((crypto_int64) 1 << 26);
+  c = (h9 + ((crypto_int64) 1 << 24)) >> 25; h0 += c * 19; h9 -= c * ((crypto_int64) 1 << 25);
+  c = (h0 + ((crypto_int64) 1 << 25)) >> 26; h1 += c; h0 -= c * ((crypto_int64) 1 << 26);
+
+  h->v[0] = (crypto_int32) h0;
+  h->v[1] = (crypto_int32) h1;
+  h->v[2] = (crypto_int32) h2;
+  h->v[3] = (crypto_int32) h3;
+  h->v[4] = (crypto_int32) h4;
+  h->v[5] = (crypto_int32) h5;
+  h->v[6] = (crypto_int32) h6;
+  h->v[7] = (crypto_int32) h7;
+  h->v[8] = (crypto_int32) h8;
+  h->v[9] = (crypto_int32) h9;
+}
+
+static void fe25519_unpack(fe25519 *r, const unsigned char x[32])
+{
+  crypto_uint64 acc = 0;
+  int bits = 0, n = 0, i, w;
+
+  /* ŏʃrbg͖ */
+  for (i = 0; i < 10; i++) {
+    w = (i & 1) ? 25 : 26;
+    while (bits < w) {
+      acc |= (crypto_uint64) x[n++] << bits;
+      bits += 8;
+    }
+    r->v[i] = (crypto_int32) (acc & (((crypto_uint64) 1 << w) - 1));
+    acc >>= w;
+    bits -= w;
   }
-  u += a[31] - b[31];
-  out[31] = u;
 }
 
-static void squeeze(unsigned int a[32])
+/* 2^255-19 ŊSɊҌĂ 32 oCgɋl߂ */
+static void fe25519_pack(unsigned char r[32], const fe25519 *x)
 {
-  unsigned int j;
-  unsigned int u;
-  u = 0;
-  for (j = 0;j < 31;++j) { u += a[j]; a[j] = u & 255; u >>= 8; }
-  u += a[31]; a[31] = u & 127;
-  u = 19 * (u >> 7);
-  for (j = 0;j < 31;++j) { u += a[j]; a[j] = u & 255; u >>= 8; }
-  u += a[31]; a[31] = u;
+  crypto_int32 h[10];
+  crypto_int32 q, c;
+  crypto_uint64 acc = 0;
+  int bits = 0, n = 0, i;
+
+  for (i = 0; i < 10; i++) h[i] = x->v[i];
+
+  /* q = floor(h / p) (0  1) */
+  q = (19 * h[9] + ((crypto_int32) 1 << 24)) >> 25;
+  for (i = 0; i < 10; i++) q = (h[i] + q) >> ((i & 1) ? 25 : 26);
+
+  /* h - q * p ߂B2^255 ͎̌̂Ă */
+  h[0] += 19 * q;
+  for (i = 0; i < 9; i++) {
+    c = h[i] >> ((i & 1) ? 25 : 26);
+    h[i + 1] += c;
+    h[i] -= c * ((i & 1) ? (1 << 25) : (1 << 26));
+  }
+  c = h[9] >> 25;
+  h[9] -= c * (1 << 25);
+
+  for (i = 0; i < 10; i++) {
+    acc |= (crypto_uint64) (crypto_uint32) h[i] << bits;
+    bits += (i & 1) ? 25 : 26;
+    while (bits >= 8) {
+      r[n++] = (unsigned char) acc;
+      acc >>= 8;
+      bits -= 8;
+    }
+  }
+  r[n] = (unsigned char) acc;
 }
 
-static const unsigned int minusp[32] = {
- 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128
-} ;
+static void fe25519_add(fe25519 *r, const fe25519 *x, const fe25519 *y)
+{
+  fe25519_carry(r,
+    (crypto_int64) x->v[0] + y->v[0], (crypto_int64) x->v[1] + y->v[1],
+    (crypto_int64) x->v[2] + y->v[2], (crypto_int64) x->v[3] + y->v[3],
+    (crypto_int64) x->v[4] + y->v[4], (crypto_int64) x->v[5] + y->v[5],
+    (crypto_int64) x->v[6] + y->v[6], (crypto_int64) x->v[7] + y->v[7],
+    (crypto_int64) x->v[8] + y->v[8], (crypto_int64) x->v[9] + y->v[9]);
+}
 
-static void freeze(unsigned int a[32])
+static void fe25519_sub(fe25519 *r, const fe25519 *x, const fe25519 *y)
 {
-  unsigned int aorig[32];
-  unsigned int j;
-  unsigned int negative;
-
-  for (j = 0;j < 32;++j) aorig[j] = a[j];
-  add(a,a,minusp);
-  negative = -((a[31] >> 7) & 1);
-  for (j = 0;j < 32;++j) a[j] ^= negative & (aorig[j] ^ a[j]);
+  fe25519_carry(r,
+    (crypto_int64) x->v[0] - y->v[0], (crypto_int64) x->v[1] - y->v[1],
+    (crypto_int64) x->v[2] - y->v[2], (crypto_int64) x->v[3] - y->v[3],
+    (crypto_int64) x->v[4] - y->v[4], (crypto_int64) x->v[5] - y->v[5],
+    (crypto_int64) x->v[6] - y->v[6], (crypto_int64) x->v[7] - y->v[7],
+    (crypto_int64) x->v[8] - y->v[8], (crypto_int64) x->v[9] - y->v[9]);
 }
 
-static void mult(unsigned int out[32],const unsigned int a[32],const unsigned int b[32])
+static void fe25519_mul(fe25519 *h, const fe25519 *f, const fe25519 *g)
 {
-  unsigned int i;
-  unsigned int j;
-  unsigned int u;
-
-  for (i = 0;i < 32;++i) {
-    u = 0;
-    for (j = 0;j <= i;++j) u += a[j] * b[i - j];
-    for (j = i + 1;j < 32;++j) u += 38 * a[j] * b[i + 32 - j];
-    out[i] = u;
-  }
-  squeeze(out);
+  crypto_int32 f0 = f->v[0], f1 = f->v[1], f2 = f->v[2], f3 = f->v[3], f4 = f->v[4];
+  crypto_int32 f5 = f->v[5], f6 = f->v[6], f7 = f->v[7], f8 = f->v[8], f9 = f->v[9];
+  crypto_int32 g0 = g->v[0], g1 = g->v[1], g2 = g->v[2], g3 = g->v[3], g4 = g->v[4];
+  crypto_int32 g5 = g->v[5], g6 = g->v[6], g7 = g->v[7], g8 = g->v[8], g9 = g->v[9];
+  crypto_int32 g1_19 = 19 * g1, g2_19 = 19 * g2, g3_19 = 19 * g3, g4_19 = 19 * g4, g5_19 = 19 * g5;
+  crypto_int32 g6_19 = 19 * g6, g7_19 = 19 * g7, g8_19 = 19 * g8, g9_19 = 19 * g9;
+  crypto_int32 f1_2 = 2 * f1, f3_2 = 2 * f3, f5_2 = 2 * f5, f7_2 = 2 * f7, f9_2 = 2 * f9;
+  crypto_int64 h0 = f0*(crypto_int64) g0 + f1_2*(crypto_int64) g9_19 + f2*(crypto_int64) g8_19 + f3_2*(crypto_int64) g7_19
+                   + f4*(crypto_int64) g6_19 + f5_2*(crypto_int64) g5_19 + f6*(crypto_int64) g4_19 + f7_2*(crypto_int64) g3_19
+                   + f8*(crypto_int64) g2_19 + f9_2*(crypto_int64) g1_19;
+  crypto_int64 h1 = f0*(crypto_int64) g1 + f1*(crypto_int64) g0 + f2*(crypto_int64) g9_19 + f3*(crypto_int64) g8_19
+                   + f4*(crypto_int64) g7_19 + f5*(crypto_int64) g6_19 + f6*(crypto_int64) g5_19 + f7*(crypto_int64) g4_19
+                   + f8*(crypto_int64) g3_19 + f9*(crypto_int64) g2_19;
+  crypto_int64 h2 = f0*(crypto_int64) g2 + f1_2*(crypto_int64) g1 + f2*(crypto_int64) g0 + f3_2*(crypto_int64) g9_19
+                   + f4*(crypto_int64) g8_19 + f5_2*(crypto_int64) g7_19 + f6*(crypto_int64) g6_19 + f7_2*(crypto_int64) g5_19
+                   + f8*(crypto_int64) g4_19 + f9_2*(crypto_int64) g3_19;
+  crypto_int64 h3 = f0*(crypto_int64) g3 + f1*(crypto_int64) g2 + f2*(crypto_int64) g1 + f3*(crypto_int64) g0
+                   + f4*(crypto_int64) g9_19 + f5*(crypto_int64) g8_19 + f6*(crypto_int64) g7_19 + f7*(crypto_int64) g6_19
+                   + f8*(crypto_int64) g5_19 + f9*(crypto_int64) g4_19;
+  crypto_int64 h4 = f0*(crypto_int64) g4 + f1_2*(crypto_int64) g3 + f2*(crypto_int64) g2 + f3_2*(crypto_int64) g1
+                   + f4*(crypto_int64) g0 + f5_2*(crypto_int64) g9_19 + f6*(crypto_int64) g8_19 + f7_2*(crypto_int64) g7_19
+                   + f8*(crypto_int64) g6_19 + f9_2*(crypto_int64) g5_19;
+  crypto_int64 h5 = f0*(crypto_int64) g5 + f1*(crypto_int64) g4 + f2*(crypto_int64) g3 + f3*(crypto_int64) g2
+                   + f4*(crypto_int64) g1 + f5*(crypto_int64) g0 + f6*(crypto_int64) g9_19 + f7*(crypto_int64) g8_19
+                   + f8*(crypto_int64) g7_19 + f9*(crypto_int64) g6_19;
+  crypto_int64 h6 = f0*(crypto_int64) g6 + f1_2*(crypto_int64) g5 + f2*(crypto_int64) g4 + f3_2*(crypto_int64) g3
+                   + f4*(crypto_int64) g2 + f5_2*(crypto_int64) g1 + f6*(crypto_int64) g0 + f7_2*(crypto_int64) g9_19
+                   + f8*(crypto_int64) g8_19 + f9_2*(crypto_int64) g7_19;
+  crypto_int64 h7 = f0*(crypto_int64) g7 + f1*(crypto_int64) g6 + f2*(crypto_int64) g5 + f3*(crypto_int64) g4
+                   + f4*(crypto_int64) g3 + f5*(crypto_int64) g2 + f6*(crypto_int64) g1 + f7*(crypto_int64) g0
+                   + f8*(crypto_int64) g9_19 + f9*(crypto_int64) g8_19;
+  crypto_int64 h8 = f0*(crypto_int64) g8 + f1_2*(crypto_int64) g7 + f2*(crypto_int64) g6 + f3_2*(crypto_int64) g5
+                   + f4*(crypto_int64) g4 + f5_2*(crypto_int64) g3 + f6*(crypto_int64) g2 + f7_2*(crypto_int64) g1
+                   + f8*(crypto_int64) g0 + f9_2*(crypto_int64) g9_19;
+  crypto_int64 h9 = f0*(crypto_int64) g9 + f1*(crypto_int64) g8 + f2*(crypto_int64) g7 + f3*(crypto_int64) g6
+                   + f4*(crypto_int64) g5 + f5*(crypto_int64) g4 + f6*(crypto_int64) g3 + f7*(crypto_int64) g2
+                   + f8*(crypto_int64) g1 + f9*(crypto_int64) g0;
+
+  fe25519_carry(h, h0, h1, h2, h3, h4, h5, h6, h7, h8, h9);
 }
 
-static void mult121665(unsigned int out[32],const unsigned int a[32])
+static void fe25519_square(fe25519 *h, const fe25519 *f)
 {
-  unsigned int j;
-  unsigned int u;
-
-  u = 0;
-  for (j = 0;j < 31;++j) { u += 121665 * a[j]; out[j] = u & 255; u >>= 8; }
-  u += 121665 * a[31]; out[31] = u & 127;
-  u = 19 * (u >> 7);
-  for (j = 0;j < 31;++j) { u += out[j]; out[j] = u & 255; u >>= 8; }
-  u += out[j]; out[j] = u;
+  crypto_int32 f0 = f->v[0], f1 = f->v[1], f2 = f->v[2], f3 = f->v[3], f4 = f->v[4];
+  crypto_int32 f5 = f->v[5], f6 = f->v[6], f7 = f->v[7], f8 = f->v[8], f9 = f->v[9];
+  crypto_int32 f0_2 = 2 * f0, f1_2 = 2 * f1, f2_2 = 2 * f2, f3_2 = 2 * f3, f4_2 = 2 * f4;
+  crypto_int32 f5_2 = 2 * f5, f5_19 = 19 * f5, f6_2 = 2 * f6, f6_19 = 19 * f6, f7_2 = 2 * f7;
+  crypto_int32 f7_19 = 19 * f7, f7_38 = 38 * f7, f8_2 = 2 * f8, f8_19 = 19 * f8, f9_2 = 2 * f9;
+  crypto_int32 f9_19 = 19 * f9, f9_38 = 38 * f9;
+  crypto_int64 h0 = f0*(crypto_int64) f0 + f1_2*(crypto_int64) f9_38 + f2_2*(crypto_int64) f8_19 + f3_2*(crypto_int64) f7_38
+                   + f4_2*(crypto_int64) f6_19 + f5_2*(crypto_int64) f5_19;
+  crypto_int64 h1 = f0_2*(crypto_int64) f1 + f2_2*(crypto_int64) f9_19 + f3_2*(crypto_int64) f8_19 + f4_2*(crypto_int64) f7_19
+                   + f5_2*(crypto_int64) f6_19;
+  crypto_int64 h2 = f0_2*(crypto_int64) f2 + f1_2*(crypto_int64) f1 + f3_2*(crypto_int64) f9_38 + f4_2*(crypto_int64) f8_19
+                   + f5_2*(crypto_int64) f7_38 + f6*(crypto_int64) f6_19;
+  crypto_int64 h3 = f0_2*(crypto_int64) f3 + f1_2*(crypto_int64) f2 + f4_2*(crypto_int64) f9_19 + f5_2*(crypto_int64) f8_19
+                   + f6_2*(crypto_int64) f7_19;
+  crypto_int64 h4 = f0_2*(crypto_int64) f4 + f1_2*(crypto_int64) f3_2 + f2*(crypto_int64) f2 + f5_2*(crypto_int64) f9_38
+                   + f6_2*(crypto_int64) f8_19 + f7_2*(crypto_int64) f7_19;
+  crypto_int64 h5 = f0_2*(crypto_int64) f5 + f1_2*(crypto_int64) f4 + f2_2*(crypto_int64) f3 + f6_2*(crypto_int64) f9_19
+                   + f7_2*(crypto_int64) f8_19;
+  crypto_int64 h6 = f0_2*(crypto_int64) f6 + f1_2*(crypto_int64) f5_2 + f2_2*(crypto_int64) f4 + f3_2*(crypto_int64) f3
+                   + f7_2*(crypto_int64) f9_38 + f8*(crypto_int64) f8_19;
+  crypto_int64 h7 = f0_2*(crypto_int64) f7 + f1_2*(crypto_int64) f6 + f2_2*(crypto_int64) f5 + f3_2*(crypto_int64) f4
+                   + f8_2*(crypto_int64) f9_19;
+  crypto_int64 h8 = f0_2*(crypto_int64) f8 + f1_2*(crypto_int64) f7_2 + f2_2*(crypto_int64) f6 + f3_2*(crypto_int64) f5_2
+                   + f4*(crypto_int64) f4 + f9_2*(crypto_int64) f9_19;
+  crypto_int64 h9 = f0_2*(crypto_int64) f9 + f1_2*(crypto_int64) f8 + f2_2*(crypto_int64) f7 + f3_2*(crypto_int64) f6
+                   + f4_2*(crypto_int64) f5;
+
+  fe25519_carry(h, h0, h1, h2, h3, h4, h5, h6, h7, h8, h9);
 }
 
-static void square(unsigned int out[32],const unsigned int a[32])
+static void fe25519_mul121665(fe25519 *h, const fe25519 *f)
 {
-  unsigned int i;
-  unsigned int j;
-  unsigned int u;
-
-  for (i = 0;i < 32;++i) {
-    u = 0;
-    for (j = 0;j < i - j;++j) u += a[j] * a[i - j];
-    for (j = i + 1;j < i + 32 - j;++j) u += 38 * a[j] * a[i + 32 - j];
-    u *= 2;
-    if ((i & 1) == 0) {
-      u += a[i / 2] * a[i / 2];
-      u += 38 * a[i / 2 + 16] * a[i / 2 + 16];
-    }
-    out[i] = u;
-  }
-  squeeze(out);
+  fe25519_carry(h,
+    (crypto_int64) f->v[0] * 121665, (crypto_int64) f->v[1] * 121665,
+    (crypto_int64) f->v[2] * 121665, (crypto_int64) f->v[3] * 121665,
+    (crypto_int64) f->v[4] * 121665, (crypto_int64) f->v[5] * 121665,
+    (crypto_int64) f->v[6] * 121665, (crypto_int64) f->v[7] * 121665,
+    (crypto_int64) f->v[8] * 121665, (crypto_int64) f->v[9] * 121665);
 }
 
-static void select(unsigned int p[64],unsigned int q[64],const unsigned int r[64],const unsigned int s[64],unsigned int b)
+/* b  1 ̂Ƃ f  g ւ (萔) */
+static void fe25519_cswap(fe25519 *f, fe25519 *g, unsigned int b)
 {
-  unsigned int j;
-  unsigned int t;
-  unsigned int bminus1;
-
-  bminus1 = b - 1;
-  for (j = 0;j < 64;++j) {
-    t = bminus1 & (r[j] ^ s[j]);
-    p[j] = s[j] ^ t;
-    q[j] = r[j] ^ t;
+  int i;
+  crypto_int32 mask = -(crypto_int32) b;
+  crypto_int32 t;
+  for (i = 0; i < 10; i++) {
+    t = mask & (f->v[i] ^ g->v[i]);
+    f->v[i] ^= t;
+    g->v[i] ^= t;
   }
 }
 
-static void mainloop(unsigned int work[64],const unsigned char e[32])
+static void recip(fe25519 *out,const fe25519 *z)
 {
-  unsigned int xzm1[64];
-  unsigned int xzm[64];
-  unsigned int xzmb[64];
-  unsigned int xzm1b[64];
-  unsigned int xznb[64];
-  unsigned int xzn1b[64];
-  unsigned int a0[64];
-  unsigned int a1[64];
-  unsigned int b0[64];
-  unsigned int b1[64];
-  unsigned int c1[64];
-  unsigned int r[32];
-  unsigned int s[32];
-  unsigned int t[32];
-  unsigned int u[32];
-  unsigned int j;
-  unsigned int b;
-  int pos;
+  fe25519 z2;
+  fe25519 z9;
+  fe25519 z11;
+  fe25519 z2_5_0;
+  fe25519 z2_10_0;
+  fe25519 z2_20_0;
+  fe25519 z2_50_0;
+  fe25519 z2_100_0;
+  fe25519 t0;
+  fe25519 t1;
+  int i;
 
-  for (j = 0;j < 32;++j) xzm1[j] = work[j];
-  xzm1[32] = 1;
-  for (j = 33;j < 64;++j) xzm1[j] = 0;
+  /* 2 */ fe25519_square(&z2,z);
+  /* 4 */ fe25519_square(&t1,&z2);
+  /* 8 */ fe25519_square(&t0,&t1);
+  /* 9 */ fe25519_mul(&z9,&t0,z);
+  /* 11 */ fe25519_mul(&z11,&z9,&z2);
+  /* 22 */ fe25519_square(&t0,&z11);
+  /* 2^5 - 2^0 = 31 */ fe25519_mul(&z2_5_0,&t0,&z9);
 
-  xzm[0] = 1;
-  for (j = 1;j < 64;++j) xzm[j] = 0;
+  /* 2^6 - 2^1 */ fe25519_square(&t0,&z2_5_0);
+  /* 2^7 - 2^2 */ fe25519_square(&t1,&t0);
+  /* 2^8 - 2^3 */ fe25519_square(&t0,&t1);
+  /* 2^9 - 2^4 */ fe25519_square(&t1,&t0);
+  /* 2^10 - 2^5 */ fe25519_square(&t0,&t1);
+  /* 2^10 - 2^0 */ fe25519_mul(&z2_10_0,&t0,&z2_5_0);
 
-  for (pos = 254;pos >= 0;--pos) {
-    b = e[pos / 8] >> (pos & 7);
-    b &= 1;
-    select(xzmb,xzm1b,xzm,xzm1,b);
-    add(a0,xzmb,xzmb + 32);
-    sub(a0 + 32,xzmb,xzmb + 32);
-    add(a1,xzm1b,xzm1b + 32);
-    sub(a1 + 32,xzm1b,xzm1b + 32);
-    square(b0,a0);
-    square(b0 + 32,a0 + 32);
-    mult(b1,a1,a0 + 32);
-    mult(b1 + 32,a1 + 32,a0);
-    add(c1,b1,b1 + 32);
-    sub(c1 + 32,b1,b1 + 32);
-    square(r,c1 + 32);
-    sub(s,b0,b0 + 32);
-    mult121665(t,s);
-    add(u,t,b0);
-    mult(xznb,b0,b0 + 32);
-    mult(xznb + 32,s,u);
-    square(xzn1b,c1);
-    mult(xzn1b + 32,r,work);
-    select(xzm,xzm1,xznb,xzn1b,b);
-  }
+  /* 2^11 - 2^1 */ fe25519_square(&t0,&z2_10_0);
+  /* 2^12 - 2^2 */ fe25519_square(&t1,&t0);
+  /* 2^20 - 2^10 */ for (i = 2;i < 10;i += 2) { fe25519_square(&t0,&t1); fe25519_square(&t1,&t0); }
+  /* 2^20 - 2^0 */ fe25519_mul(&z2_20_0,&t1,&z2_10_0);
 
-  for (j = 0;j < 64;++j) work[j] = xzm[j];
-}
+  /* 2^21 - 2^1 */ fe25519_square(&t0,&z2_20_0);
+  /* 2^22 - 2^2 */ fe25519_square(&t1,&t0);
+  /* 2^40 - 2^20 */ for (i = 2;i < 20;i += 2) { fe25519_square(&t0,&t1); fe25519_square(&t1,&t0); }
+  /* 2^40 - 2^0 */ fe25519_mul(&t0,&t1,&z2_20_0);
 
-static void recip(unsigned int out[32],const unsigned int z[32])
-{
-  unsigned int z2[32];
-  unsigned int z9[32];
-  unsigned int z11[32];
-  unsigned int z2_5_0[32];
-  unsigned int z2_10_0[32];
-  unsigned int z2_20_0[32];
-  unsigned int z2_50_0[32];
-  unsigned int z2_100_0[32];
-  unsigned int t0[32];
-  unsigned int t1[32];
-  int i;
+  /* 2^41 - 2^1 */ fe25519_square(&t1,&t0);
+  /* 2^42 - 2^2 */ fe25519_square(&t0,&t1);
+  /* 2^50 - 2^10 */ for (i = 2;i < 10;i += 2) { fe25519_square(&t1,&t0); fe25519_square(&t0,&t1); }
+  /* 2^50 - 2^0 */ fe25519_mul(&z2_50_0,&t0,&z2_10_0);
+
+  /* 2^51 - 2^1 */ fe25519_square(&t0,&z2_50_0);
+  /* 2^52 - 2^2 */ fe25519_square(&t1,&t0);
+  /* 2^100 - 2^50 */ for (i = 2;i < 50;i += 2) { fe25519_square(&t0,&t1); fe25519_square(&t1,&t0); }
+  /* 2^100 - 2^0 */ fe25519_mul(&z2_100_0,&t1,&z2_50_0);
 
-  /* 2 */ square(z2,z);
-  /* 4 */ square(t1,z2);
-  /* 8 */ square(t0,t1);
-  /* 9 */ mult(z9,t0,z);
-  /* 11 */ mult(z11,z9,z2);
-  /* 22 */ square(t0,z11);
-  /* 2^5 - 2^0 = 31 */ mult(z2_5_0,t0,z9);
-
-  /* 2^6 - 2^1 */ square(t0,z2_5_0);
-  /* 2^7 - 2^2 */ square(t1,t0);
-  /* 2^8 - 2^3 */ square(t0,t1);
-  /* 2^9 - 2^4 */ square(t1,t0);
-  /* 2^10 - 2^5 */ square(t0,t1);
-  /* 2^10 - 2^0 */ mult(z2_10_0,t0,z2_5_0);
-
-  /* 2^11 - 2^1 */ square(t0,z2_10_0);
-  /* 2^12 - 2^2 */ square(t1,t0);
-  /* 2^20 - 2^10 */ for (i = 2;i < 10;i += 2) { square(t0,t1); square(t1,t0); }
-  /* 2^20 - 2^0 */ mult(z2_20_0,t1,z2_10_0);
-
-  /* 2^21 - 2^1 */ square(t0,z2_20_0);
-  /* 2^22 - 2^2 */ square(t1,t0);
-  /* 2^40 - 2^20 */ for (i = 2;i < 20;i += 2) { square(t0,t1); square(t1,t0); }
-  /* 2^40 - 2^0 */ mult(t0,t1,z2_20_0);
-
-  /* 2^41 - 2^1 */ square(t1,t0);
-  /* 2^42 - 2^2 */ square(t0,t1);
-  /* 2^50 - 2^10 */ for (i = 2;i < 10;i += 2) { square(t1,t0); square(t0,t1); }
-  /* 2^50 - 2^0 */ mult(z2_50_0,t0,z2_10_0);
-
-  /* 2^51 - 2^1 */ square(t0,z2_50_0);
-  /* 2^52 - 2^2 */ square(t1,t0);
-  /* 2^100 - 2^50 */ for (i = 2;i < 50;i += 2) { square(t0,t1); square(t1,t0); }
-  /* 2^100 - 2^0 */ mult(z2_100_0,t1,z2_50_0);
-
-  /* 2^101 - 2^1 */ square(t1,z2_100_0);
-  /* 2^102 - 2^2 */ square(t0,t1);
-  /* 2^200 - 2^100 */ for (i = 2;i < 100;i += 2) { square(t1,t0); square(t0,t1); }
-  /* 2^200 - 2^0 */ mult(t1,t0,z2_100_0);
-
-  /* 2^201 - 2^1 */ square(t0,t1);
-  /* 2^202 - 2^2 */ square(t1,t0);
-  /* 2^250 - 2^50 */ for (i = 2;i < 50;i += 2) { square(t0,t1); square(t1,t0); }
-  /* 2^250 - 2^0 */ mult(t0,t1,z2_50_0);
-
-  /* 2^251 - 2^1 */ square(t1,t0);
-  /* 2^252 - 2^2 */ square(t0,t1);
-  /* 2^253 - 2^3 */ square(t1,t0);
-  /* 2^254 - 2^4 */ square(t0,t1);
-  /* 2^255 - 2^5 */ square(t1,t0);
-  /* 2^255 - 21 */ mult(out,t1,z11);
+  /* 2^101 - 2^1 */ fe25519_square(&t1,&z2_100_0);
+  /* 2^102 - 2^2 */ fe25519_square(&t0,&t1);
+  /* 2^200 - 2^100 */ for (i = 2;i < 100;i += 2) { fe25519_square(&t1,&t0); fe25519_square(&t0,&t1); }
+  /* 2^200 - 2^0 */ fe25519_mul(&t1,&t0,&z2_100_0);
+
+  /* 2^201 - 2^1 */ fe25519_square(&t0,&t1);
+  /* 2^202 - 2^2 */ fe25519_square(&t1,&t0);
+  /* 2^250 - 2^50 */ for (i = 2;i < 50;i += 2) { fe25519_square(&t0,&t1); fe25519_square(&t1,&t0); }
+  /* 2^250 - 2^0 */ fe25519_mul(&t0,&t1,&z2_50_0);
+
+  /* 2^251 - 2^1 */ fe25519_square(&t1,&t0);
+  /* 2^252 - 2^2 */ fe25519_square(&t0,&t1);
+  /* 2^253 - 2^3 */ fe25519_square(&t1,&t0);
+  /* 2^254 - 2^4 */ fe25519_square(&t0,&t1);
+  /* 2^255 - 2^5 */ fe25519_square(&t1,&t0);
+  /* 2^255 - 21 */ fe25519_mul(out,&t1,&z11);
 }
 
 int crypto_scalarmult_curve25519(unsigned char *q,
   const unsigned char *n,
   const unsigned char *p)
 {
-  unsigned int work[96];
   unsigned char e[32];
-  unsigned int i;
+  fe25519 x1, x2, z2, x3, z3;
+  fe25519 a, aa, b, bb, c, d, da, cb, t;
+  unsigned int swap = 0;
+  unsigned int bit;
+  int pos;
+  int i;
+
   for (i = 0;i < 32;++i) e[i] = n[i];
   e[0] &= 248;
   e[31] &= 127;
   e[31] |= 64;
-  for (i = 0;i < 32;++i) work[i] = p[i];
-  mainloop(work,e);
-  recip(work + 32,work + 32);
-  mult(work + 64,work,work + 32);
-  freeze(work + 64);
-  for (i = 0;i < 32;++i) q[i] = work[64 + i];
+
+  /* ̎ƓAp ̍ŏʃrbg 2^255 = 19 (mod 2^255-19) ƂĈ */
+  fe25519_unpack(&x1, p);
+  x1.v[0] += 19 & -(crypto_int32) (p[31] >> 7);
+
+  for (i = 0; i < 10; i++) {
+    x2.v[i] = z2.v[i] = z3.v[i] = 0;
+    x3.v[i] = x1.v[i];
+  }
+  x2.v[0] = 1;
+  z3.v[0] = 1;
+
+  for (pos = 254;pos >= 0;--pos) {
+    bit = (e[pos / 8] >> (pos & 7)) & 1;
+    swap ^= bit;
+    fe25519_cswap(&x2, &x3, swap);
+    fe25519_cswap(&z2, &z3, swap);
+    swap = bit;
+
+    fe25519_add(&a, &x2, &z2);
+    fe25519_square(&aa, &a);
+    fe25519_sub(&b, &x2, &z2);
+    fe25519_square(&bb, &b);
+    fe25519_add(&c, &x3, &z3);
+    fe25519_sub(&d, &x3, &z3);
+    fe25519_mul(&da, &d, &a);
+    fe25519_mul(&cb, &c, &b);
+
+    fe25519_add(&t, &da, &cb);
+    fe25519_square(&x3, &t);
+    fe25519_sub(&t, &da, &cb);
+    fe25519_square(&t, &t);
+    fe25519_mul(&z3, &x1, &t);
+
+    fe25519_mul(&x2, &aa, &bb);
+    fe25519_sub(&t, &aa, &bb);         /* E = AA - BB */
+    fe25519_mul121665(&z2, &t);
+    fe25519_add(&z2, &z2, &aa);
+    fe25519_mul(&z2, &z2, &t);
+  }
+  fe25519_cswap(&x2, &x3, swap);
+  fe25519_cswap(&z2, &z3, swap);
+
+  recip(&z2, &z2);
+  fe25519_mul(&x2, &x2, &z2);
+  fe25519_pack(q, &x2);
   return 0;
 }
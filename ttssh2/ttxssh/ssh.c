@@ -105,6 +105,13 @@ static struct global_confirm global_confirms;
 static Channel_t *channels = NULL;  // `l\̂̔z
 static int channel_max_num = 0;     // channels̗vf
 static int channel_used_num = 0;    // gp`l
+static int *channel_free_ids = NULL; // 󂫃`lԍ̃X^bN
+static int channel_free_num = 0;     // channel_free_idsɐς܂Ă鐔
+static int *local_channel_ids = NULL; // local_num(fwd.c̃`lԍ)  channels̓Y (-1͖gp)
+static int local_channel_ids_num = 0; // local_channel_ids̗vf
+static DWORD channel_rtt = 0;       // WINDOW_ADJUST ̉(ms)̍ŏlB0͖v
+static unsigned int channel_window_stalls = 0;  // MEBhEg؂Ă(S`l)
+static unsigned int channel_window_largest = 0; // LMEBhE̍ől
 
 static char ssh_ttymodes[] = "\x01\x03\x02\x1c\x03\x08\x04\x15\x05\x04";
 
@@ -112,6 +119,9 @@ static CRITICAL_SECTION g_ssh_scp_lock;   /* SCP
 
 static int g_scp_sending;  /* SCPM? */
 
+#define SEND_BATCH_MAX (128*1024)  /* ܂Ƃ߂đpPbg̍vTCY̏ */
+#define SEND_BATCH_HEADROOM 7      /* batch_outbuf ̐擪̋󂫁BpPbg +7 n܂(outbuf Ɠzu) */
+
 static void try_send_credentials(PTInstVar pvar);
 static void prep_compression(PTInstVar pvar);
 
@@ -152,7 +162,8 @@ int dh_pub_is_valid(DH *dh, BIGNUM *dh_pub);
 static void start_ssh_heartbeat_thread(PTInstVar pvar);
 void ssh2_channel_send_close(PTInstVar pvar, Channel_t *c);
 static BOOL SSH_agent_response(PTInstVar pvar, Channel_t *c, int local_channel_num, unsigned char *data, unsigned int buflen);
-static void ssh2_scp_get_packetlist(PTInstVar pvar, Channel_t *c, unsigned char **buf, unsigned int *buflen);
+static PacketList_t *ssh2_scp_get_packetlist(PTInstVar pvar, Channel_t *c);
+static void ssh2_scp_request_window_adjust(PTInstVar pvar, Channel_t *c);
 static void ssh2_scp_free_packetlist(PTInstVar pvar, Channel_t *c);
 static void get_window_pixel_size(PTInstVar pvar, int *x, int *y);
 static void do_SSH2_dispatch_setup_for_transfer(PTInstVar pvar);
@@ -200,6 +211,35 @@ static int client_global_request_reply(PTInstVar pvar, int type, unsigned int se
 //
 // channel function
 //
+
+// MEBhEL
+static unsigned int ssh2_channel_window_limit(int kbytes, unsigned int window)
+{
+	if (kbytes > CHAN_WINDOW_MAX_LIMIT) {
+		kbytes = CHAN_WINDOW_MAX_LIMIT;
+	}
+	if (kbytes <= 0 || (unsigned int)kbytes * 1024 < window) {
+		return window;
+	}
+	return (unsigned int)kbytes * 1024;
+}
+
+static int ssh2_channel_window_max_setting(PTInstVar pvar, enum channel_type type)
+{
+	switch (type) {
+	case TYPE_SHELL:
+	case TYPE_SUBSYSTEM_GEN:
+		return pvar->settings.SessionWindowMax;
+	case TYPE_PORTFWD:
+		return pvar->settings.PortFwdWindowMax;
+	case TYPE_SCP:
+	case TYPE_SFTP:
+		return pvar->settings.ScpWindowMax;
+	default:
+		return 0;
+	}
+}
+
 static Channel_t *ssh2_channel_new(PTInstVar pvar, unsigned int window, unsigned int maxpack,
                                    enum channel_type type, int local_num)
 {
@@ -212,40 +252,67 @@ static Channel_t *ssh2_channel_new(PTInstVar pvar, unsigned int window, unsigned
 		return (NULL);
 	}
 
-	found = -1;
-	for (i = 0 ; i < channel_max_num ; i++) {
-		if (channels[i].used == 0) { // free channel
-			found = i;
-			break;
+	if (type == TYPE_PORTFWD && local_num >= local_channel_ids_num) {
+		int num = local_channel_ids_num == 0 ? CHANNEL_ADD_NUM : local_channel_ids_num;
+		int *p;
+		while (num <= local_num) {
+			num *= 2;
 		}
+		p = realloc(local_channel_ids, sizeof(int) * num);
+		if (p == NULL) {
+			return (NULL);
+		}
+		local_channel_ids = p;
+		for (i = local_channel_ids_num ; i < num ; i++) {
+			local_channel_ids[i] = -1;
+		}
+		local_channel_ids_num = num;
 	}
-	if (found == -1) { // no free channels
+
+	// 󂫃`l̓X^bNŊǗAS`l𑖍Ȃ
+	if (channel_free_num == 0) { // no free channels
 		Channel_t *p = realloc(channels, sizeof(Channel_t) * (channel_max_num + CHANNEL_ADD_NUM));
+		int *ids;
 		if (p == NULL) {
 			return (NULL);
 		}
 		channels = p;
-		found = i;
+		ids = realloc(channel_free_ids, sizeof(int) * (channel_max_num + CHANNEL_ADD_NUM));
+		if (ids == NULL) {
+			return (NULL);
+		}
+		channel_free_ids = ids;
+		memset(&channels[channel_max_num], 0, sizeof(Channel_t) * CHANNEL_ADD_NUM);
+		// Ⴂԍg悤tɐς
+		for (i = channel_max_num + CHANNEL_ADD_NUM - 1 ; i >= channel_max_num ; i--) {
+			channel_free_ids[channel_free_num++] = i;
+		}
 		channel_max_num += CHANNEL_ADD_NUM;
-		memset(&channels[i], 0, sizeof(Channel_t) * CHANNEL_ADD_NUM);
 		logprintf(LOG_LEVEL_VERBOSE, "%s: new channel_max_num %d", __FUNCTION__, channel_max_num);
 	}
+	found = channel_free_ids[--channel_free_num];
 
 	// setup
 	c = &channels[found];
 	memset(c, 0, sizeof(Channel_t));
 	channel_used_num++;
 	c->used = 1;
-	c->self_id = i;
+	c->self_id = found;
 	c->remote_id = SSH_CHANNEL_INVALID;
 	c->local_window = window;
 	c->local_window_max = window;
+	c->local_window_limit = ssh2_channel_window_limit(ssh2_channel_window_max_setting(pvar, type), window);
+	c->local_window_tick = GetTickCount();
+	c->local_window_stalls = 0;
 	c->local_consumed = 0;
 	c->local_maxpacket = maxpack;
 	c->remote_window = 0;
 	c->remote_maxpacket = 0;
 	c->type = type;
 	c->local_num = local_num;  // alloc_channel()̕ԒlۑĂ
+	if (type == TYPE_PORTFWD && local_num >= 0) {
+		local_channel_ids[local_num] = found;
+	}
 	c->bufchain = NULL;
 	c->bufchain_amount = 0;
 	c->bufchain_recv_suspended = FALSE;
@@ -253,6 +320,7 @@ static Channel_t *ssh2_channel_new(PTInstVar pvar, unsigned int window, unsigned
 		c->scp.state = SCP_INIT;
 		c->scp.progress_window = NULL;
 		c->scp.thread = INVALID_HANDLE_VALUE;
+		c->scp.window_event = NULL;
 		c->scp.localfp = NULL;
 		c->scp.filemtime = 0;
 		c->scp.fileatime = 0;
@@ -310,6 +378,7 @@ static void ssh2_channel_retry_send_bufchain(PTInstVar pvar, Channel_t *c)
 	unsigned int size;
 	bufchain_t* ch_origin = c->bufchain;
 
+	SSH_begin_send_batch(pvar);
 	while (c->bufchain) {
 		// 擪ɑ
 		ch = c->bufchain;
@@ -331,6 +400,7 @@ static void ssh2_channel_retry_send_bufchain(PTInstVar pvar, Channel_t *c)
 		// obt@TCY̍vXV(L^p)
 		c->bufchain_amount -= size;
 	}
+	SSH_end_send_batch(pvar);
 
 	// XXgɂȂA
 	// local connectioñpPbgʒmĊJB
@@ -360,6 +430,27 @@ static void ssh2_channel_delete(Channel_t *c)
 		prev_state = c->scp.state;
 
 		c->scp.state = SCP_CLOSING;
+		if (c->scp.progress_window != NULL) {
+			DestroyWindow(c->scp.progress_window);
+			c->scp.progress_window = NULL;
+		}
+		// ҂ĂXbhN
+		if (c->scp.window_event != NULL) {
+			SetEvent(c->scp.window_event);
+		}
+		if (c->scp.recv.event != NULL) {
+			SetEvent(c->scp.recv.event);
+		}
+		// Xbht@CgIĂ
+		if (c->scp.thread != INVALID_HANDLE_VALUE) {
+			WaitForSingleObject(c->scp.thread, INFINITE);
+			CloseHandle(c->scp.thread);
+			c->scp.thread = INVALID_HANDLE_VALUE;
+		}
+		if (c->scp.window_event != NULL) {
+			CloseHandle(c->scp.window_event);
+			c->scp.window_event = NULL;
+		}
 		if (c->scp.localfp != NULL) {
 			fclose(c->scp.localfp);
 			if (c->scp.dir == FROMREMOTE) {
@@ -376,15 +467,6 @@ static void ssh2_channel_delete(Channel_t *c)
 					remove(c->scp.localfilefull);
 			}
 		}
-		if (c->scp.progress_window != NULL) {
-			DestroyWindow(c->scp.progress_window);
-			c->scp.progress_window = NULL;
-		}
-		if (c->scp.thread != INVALID_HANDLE_VALUE) {
-			WaitForSingleObject(c->scp.thread, INFINITE);
-			CloseHandle(c->scp.thread);
-			c->scp.thread = INVALID_HANDLE_VALUE;
-		}
 
 		// SCPM̏ꍇ̂݁ASCPpXg̊JsB
 		// Windows9xŗCB
@@ -398,6 +480,22 @@ static void ssh2_channel_delete(Channel_t *c)
 	if (c->type == TYPE_AGENT) {
 		buffer_free(c->agent_msg);
 	}
+	if (c->type == TYPE_SFTP) {
+		sftp_do_end(c);
+	}
+
+	if (c->used && c->local_window_stalls > 0) {
+		logprintf(LOG_LEVEL_VERBOSE, "%s: channel %d: receive window exhausted %u times, window %u",
+		          __FUNCTION__, c->self_id, c->local_window_stalls, c->local_window_max);
+	}
+
+	if (c->used) {
+		if (c->type == TYPE_PORTFWD && c->local_num >= 0 && c->local_num < local_channel_ids_num
+		 && local_channel_ids[c->local_num] == c->self_id) {
+			local_channel_ids[c->local_num] = -1;
+		}
+		channel_free_ids[channel_free_num++] = c->self_id;
+	}
 
 	memset(c, 0, sizeof(Channel_t));
 	c->used = 0;
@@ -437,17 +535,21 @@ static Channel_t *ssh2_channel_lookup(int id)
 // (2005.6.12 yutaka)
 Channel_t *ssh2_local_channel_lookup(int local_num)
 {
-	int i;
+	int id;
 	Channel_t *c;
 
-	for (i = 0 ; i < channel_max_num ; i++) {
-		c = &channels[i];
-		if (c->type != TYPE_PORTFWD)
-			continue;
-		if (c->local_num == local_num)
-			return (c);
+	if (local_num < 0 || local_num >= local_channel_ids_num) {
+		return (NULL);
+	}
+	id = local_channel_ids[local_num];
+	if (id < 0) {
+		return (NULL);
 	}
-	return (NULL);
+	c = &channels[id];
+	if (c->type != TYPE_PORTFWD || c->local_num != local_num) {
+		return (NULL);
+	}
+	return (c);
 }
 
 //
@@ -1042,10 +1144,9 @@ static int prep_packet_ssh2(PTInstVar pvar, char *data, unsigned int len, unsign
 		unsigned int already_decrypted = get_predecryption_amount(pvar);
 
 		// OꂽXLbvāAc̕𕜍B
-		CRYPT_decrypt(pvar, data + already_decrypted, (4 + len) - already_decrypted);
-
-		// E&M ł͕ MAC ̌؂sB
-		if (!CRYPT_verify_receiver_MAC(pvar, pvar->ssh_state.receiver_sequence_number, data, len + 4, data + len + 4)) {
+		// E&M ł͕ɑ΂ MAC ̌؂ŝŁAƓpXōsB
+		if (!CRYPT_decrypt_verify_receiver_MAC(pvar, pvar->ssh_state.receiver_sequence_number,
+		                                       data, len + 4, already_decrypted, data + len + 4)) {
 			UTIL_get_lang_msg("MSG_SSH_CORRUPTDATA_ERROR", pvar, "Detected corrupted data; connection terminating.");
 			notify_fatal_error(pvar, pvar->UIMsg, TRUE);
 			return SSH_MSG_NONE;
@@ -1115,16 +1216,34 @@ unsigned char *begin_send_packet(PTInstVar pvar, int type, int len)
 		buf_ensure_size(&pvar->ssh_state.precompress_outbuf,
 		                &pvar->ssh_state.precompress_outbuflen, 1 + len);
 		buf = pvar->ssh_state.precompress_outbuf;
+		pvar->ssh_state.packet_base = pvar->ssh_state.outbuf;
 	} else {
 		/* For SSHv2,
 		   Encrypted_length is 4(packetlength) + 1(paddinglength) + 1(packettype)
 		   + len(payload) + 4(minpadding), rounded up to nearest block_size
 		   We only need a reasonable upper bound for the buffer size */
-		buf_ensure_size(&pvar->ssh_state.outbuf,
-		                &pvar->ssh_state.outbuflen,
-		                (int)(len + 30 + CRYPT_get_sender_MAC_size(pvar) +
-		                CRYPT_get_encryption_block_size(pvar)));
-		buf = pvar->ssh_state.outbuf + 12;
+		long size = (long)(len + 30 + CRYPT_get_sender_MAC_size(pvar) +
+		                   CRYPT_get_encryption_block_size(pvar));
+
+		if (SSHv2(pvar) && pvar->ssh_state.send_batch_level > 0) {
+			// ܂Ƃ߂đƂ́Abatch_outbuf ̖ɒڃpPbg
+			if (pvar->ssh_state.batch_outlen > 0 &&
+			    pvar->ssh_state.batch_outlen + size > SEND_BATCH_MAX) {
+				send_packet_blocking(pvar, pvar->ssh_state.batch_outbuf + SEND_BATCH_HEADROOM,
+				                     pvar->ssh_state.batch_outlen);
+				pvar->ssh_state.batch_outlen = 0;
+			}
+			buf_ensure_size_growing(&pvar->ssh_state.batch_outbuf, &pvar->ssh_state.batch_outbuflen,
+			                        pvar->ssh_state.batch_outlen + size);
+			pvar->ssh_state.packet_base = pvar->ssh_state.batch_outbuf + pvar->ssh_state.batch_outlen;
+		}
+		else {
+			buf_ensure_size(&pvar->ssh_state.outbuf,
+			                &pvar->ssh_state.outbuflen,
+			                size);
+			pvar->ssh_state.packet_base = pvar->ssh_state.outbuf;
+		}
+		buf = pvar->ssh_state.packet_base + 12;
 	}
 
 	buf[0] = (unsigned char) type;
@@ -1265,7 +1384,7 @@ void finish_send_packet_special(PTInstVar pvar, int skip_compress)
 
 		/*
 		 f[^\
-		 pvar->ssh_state.outbuf:
+		 pvar->ssh_state.packet_base (outbufA܂Ƃ߂đƂ batch_outbuf ̖):
 		 offset: 0 1 2 3 4 5 6 7 8 9 10 11 12 ...         EOD
 		         <--ignore---> ^^^^^^^^    <---- payload --->
 		                       packet length
@@ -1294,7 +1413,7 @@ void finish_send_packet_special(PTInstVar pvar, int skip_compress)
 
 			// kΏۂ̓wb_yC[ĥ݁B
 			buffer_append(msg, "\0\0\0\0\0", 5);  // 5 = packet-length(4) + padding(1)
-			if (buffer_compress(&pvar->ssh_state.compress_stream, pvar->ssh_state.outbuf + 12, len, msg) == -1) {
+			if (buffer_compress(&pvar->ssh_state.compress_stream, pvar->ssh_state.packet_base + 12, len, msg) == -1) {
 				UTIL_get_lang_msg("MSG_SSH_COMP_ERROR", pvar,
 				                  "An error occurred while compressing packet data.\n"
 				                  "The connection will close.");
@@ -1306,7 +1425,7 @@ void finish_send_packet_special(PTInstVar pvar, int skip_compress)
 
 		} else {
 			// k
-			data = pvar->ssh_state.outbuf + 7;
+			data = pvar->ssh_state.packet_base + 7;
 		}
 
 		// MpPbg\z(input parameter: data, len)
@@ -1382,7 +1501,26 @@ void finish_send_packet_special(PTInstVar pvar, int skip_compress)
 		          authlen ? "AEAD" : "not AEAD", aadlen ? "EtM" : "E&M");
 	}
 
-	send_packet_blocking(pvar, data, data_length);
+	if (pvar->ssh_state.send_batch_level > 0) {
+		// ܂Ƃ߂đ邽߂ɂ߂Ă
+		unsigned char *tail = pvar->ssh_state.batch_outbuf + SEND_BATCH_HEADROOM + pvar->ssh_state.batch_outlen;
+		if (data != tail) {
+			// kƂ SSH1 ͕ʂ̃obt@ɃpPbgłĂ̂ŃRs[
+			if (pvar->ssh_state.batch_outlen > 0 &&
+			    pvar->ssh_state.batch_outlen + data_length > SEND_BATCH_MAX) {
+				send_packet_blocking(pvar, pvar->ssh_state.batch_outbuf + SEND_BATCH_HEADROOM,
+				                     pvar->ssh_state.batch_outlen);
+				pvar->ssh_state.batch_outlen = 0;
+			}
+			buf_ensure_size_growing(&pvar->ssh_state.batch_outbuf, &pvar->ssh_state.batch_outbuflen,
+			                        SEND_BATCH_HEADROOM + pvar->ssh_state.batch_outlen + data_length);
+			memcpy(pvar->ssh_state.batch_outbuf + SEND_BATCH_HEADROOM + pvar->ssh_state.batch_outlen, data, data_length);
+		}
+		pvar->ssh_state.batch_outlen += data_length;
+	}
+	else {
+		send_packet_blocking(pvar, data, data_length);
+	}
 
 	buffer_free(msg);
 
@@ -1392,6 +1530,26 @@ void finish_send_packet_special(PTInstVar pvar, int skip_compress)
 	pvar->ssh_heartbeat_tick = time(NULL);
 }
 
+// ȍ~ɍpPbg SSH_end_send_batch() ĂԂ܂ő炸ɂ߂ĂA
+// ܂Ƃ߂1 send() őBqɂłB
+void SSH_begin_send_batch(PTInstVar pvar)
+{
+	pvar->ssh_state.send_batch_level++;
+}
+
+void SSH_end_send_batch(PTInstVar pvar)
+{
+	if (pvar->ssh_state.send_batch_level <= 0) {
+		return;
+	}
+	pvar->ssh_state.send_batch_level--;
+	if (pvar->ssh_state.send_batch_level == 0 && pvar->ssh_state.batch_outlen > 0) {
+		send_packet_blocking(pvar, pvar->ssh_state.batch_outbuf + SEND_BATCH_HEADROOM,
+		                     pvar->ssh_state.batch_outlen);
+		pvar->ssh_state.batch_outlen = 0;
+	}
+}
+
 static void destroy_packet_buf(PTInstVar pvar)
 {
 	memset(pvar->ssh_state.outbuf, 0, pvar->ssh_state.outbuflen);
@@ -2981,6 +3139,10 @@ void SSH_init(PTInstVar pvar)
 	buf_create(&pvar->ssh_state.outbuf, &pvar->ssh_state.outbuflen);
 	buf_create(&pvar->ssh_state.precompress_outbuf,
 	           &pvar->ssh_state.precompress_outbuflen);
+	buf_create(&pvar->ssh_state.batch_outbuf, &pvar->ssh_state.batch_outbuflen);
+	pvar->ssh_state.batch_outlen = 0;
+	pvar->ssh_state.send_batch_level = 0;
+	pvar->ssh_state.packet_base = NULL;
 	buf_create(&pvar->ssh_state.postdecompress_inbuf,
 	           &pvar->ssh_state.postdecompress_inbuflen);
 	pvar->ssh_state.payload = NULL;
@@ -3489,6 +3651,32 @@ void SSH_get_mac_info(PTInstVar pvar, char *dest, int len)
 	            get_ssh2_mac_name(pvar->macs[MODE_IN]));
 }
 
+// MEBhẺԂƁAg؂Ă
+void SSH_get_window_info(PTInstVar pvar, char *dest, int len)
+{
+	unsigned int largest = channel_window_largest;
+	int i;
+
+	for (i = 0; i < channel_max_num; i++) {
+		if (channels[i].used && channels[i].local_window_max > largest) {
+			largest = channels[i].local_window_max;
+		}
+	}
+
+	if (channel_rtt != 0) {
+		UTIL_get_lang_msgU8("DLG_ABOUT_WINDOW_INFO", pvar,
+		                    "RTT %lu ms; exhausted %u times; largest %u KB");
+		_snprintf_s(dest, len, _TRUNCATE, pvar->UIMsg,
+		            channel_rtt, channel_window_stalls, largest / 1024);
+	}
+	else {
+		UTIL_get_lang_msgU8("DLG_ABOUT_WINDOW_INFO2", pvar,
+		                    "RTT not measured; exhausted %u times; largest %u KB");
+		_snprintf_s(dest, len, _TRUNCATE, pvar->UIMsg,
+		            channel_window_stalls, largest / 1024);
+	}
+}
+
 void SSH_end(PTInstVar pvar)
 {
 	int i;
@@ -3518,6 +3706,10 @@ void SSH_end(PTInstVar pvar)
 	buf_destroy(&pvar->ssh_state.outbuf, &pvar->ssh_state.outbuflen);
 	buf_destroy(&pvar->ssh_state.precompress_outbuf,
 	            &pvar->ssh_state.precompress_outbuflen);
+	buf_destroy(&pvar->ssh_state.batch_outbuf, &pvar->ssh_state.batch_outbuflen);
+	pvar->ssh_state.batch_outlen = 0;
+	pvar->ssh_state.send_batch_level = 0;
+	pvar->ssh_state.packet_base = NULL;
 	buf_destroy(&pvar->ssh_state.postdecompress_inbuf,
 	            &pvar->ssh_state.postdecompress_inbuflen);
 	pvar->agentfwd_enable = FALSE;
@@ -3621,13 +3813,20 @@ void SSH_end(PTInstVar pvar)
 	channels = NULL;
 	channel_max_num = 0;
 	channel_used_num = 0;
+	free(channel_free_ids);
+	channel_free_ids = NULL;
+	channel_free_num = 0;
+	free(local_channel_ids);
+	local_channel_ids = NULL;
+	local_channel_ids_num = 0;
+	channel_rtt = 0;
+	channel_window_stalls = 0;
+	channel_window_largest = 0;
 }
 
 void SSH2_send_channel_data(PTInstVar pvar, Channel_t *c, unsigned char *buf, unsigned int buflen, int retry)
 {
-	buffer_t *msg;
 	unsigned char *outmsg;
-	unsigned int len;
 
 	// SSH2̏ꍇ́ApPbg𑗂Ȃ̂łۑĂ
 	if (pvar->kex_status & KEX_FLAG_REKEYING) {
@@ -3655,20 +3854,12 @@ void SSH2_send_channel_data(PTInstVar pvar, Channel_t *c, unsigned char *buf, un
 		return;
 	}
 	if (buflen > 0) {
-		msg = buffer_init();
-		if (msg == NULL) {
-			logprintf(LOG_LEVEL_ERROR, "%s: buffer_init returns NULL.", __FUNCTION__);
-			return;
-		}
-		buffer_put_int(msg, c->remote_id);
-		buffer_put_string(msg, (char *)buf, buflen);
-
-		len = buffer_len(msg);
-		outmsg = begin_send_packet(pvar, SSH2_MSG_CHANNEL_DATA, len);
-		//if (len + 12 >= pvar->ssh_state.outbuflen) *(int *)0 = 0;
-		memcpy(outmsg, buffer_ptr(msg), len);
+		// pPbgobt@֒ڏ
+		outmsg = begin_send_packet(pvar, SSH2_MSG_CHANNEL_DATA, 4 + 4 + buflen);
+		set_uint32(outmsg, c->remote_id);
+		set_uint32(outmsg + 4, buflen);
+		memcpy(outmsg + 8, buf, buflen);
 		finish_send_packet(pvar);
-		buffer_free(msg);
 
 		logprintf(LOG_LEVEL_SSHDUMP, "%s: sending SSH2_MSG_CHANNEL_DATA. "
 				  "local:%d remote:%d len:%d", __FUNCTION__, c->self_id, c->remote_id, buflen);
@@ -8133,6 +8324,8 @@ static BOOL handle_SSH2_open_confirm(PTInstVar pvar)
 	remote_id = get_uint32_MSBfirst(data);
 	data += 4;
 
+	c->local_window_tick = GetTickCount();
+
 	c->remote_id = remote_id;
 	if (c->self_id == pvar->shell_id) {
 		// ŏ̃`lȊOŃZbgĂ͂Ȃ (2008.12.19 maya)
@@ -8471,6 +8664,31 @@ static BOOL handle_SSH2_channel_failure(PTInstVar pvar)
 
 
 
+// g؂ĂMEBhELĂÃf[^͂܂ł̎ԂԂƂ݂ȂB
+// L_őĂrȂ(cĂEBhE)͐ȂB
+static void ssh2_channel_rtt_sample(Channel_t *c, unsigned int len)
+{
+	DWORD rtt;
+
+	if (c->rtt_probe_tick == 0)
+		return;
+
+	if (len <= c->rtt_probe_left) {
+		c->rtt_probe_left -= len;
+		return;
+	}
+
+	rtt = GetTickCount() - c->rtt_probe_tick;
+	if (rtt == 0) {
+		rtt = 1;
+	}
+	if (channel_rtt == 0 || rtt < channel_rtt) {
+		channel_rtt = rtt;
+		logprintf(LOG_LEVEL_VERBOSE, "%s: channel %d: rtt %lums", __FUNCTION__, c->self_id, channel_rtt);
+	}
+	c->rtt_probe_tick = 0;
+}
+
 // NCAgwindow sizeT[o֒m点
 static void do_SSH2_adjust_window_size(PTInstVar pvar, Channel_t *c)
 {
@@ -8485,6 +8703,40 @@ static void do_SSH2_adjust_window_size(PTInstVar pvar, Channel_t *c)
 	if (c->local_window > c->local_window_max/2)
 		return;
 
+	// |[g]Ń[Jւ݂̏܂ĂԂ͍XVȂB
+	// FD_WRITE ŏ݂i񂾂 SSH2_resume_channel_window() ōĊJB
+	if (c->type == TYPE_PORTFWD && FWD_is_write_suspended(pvar, c->local_num))
+		return;
+
+	{
+		DWORD now = GetTickCount();
+
+		if (c->local_window < c->local_maxpacket) {
+			c->local_window_stalls++;
+			channel_window_stalls++;
+			// T[o͑ꂸɑ҂Ă̂ŁA WINDOW_ADJUST ŉԂ𑪂
+			c->rtt_probe_tick = now != 0 ? now : 1;
+			c->rtt_probe_left = c->local_window;
+		}
+
+		// EBhE̔1ԂZԂɎMȂAшł͂ȂEBhE
+		// X[vbg𐧌Ă̂ōLBEBhE͑шxς2{x܂ōLB
+		if (c->local_window_max < c->local_window_limit &&
+		    channel_rtt != 0 && now - c->local_window_tick < channel_rtt) {
+			unsigned int newmax = c->local_window_max * 2;
+			if (newmax > c->local_window_limit) {
+				newmax = c->local_window_limit;
+			}
+			logprintf(LOG_LEVEL_VERBOSE, "%s: channel %d: window %u -> %u (rtt %lums)",
+			          __FUNCTION__, c->self_id, c->local_window_max, newmax, channel_rtt);
+			c->local_window_max = newmax;
+			if (newmax > channel_window_largest) {
+				channel_window_largest = newmax;
+			}
+		}
+		c->local_window_tick = now;
+	}
+
 	{
 		// pty open
 		msg = buffer_init();
@@ -8542,15 +8794,29 @@ void ssh2_channel_send_close(PTInstVar pvar, Channel_t *c)
 }
 
 
+// ~߂Ăwindow size̍XVĊJ
+void SSH2_resume_channel_window(PTInstVar pvar, Channel_t *c)
+{
+	if (c->remote_id == SSH_CHANNEL_INVALID)
+		return;
+
+	do_SSH2_adjust_window_size(pvar, c);
+}
+
 #define WM_SENDING_FILE (WM_USER + 1)
 #define WM_CHANNEL_CLOSE (WM_USER + 2)
 #define WM_GET_CLOSED_STATUS (WM_USER + 3)
+#define WM_RECEIVE_WINDOW_ADJUST (WM_USER + 4)
+
+// SCPMňxɃt@CǂݍލőTCY
+#define SCP_SEND_BUFLEN (128 * 1024)
 
 typedef struct scp_dlg_parm {
 	Channel_t *c;
 	PTInstVar pvar;
 	char *buf;
 	size_t buflen;
+	HANDLE done;  // NULLȊOȂAɉԂđMɃZbg
 } scp_dlg_parm_t;
 
 static INT_PTR CALLBACK ssh_scp_dlg_proc(HWND hWnd, UINT msg, WPARAM wp, LPARAM lp)
@@ -8576,8 +8842,26 @@ static INT_PTR CALLBACK ssh_scp_dlg_proc(HWND hWnd, UINT msg, WPARAM wp, LPARAM
 		case WM_SENDING_FILE:
 			{
 			scp_dlg_parm_t *parm = (scp_dlg_parm_t *)wp;
+			Channel_t *c = parm->c;
+			size_t offset, len;
 
-			SSH2_send_channel_data(parm->pvar, parm->c, parm->buf, parm->buflen, 0);
+			if (parm->done != NULL) {
+				// MĂԂɃXbh̃f[^ǂ߂悤AɉԂ
+				ReplyMessage(TRUE);
+			}
+			// remote_maxpacket 𒴂Ȃ悤ɕčpPbǵA܂Ƃ߂đ
+			SSH_begin_send_batch(parm->pvar);
+			for (offset = 0; offset < parm->buflen; offset += len) {
+				len = parm->buflen - offset;
+				if (c->remote_maxpacket > 0 && len > c->remote_maxpacket) {
+					len = c->remote_maxpacket;
+				}
+				SSH2_send_channel_data(parm->pvar, c, parm->buf + offset, (unsigned int)len, 0);
+			}
+			SSH_end_send_batch(parm->pvar);
+			if (parm->done != NULL) {
+				SetEvent(parm->done);
+			}
 			}
 			return TRUE;
 			break;
@@ -8613,6 +8897,25 @@ static INT_PTR CALLBACK ssh_scp_dlg_proc(HWND hWnd, UINT msg, WPARAM wp, LPARAM
 		case WM_DESTROY:
 			return TRUE;
 
+		// SCPt@CMA݃Xbh痊܂ꂽ window size XVB
+		case WM_RECEIVE_WINDOW_ADJUST:
+			{
+			Channel_t *c = (Channel_t *)wp;
+			PTInstVar pvar = c->scp.pvar;
+
+			if (!c->used || c->type != TYPE_SCP) {
+				return TRUE;
+			}
+			EnterCriticalSection(&g_ssh_scp_lock);
+			c->scp.recv.adjust_posted = FALSE;
+			LeaveCriticalSection(&g_ssh_scp_lock);
+			if (!pvar->recv.data_finished && !pvar->recv.suspended) {
+				logprintf(LOG_LEVEL_VERBOSE, "%s: SCP receive, send SSH_MSG_CHANNEL_WINDOW_ADJUST", __FUNCTION__);
+				do_SSH2_adjust_window_size(pvar, c);
+			}
+			}
+			return TRUE;
+
 		case WM_GET_CLOSED_STATUS:
 			{
 			int *flag = (int *)wp;
@@ -8640,12 +8943,26 @@ static int is_canceled_window(HWND hd)
 		return 0;
 }
 
+// MXbȟnBM̃obt@ł܂ő҂B
+static void scp_wait_sending(HANDLE *done, int num)
+{
+	int i;
+
+	for (i = 0; i < num; i++) {
+		if (done[i] != NULL) {
+			WaitForSingleObject(done[i], INFINITE);
+		}
+	}
+}
+
 static unsigned __stdcall ssh_scp_thread(void *p)
 {
 	Channel_t *c = (Channel_t *)p;
 	PTInstVar pvar = c->scp.pvar;
 	long long total_size = 0;
-	char *buf = NULL;
+	char *bufs[2] = { NULL, NULL };
+	HANDLE done[2] = { NULL, NULL };
+	scp_dlg_parm_t sendparm[2];
 	size_t buflen;
 	char s[80];
 	size_t ret;
@@ -8654,9 +8971,20 @@ static unsigned __stdcall ssh_scp_thread(void *p)
 	int rate, ProgStat;
 	DWORD stime;
 	int elapsed, prev_elapsed;
+	int cur = 0;
+	int i;
 
-	buflen = min(c->remote_window, 8192*4); // max 32KB
-	buf = malloc(buflen);
+	// t@C̓ǂݍ݂ƃT[oւ̑Md˂邽߁Aobt@2gB
+	// Е𑗐MĂԂɁAЕ֎̃f[^ǂݍށB
+	buflen = min(max(c->remote_window, c->remote_maxpacket), SCP_SEND_BUFLEN);
+	buflen = max(buflen, 4096); // min 4KB
+	for (i = 0; i < 2; i++) {
+		bufs[i] = malloc(buflen);
+		done[i] = CreateEvent(NULL, TRUE, TRUE, NULL);
+		if (bufs[i] == NULL || done[i] == NULL) {
+			goto abort;
+		}
+	}
 
 	SetDlgItemTextU8(hWnd, IDC_FILENAME, c->scp.localfilefull);
 
@@ -8665,104 +8993,129 @@ static unsigned __stdcall ssh_scp_thread(void *p)
 	stime = GetTickCount();
 	prev_elapsed = 0;
 
-	do {
-		int readlen, count=0;
+	for (;;) {
+		DWORD wait_start;
+
+		// t@Cǂݍ񂾃f[^͂Ȃ炸T[o֑MB
+		ret = fread(bufs[cur], 1, buflen, c->scp.localfp);
+
+		// Õobt@̑MÎ҂B
+		// M̓CXbhӂĂ̂ŁA_CAO̍XVōsB
+		WaitForSingleObject(done[cur ^ 1], INFINITE);
 
 		// Cancel{^ꂽEBhEB
 		if (is_canceled_window(hWnd))
 			goto cancel_abort;
 
-		// t@Cǂݍ񂾃f[^͂Ȃ炸T[o֑MB
-		readlen = max(4096, min(buflen, c->remote_window)); // min 4KB
-		ret = fread(buf, 1, readlen, c->scp.localfp);
+		if (total_size > 0) {
+			rate = (c->scp.filestat.st_size > 0) ? (int)(100 * total_size / c->scp.filestat.st_size) : 100;
+			_snprintf_s(s, sizeof(s), _TRUNCATE, "%lld / %lld (%d%%)", total_size, c->scp.filestat.st_size, rate);
+			SendMessage(GetDlgItem(hWnd, IDC_PROGRESS), WM_SETTEXT, 0, (LPARAM)s);
+			if (ProgStat != rate) {
+				ProgStat = rate;
+				SendDlgItemMessage(hWnd, IDC_PROGBAR, PBM_SETPOS, (WPARAM)ProgStat, 0);
+			}
+
+			elapsed = (GetTickCount() - stime) / 1000;
+			if (elapsed > prev_elapsed) {
+				if (elapsed > 2) {
+					rate = (int)(total_size / elapsed);
+					if (rate < 1200) {
+						_snprintf_s(s, sizeof(s), _TRUNCATE, "%d:%02d (%d %s)", elapsed / 60, elapsed % 60, rate, "Bytes/s");
+					}
+					else if (rate < 1200000) {
+						_snprintf_s(s, sizeof(s), _TRUNCATE, "%d:%02d (%d.%02d %s)", elapsed / 60, elapsed % 60, rate / 1000, rate / 10 % 100, "KBytes/s");
+					}
+					else {
+						_snprintf_s(s, sizeof(s), _TRUNCATE, "%d:%02d (%d.%02d %s)", elapsed / 60, elapsed % 60, rate / (1000 * 1000), rate / 10000 % 100, "MBytes/s");
+					}
+				}
+				else {
+					_snprintf_s(s, sizeof(s), _TRUNCATE, "%d:%02d", elapsed / 60, elapsed % 60);
+				}
+				SendDlgItemMessage(hWnd, IDC_PROGTIME, WM_SETTEXT, 0, (LPARAM)s);
+				prev_elapsed = elapsed;
+			}
+		}
+
 		if (ret == 0)
 			break;
 
-		// remote_window 񕜂܂ő҂
-		do {
+		// remote_window 񕜂܂ő҂B
+		// WINDOW_ADJUST M window_event ŋNB
+		wait_start = GetTickCount();
+		for (;;) {
 			// socket or channelN[YꂽXbhI
 			if (pvar->socket == INVALID_SOCKET || c->scp.state == SCP_CLOSING || c->used == 0)
 				goto abort;
 
-			if (ret > c->remote_window) {
-				Sleep(100);
-			}
+			if (ret <= c->remote_window)
+				break;
 
-			// 100񔲂Ȃ甲Ă܂
-			count++;
-			if (count > 100) {
+			// 10b҂Ă񕜂ȂΑĂ܂ (Ȃ bufchain ɗ܂)
+			if (GetTickCount() - wait_start > 10 * 1000) {
 				break;
 			}
-
-		} while (ret > c->remote_window);
-
-		// sending data
-		parm.buf = buf;
-		parm.buflen = ret;
-		parm.c = c;
-		parm.pvar = pvar;
-		SendMessage(hWnd, WM_SENDING_FILE, (WPARAM)&parm, 0);
-
-		total_size += ret;
-
-		rate = (int)(100 * total_size / c->scp.filestat.st_size);
-		_snprintf_s(s, sizeof(s), _TRUNCATE, "%lld / %lld (%d%%)", total_size, c->scp.filestat.st_size, rate);
-		SendMessage(GetDlgItem(hWnd, IDC_PROGRESS), WM_SETTEXT, 0, (LPARAM)s);
-		if (ProgStat != rate) {
-			ProgStat = rate;
-			SendDlgItemMessage(hWnd, IDC_PROGBAR, PBM_SETPOS, (WPARAM)ProgStat, 0);
-		}
-
-		elapsed = (GetTickCount() - stime) / 1000;
-		if (elapsed > prev_elapsed) {
-			if (elapsed > 2) {
-				rate = (int)(total_size / elapsed);
-				if (rate < 1200) {
-					_snprintf_s(s, sizeof(s), _TRUNCATE, "%d:%02d (%d %s)", elapsed / 60, elapsed % 60, rate, "Bytes/s");
-				}
-				else if (rate < 1200000) {
-					_snprintf_s(s, sizeof(s), _TRUNCATE, "%d:%02d (%d.%02d %s)", elapsed / 60, elapsed % 60, rate / 1000, rate / 10 % 100, "KBytes/s");
-				}
-				else {
-					_snprintf_s(s, sizeof(s), _TRUNCATE, "%d:%02d (%d.%02d %s)", elapsed / 60, elapsed % 60, rate / (1000 * 1000), rate / 10000 % 100, "MBytes/s");
-				}
+			if (c->scp.window_event != NULL) {
+				WaitForSingleObject(c->scp.window_event, 100);
 			}
 			else {
-				_snprintf_s(s, sizeof(s), _TRUNCATE, "%d:%02d", elapsed / 60, elapsed % 60);
+				// CxgȂꍇ͋肵Ȃ悤|[O
+				Sleep(1);
 			}
-			SendDlgItemMessage(hWnd, IDC_PROGTIME, WM_SETTEXT, 0, (LPARAM)s);
-			prev_elapsed = elapsed;
 		}
 
-	} while (ret <= buflen);
+		// sending data
+		// CXbh͎󂯎ƂɉԂ̂ŁAM̊ done ŒmB
+		sendparm[cur].buf = bufs[cur];
+		sendparm[cur].buflen = ret;
+		sendparm[cur].c = c;
+		sendparm[cur].pvar = pvar;
+		sendparm[cur].done = done[cur];
+		ResetEvent(done[cur]);
+		if (!SendMessage(hWnd, WM_SENDING_FILE, (WPARAM)&sendparm[cur], 0)) {
+			SetEvent(done[cur]);
+			goto abort;
+		}
+
+		total_size += ret;
+		cur ^= 1;
+	}
 
 	// eof
 	c->scp.state = SCP_DATA;
 
-	buf[0] = '\0';
-	parm.buf = buf;
+	bufs[0][0] = '\0';
+	parm.buf = bufs[0];
 	parm.buflen = 1;
 	parm.c = c;
 	parm.pvar = pvar;
+	parm.done = NULL;
 	SendMessage(hWnd, WM_SENDING_FILE, (WPARAM)&parm, 0);
 
 	ShowWindow(hWnd, SW_HIDE);
 
-	free(buf);
-
-	return 0;
+	goto cleanup;
 
 cancel_abort:
 	// `l̃N[YsA ssh2_channel_send_close() ĂяoƁA
 	// Y֐XbhZ[tł͂Ȃ߁ASCPɏIȂꍇB
 	// (2011.6.8 yutaka)
+	scp_wait_sending(done, 2);
 	parm.c = c;
 	parm.pvar = pvar;
+	parm.done = NULL;
 	SendMessage(hWnd, WM_CHANNEL_CLOSE, (WPARAM)&parm, 0);
 
 abort:
-
-	free(buf);
+cleanup:
+	scp_wait_sending(done, 2);
+	for (i = 0; i < 2; i++) {
+		free(bufs[i]);
+		if (done[i] != NULL) {
+			CloseHandle(done[i]);
+		}
+	}
 
 	return 0;
 }
@@ -8808,6 +9161,12 @@ static void SSH2_scp_toremote(PTInstVar pvar, Channel_t *c, unsigned char *data,
 			ShowWindow(hDlgWnd, SW_SHOW);
 		}
 
+		// WINDOW_ADJUST ̎MXbh֒m点
+		c->scp.window_event = CreateEvent(NULL, FALSE, FALSE, NULL);
+		if (c->scp.window_event == NULL) {
+			logprintf(LOG_LEVEL_WARNING, "%s: CreateEvent failed (%lu), polling remote window", __FUNCTION__, GetLastError());
+		}
+
 		thread = (HANDLE)_beginthreadex(NULL, 0, ssh_scp_thread, c, 0, &tid);
 		if (thread == 0) {
 			// TODO:
@@ -8826,24 +9185,24 @@ static void SSH2_scp_toremote(PTInstVar pvar, Channel_t *c, unsigned char *data,
 }
 
 
-#define WM_RECEIVING_FILE (WM_USER + 2)
-
 static unsigned __stdcall ssh_scp_receive_thread(void *p)
 {
 	Channel_t *c = (Channel_t *)p;
 	PTInstVar pvar = c->scp.pvar;
-	long long total_size = 0;
 	char s[80];
 	HWND hWnd = c->scp.progress_window;
-	MSG msg;
-	unsigned char *data;
+	PacketList_t *blk;
 	unsigned int buflen;
 	int eof;
 	int rate, ProgStat;
-	DWORD stime;
+	DWORD stime, wtime;
+	DWORD write_time = 0;
 	int elapsed, prev_elapsed;
 	scp_dlg_parm_t parm;
 
+	// 傫ȃubNPʂŏނ̂ŁACRT̃obt@oRȂ
+	setvbuf(c->scp.localfp, NULL, _IONBF, 0);
+
 	InitDlgProgress(hWnd, IDC_PROGBAR, &ProgStat);
 
 	stime = GetTickCount();
@@ -8854,74 +9213,91 @@ static unsigned __stdcall ssh_scp_receive_thread(void *p)
 		if (is_canceled_window(hWnd))
 			goto cancel_abort;
 
-		ssh2_scp_get_packetlist(pvar, c, &data, &buflen);
-		if (data && buflen) {
-			msg.message = WM_RECEIVING_FILE;
-
-			switch (msg.message) {
-			case WM_RECEIVING_FILE:
-				//data = (unsigned char *)msg.wParam;
-				//buflen = (unsigned int)msg.lParam;
-				eof = 0;
+		// `l폜
+		if (c->scp.state == SCP_CLOSING)
+			return 0;
 
-				if (c->scp.filercvsize >= c->scp.filetotalsize) { // EOF
-					free(data);  // free!
-					goto done;
-				}
+		blk = ssh2_scp_get_packetlist(pvar, c);
+		ssh2_scp_request_window_adjust(pvar, c);
+		if (blk == NULL) {
+			// ߂ubNł܂ő҂
+			WaitForSingleObject(c->scp.recv.event, 100);
+			continue;
+		}
 
-				if (c->scp.filercvsize + buflen > c->scp.filetotalsize) { // overflow (include EOF)
-					buflen = (unsigned int)(c->scp.filetotalsize - c->scp.filercvsize);
-					eof = 1;
-				}
+		buflen = blk->buflen;
+		eof = 0;
 
-				c->scp.filercvsize += buflen;
+		if (c->scp.filercvsize >= c->scp.filetotalsize) { // EOF
+			free(blk->buf);  // free!
+			free(blk);
+			goto done;
+		}
 
-				if (fwrite(data, 1, buflen, c->scp.localfp) < buflen) { // error
-					// TODO:
-				}
+		if (c->scp.filercvsize + buflen > c->scp.filetotalsize) { // overflow (include EOF)
+			buflen = (unsigned int)(c->scp.filetotalsize - c->scp.filercvsize);
+			eof = 1;
+		}
 
-				free(data);  // free!
+		c->scp.filercvsize += buflen;
 
-				rate =(int)(100 * c->scp.filercvsize / c->scp.filetotalsize);
-				_snprintf_s(s, sizeof(s), _TRUNCATE, "%lld / %lld (%d%%)", c->scp.filercvsize, c->scp.filetotalsize, rate);
-				SendMessage(GetDlgItem(c->scp.progress_window, IDC_PROGRESS), WM_SETTEXT, 0, (LPARAM)s);
+		wtime = GetTickCount();
+		if (fwrite(blk->buf, 1, buflen, c->scp.localfp) < buflen) { // error
+			// TODO:
+		}
+		write_time += GetTickCount() - wtime;
 
-				if (ProgStat != rate) {
-					ProgStat = rate;
-					SendDlgItemMessage(c->scp.progress_window, IDC_PROGBAR, PBM_SETPOS, (WPARAM)ProgStat, 0);
-				}
+		free(blk->buf);  // free!
+		free(blk);
 
-				elapsed = (GetTickCount() - stime) / 1000;
-				if (elapsed > prev_elapsed) {
-					if (elapsed > 2) {
-						rate = (int)(c->scp.filercvsize / elapsed);
-						if (rate < 1200) {
-							_snprintf_s(s, sizeof(s), _TRUNCATE, "%d:%02d (%d %s)", elapsed / 60, elapsed % 60, rate, "Bytes/s");
-						}
-						else if (rate < 1200000) {
-							_snprintf_s(s, sizeof(s), _TRUNCATE, "%d:%02d (%d.%02d %s)", elapsed / 60, elapsed % 60, rate / 1000, rate / 10 % 100, "KBytes/s");
-						}
-						else {
-							_snprintf_s(s, sizeof(s), _TRUNCATE, "%d:%02d (%d.%02d %s)", elapsed / 60, elapsed % 60, rate / (1000 * 1000), rate / 10000 % 100, "MBytes/s");
-						}
-					}
-					else {
-						_snprintf_s(s, sizeof(s), _TRUNCATE, "%d:%02d", elapsed / 60, elapsed % 60);
-					}
-					SendDlgItemMessage(hWnd, IDC_PROGTIME, WM_SETTEXT, 0, (LPARAM)s);
-					prev_elapsed = elapsed;
-				}
+		rate =(int)(100 * c->scp.filercvsize / c->scp.filetotalsize);
+		_snprintf_s(s, sizeof(s), _TRUNCATE, "%lld / %lld (%d%%)", c->scp.filercvsize, c->scp.filetotalsize, rate);
+		SendMessage(GetDlgItem(c->scp.progress_window, IDC_PROGRESS), WM_SETTEXT, 0, (LPARAM)s);
 
-				if (eof)
-					goto done;
+		if (ProgStat != rate) {
+			ProgStat = rate;
+			SendDlgItemMessage(c->scp.progress_window, IDC_PROGBAR, PBM_SETPOS, (WPARAM)ProgStat, 0);
+		}
 
-				break;
+		elapsed = (GetTickCount() - stime) / 1000;
+		if (elapsed > prev_elapsed) {
+			if (elapsed > 2) {
+				rate = (int)(c->scp.filercvsize / elapsed);
+				if (rate < 1200) {
+					_snprintf_s(s, sizeof(s), _TRUNCATE, "%d:%02d (%d %s)", elapsed / 60, elapsed % 60, rate, "Bytes/s");
+				}
+				else if (rate < 1200000) {
+					_snprintf_s(s, sizeof(s), _TRUNCATE, "%d:%02d (%d.%02d %s)", elapsed / 60, elapsed % 60, rate / 1000, rate / 10 % 100, "KBytes/s");
+				}
+				else {
+					_snprintf_s(s, sizeof(s), _TRUNCATE, "%d:%02d (%d.%02d %s)", elapsed / 60, elapsed % 60, rate / (1000 * 1000), rate / 10000 % 100, "MBytes/s");
+				}
+			}
+			else {
+				_snprintf_s(s, sizeof(s), _TRUNCATE, "%d:%02d", elapsed / 60, elapsed % 60);
 			}
+			SendDlgItemMessage(hWnd, IDC_PROGTIME, WM_SETTEXT, 0, (LPARAM)s);
+			prev_elapsed = elapsed;
+
+			logprintf(LOG_LEVEL_VERBOSE, "%s: %lld bytes, %d bytes/s, queued %lu bytes%s",
+			          __FUNCTION__, c->scp.filercvsize, (int)(c->scp.filercvsize / elapsed),
+			          c->scp.pktlist_cursize, pvar->recv.suspended ? " (suspended)" : "");
 		}
-		Sleep(0);
+
+		if (eof)
+			goto done;
 	}
 
 done:
+	{
+		DWORD total_time = GetTickCount() - stime;
+
+		logprintf(LOG_LEVEL_NOTICE,
+		          "%s: %lld bytes in %lu ms (write %lu ms), max queued %lu bytes, suspended %u times",
+		          __FUNCTION__, c->scp.filercvsize, total_time, write_time,
+		          c->scp.recv.max_queued, c->scp.recv.suspend_count);
+	}
+
 	c->scp.state = SCP_CLOSING;
 	ShowWindow(c->scp.progress_window, SW_HIDE);
 
@@ -8930,6 +9306,7 @@ done:
 	// (2011.6.1 yutaka)
 	parm.c = c;
 	parm.pvar = pvar;
+	parm.done = NULL;
 	SendMessage(hWnd, WM_CHANNEL_CLOSE, (WPARAM)&parm, 0);
 	return 0;
 
@@ -8938,132 +9315,147 @@ cancel_abort:
 	return 0;
 }
 
-// do_SSH2_adjust_window_size() xԂo߂ĂR[
-// t[AMĊJ
-static void CALLBACK do_SSH2_adjust_window_size_timer(
-	HWND hWnd, UINT uMsg, UINT_PTR nIDEvent, DWORD dwTime)
+// SSHT[o瑗Ăt@C̃f[^ubNɋl߂B
+// ȃpPbgƂɊmہE݂ASCPRCV_BLOCK_SIZE ɂ܂Ƃ߂Ă
+// ssh_scp_receive_thread XbhŏށB
+static void ssh2_scp_add_packetlist(PTInstVar pvar, Channel_t *c, unsigned char *buf, unsigned int buflen)
 {
-	Channel_t *c = (Channel_t *)nIDEvent;
-	PTInstVar pvar = c->scp.pvar;
+	PacketList_t *p;
+	unsigned int len;
+	BOOL wakeup = FALSE;
 
-	(void)hWnd;
-	(void)uMsg;
-	(void)dwTime;
+	EnterCriticalSection(&g_ssh_scp_lock);
 
-	if (pvar->recv.data_finished) {
-		// MÎɃbZ[WcĂ΍
-		return;
-	}
-	if (pvar->recv.timer_id != 0) {
-		// SetTimer() ̓C^[oɔ̂ō폜
-		KillTimer(pvar->cv->HWin, pvar->recv.timer_id);
-		pvar->recv.timer_id = 0;
-	}
+	c->scp.recv.received_size += buflen;
 
-	logprintf(LOG_LEVEL_NOTICE, "%s: SCP receive, send SSH_MSG_CHANNEL_WINDOW_ADJUST", __FUNCTION__);
-	pvar->recv.suspended = FALSE;
-	do_SSH2_adjust_window_size(pvar, c);
-}
+	while (buflen > 0) {
+		p = c->scp.pktlist_tail;
+		if (p == NULL || p->buflen == p->bufsize) {
+			// allocate new block
+			p = malloc(sizeof(PacketList_t));
+			if (p == NULL)
+				goto error;
+			p->buf = malloc(SCPRCV_BLOCK_SIZE);
+			if (p->buf == NULL) {
+				free(p);
+				goto error;
+			}
+			p->bufsize = SCPRCV_BLOCK_SIZE;
+			p->buflen = 0;
+			p->next = NULL;
 
-// SSHT[o瑗Ăt@C̃f[^XgɂȂB
-// Xg̎o ssh_scp_receive_thread XbhōsB
-static void ssh2_scp_add_packetlist(PTInstVar pvar, Channel_t *c, unsigned char *buf, unsigned int buflen)
-{
-	PacketList_t *p, *old;
+			if (c->scp.pktlist_head == NULL) {
+				c->scp.pktlist_head = p;
+			}
+			else {
+				c->scp.pktlist_tail->next = p;
+			}
+			c->scp.pktlist_tail = p;
+		}
 
-	EnterCriticalSection(&g_ssh_scp_lock);
+		len = min(buflen, p->bufsize - p->buflen);
+		memcpy(p->buf + p->buflen, buf, len);
+		p->buflen += len;
+		buf += len;
+		buflen -= len;
 
-	// allocate new buffer
-	p = malloc(sizeof(PacketList_t));
-	if (p == NULL)
-		goto error;
-	p->buf = buf;
-	p->buflen = buflen;
-	p->next = NULL;
+		// L[ɋl񂾃f[^̑TCYZB
+		c->scp.pktlist_cursize += len;
 
-	if (c->scp.pktlist_head == NULL) {
-		c->scp.pktlist_head = p;
-		c->scp.pktlist_tail = p;
-	}
-	else {
-		old = c->scp.pktlist_tail;
-		old->next = p;
-		c->scp.pktlist_tail = p;
+		if (p->buflen == p->bufsize) {
+			wakeup = TRUE;
+		}
 	}
 
-	// L[ɋl񂾃f[^̑TCYZB
-	c->scp.pktlist_cursize += buflen;
+	if (c->scp.pktlist_cursize > c->scp.recv.max_queued) {
+		c->scp.recv.max_queued = c->scp.pktlist_cursize;
+	}
+	if (c->scp.recv.received_size >= c->scp.filetotalsize) {
+		wakeup = TRUE;
+	}
 
 	// L[ɋl񂾃f[^̑TCY臒l𒴂ꍇA
 	// SSHT[owindows size̍XV~
 	// ɂ胊XgGgA̔剻
 	// łB
-	if (c->scp.pktlist_cursize >= SCPRCV_HIGH_WATER_MARK) {
+	if (c->scp.pktlist_cursize >= SCPRCV_HIGH_WATER_MARK && !pvar->recv.suspended) {
 		logprintf(LOG_LEVEL_NOTICE,
-			"%s: enter suspend", __FUNCTION__);
+			"%s: channel=#%d enter suspend, %lu(bytes) queued",
+			__FUNCTION__, c->self_id, c->scp.pktlist_cursize);
 		pvar->recv.suspended = TRUE;
+		c->scp.recv.suspend_count++;
+		wakeup = TRUE;
 	}
 
-	logprintf(LOG_LEVEL_NOTICE,
-		"%s: channel=#%d SCP recv %u(bytes) and enqueued.%s",
-		__FUNCTION__, c->self_id, c->scp.pktlist_cursize,
-		pvar->recv.suspended ? "(suspended)" : ""
-	);
-
 error:;
 	LeaveCriticalSection(&g_ssh_scp_lock);
+
+	if (wakeup) {
+		SetEvent(c->scp.recv.event);
+	}
 }
 
-static void ssh2_scp_get_packetlist(PTInstVar pvar, Channel_t *c, unsigned char **buf, unsigned int *buflen)
+// ރubNoB
+// l߂Ăr̃ubŃAςɂȂ邩MI܂ŎoȂB
+// t[ŎM~߂ĂԂ́ArłoB
+static PacketList_t *ssh2_scp_get_packetlist(PTInstVar pvar, Channel_t *c)
 {
 	PacketList_t *p;
 
 	EnterCriticalSection(&g_ssh_scp_lock);
 
-	if (c->scp.pktlist_head == NULL) {
-		*buf = NULL;
-		*buflen = 0;
+	p = c->scp.pktlist_head;
+	if (p == NULL)
 		goto end;
-	}
 
-	p = c->scp.pktlist_head;
-	*buf = p->buf;
-	*buflen = p->buflen;
+	if (p == c->scp.pktlist_tail && p->buflen < p->bufsize &&
+	    c->scp.recv.received_size < c->scp.filetotalsize && !pvar->recv.suspended) {
+		p = NULL;
+		goto end;
+	}
 
 	c->scp.pktlist_head = p->next;
 
 	if (c->scp.pktlist_head == NULL)
 		c->scp.pktlist_tail = NULL;
 
-	free(p);
-
 	// L[ɋl񂾃f[^̑TCYZB
-	c->scp.pktlist_cursize -= *buflen;
+	c->scp.pktlist_cursize -= p->buflen;
 
 	// L[ɋl񂾃f[^̑TCY臒lꍇA
 	// SSHT[owindow size̍XVĊJ
-	if (c->scp.pktlist_cursize <= SCPRCV_LOW_WATER_MARK) {
-		logprintf(LOG_LEVEL_NOTICE, "%s: SCP receive resumed", __FUNCTION__);
-		// ubNĂꍇ
-		if (pvar->recv.suspended) {
-			// SCPM̃ubNB
-			pvar->recv.suspended = FALSE;
-			if (c->scp.filercvsize < c->scp.filetotalsize) {
-				// M
-				pvar->recv.timer_id =
-					SetTimer(pvar->cv->HWin, (UINT_PTR)c, USER_TIMER_MINIMUM, do_SSH2_adjust_window_size_timer);
-			}
-		}
+	// (XV ssh2_scp_request_window_adjust() ŗ)
+	if (c->scp.pktlist_cursize <= SCPRCV_LOW_WATER_MARK && pvar->recv.suspended) {
+		logprintf(LOG_LEVEL_NOTICE, "%s: channel=#%d SCP receive resumed, %lu(bytes) queued",
+		          __FUNCTION__, c->self_id, c->scp.pktlist_cursize);
+		// SCPM̃ubNB
+		pvar->recv.suspended = FALSE;
 	}
 
-	logprintf(LOG_LEVEL_NOTICE,
-		"%s: channel=#%d SCP recv %u(bytes) and dequeued.%s",
-		__FUNCTION__, c->self_id, c->scp.pktlist_cursize,
-		pvar->recv.suspended ? "(suspended)" : ""
-	);
-
 end:;
 	LeaveCriticalSection(&g_ssh_scp_lock);
+	return p;
+}
+
+// SCPMwindow size̍XV͏݃Xbh痊ށB
+// ݂ǂL[臒l𒴂ĂԂ͗܂Ȃ̂ŁA
+// MpPbgƂɍXV𑗂邱Ƃ͂ȂAFD_READ ӂ Cancel 
+// ȂȂ邱ƂȂBۂ̑MGUIXbhōsB
+static void ssh2_scp_request_window_adjust(PTInstVar pvar, Channel_t *c)
+{
+	BOOL post = FALSE;
+
+	EnterCriticalSection(&g_ssh_scp_lock);
+	if (!pvar->recv.suspended && !pvar->recv.data_finished && !c->scp.recv.adjust_posted &&
+	    c->local_window <= c->local_window_max / 2) {
+		c->scp.recv.adjust_posted = TRUE;
+		post = TRUE;
+	}
+	LeaveCriticalSection(&g_ssh_scp_lock);
+
+	if (post) {
+		PostMessage(c->scp.progress_window, WM_RECEIVE_WINDOW_ADJUST, (WPARAM)c, 0);
+	}
 }
 
 static void ssh2_scp_alloc_packetlist(PTInstVar pvar, Channel_t *c)
@@ -9072,8 +9464,11 @@ static void ssh2_scp_alloc_packetlist(PTInstVar pvar, Channel_t *c)
 	c->scp.pktlist_tail = NULL;
 	InitializeCriticalSection(&g_ssh_scp_lock);
 	c->scp.pktlist_cursize = 0;
+	c->scp.recv.max_queued = 0;
+	c->scp.recv.suspend_count = 0;
+	c->scp.recv.adjust_posted = FALSE;
+	c->scp.recv.event = CreateEvent(NULL, FALSE, FALSE, NULL);
 	pvar->recv.suspended = FALSE;
-	pvar->recv.timer_id = 0;
 	pvar->recv.close_request = FALSE;
 }
 
@@ -9092,6 +9487,10 @@ static void ssh2_scp_free_packetlist(PTInstVar pvar, Channel_t *c)
 
 	c->scp.pktlist_head = NULL;
 	c->scp.pktlist_tail = NULL;
+	if (c->scp.recv.event != NULL) {
+		CloseHandle(c->scp.recv.event);
+		c->scp.recv.event = NULL;
+	}
 	DeleteCriticalSection(&g_ssh_scp_lock);
 }
 
@@ -9190,51 +9589,18 @@ static BOOL SSH2_scp_fromremote(PTInstVar pvar, Channel_t *c, unsigned char *dat
 			ssh2_channel_send_close(pvar, c);
 		}
 		else {
-			unsigned char *newdata = malloc(buflen);
-			if (newdata != NULL) {
-				memcpy(newdata, data, buflen);
-
-				// ̒ suspended  TRUE ɂȂ邱Ƃ
-				ssh2_scp_add_packetlist(pvar, c, newdata, buflen);
-			}
-
-			c->scp.recv.received_size += buflen;
+			// ̒ suspended  TRUE ɂȂ邱Ƃ
+			ssh2_scp_add_packetlist(pvar, c, data, buflen);
 
 			if (c->scp.recv.received_size >= c->scp.filetotalsize) {
 				// MI
 				PTInstVar pvar = c->scp.pvar;
 				pvar->recv.data_finished = TRUE;
-				if (pvar->recv.timer_id != 0) {
-					pvar->recv.timer_id = 0;
-					KillTimer(pvar->cv->HWin, pvar->recv.timer_id);
-				}
 			}
 			else if (pvar->recv.suspended) {
 				// t[䒆
 				logprintf(LOG_LEVEL_NOTICE, "%s: scp receive suspended", __FUNCTION__);
 			}
-			else {
-				// [Jwindow size`FbN
-				//	܂߂ɂ炸ɁAx܂Ƃ߂Ēs
-				if (c->local_window < c->local_window_max/2) {
-					// windowTCY𒲐
-#if 0
-					// ɒ
-					//		ɃT[o[f[^Mł̏ꍇA
-					// 		FD_READD悳ăbZ[WL[ɐς܂
-					// 		windows̃bZ[W(LZ{^Ȃ)
-					//		łȂȂ邽ߎgpȂ
-					do_ssh2_adjust_window_size(pvar, c);
-#else
-					// ԂuĂ璲
-					//		^C}[gGUIXbhŊ֐R[
-					if (pvar->recv.timer_id == 0) {
-						pvar->recv.timer_id =
-							SetTimer(pvar->cv->HWin, (UINT_PTR)c, USER_TIMER_MINIMUM, do_SSH2_adjust_window_size_timer);
-					}
-#endif
-				}
-			}
 		}
 
 	} else if (c->scp.state == SCP_CLOSING) {  // EOF̎M
@@ -9364,6 +9730,8 @@ static BOOL handle_SSH2_channel_data(PTInstVar pvar)
 		return FALSE;
 	}
 
+	ssh2_channel_rtt_sample(c, str_len);
+
 	// yC[hƂăNCAg(Tera Term)֓n
 	if (c->type == TYPE_SHELL || c->type == TYPE_SUBSYSTEM_GEN) {
 		pvar->ssh_state.payload_datalen = str_len;
@@ -9375,8 +9743,16 @@ static BOOL handle_SSH2_channel_data(PTInstVar pvar)
 
 	} else if (c->type == TYPE_SCP) {  // SCP
 		SSH2_scp_response(pvar, c, data, str_len);
-		// EBhETCY̒
 		c->local_window -= str_len;
+		if (c->scp.recv.event == NULL) {
+			// Mt@C̎Mn߂ÓA܂łǂ肷ɒ
+			do_SSH2_adjust_window_size(pvar, c);
+		}
+		else if (c->local_window <= c->local_window_max / 2 && !c->scp.recv.adjust_posted) {
+			// t@C̎ḾAEBhETCY̒͏݃XbhɔCB
+			// gNāAssh2_scp_request_window_adjust() ŔfB
+			SetEvent(c->scp.recv.event);
+		}
 		return TRUE;
 
 	} else if (c->type == TYPE_SFTP) {  // SFTP
@@ -9452,6 +9828,8 @@ static BOOL handle_SSH2_channel_extended_data(PTInstVar pvar)
 		return FALSE;
 	}
 
+	ssh2_channel_rtt_sample(c, strlen);
+
 	// yC[hƂăNCAg(Tera Term)֓n
 	if (c->type == TYPE_SHELL || c->type == TYPE_SUBSYSTEM_GEN) {
 		pvar->ssh_state.payload_datalen = strlen;
@@ -9651,6 +10029,7 @@ static BOOL handle_SSH2_channel_open(PTInstVar pvar)
 			notify_nonfatal_error(pvar, pvar->UIMsg);
 			return FALSE;
 		}
+		c->local_window_limit = ssh2_channel_window_limit(pvar->settings.X11WindowMax, c->local_window_max);
 		c->remote_id = remote_id;
 		c->remote_window = remote_window;
 		c->remote_maxpacket = remote_maxpacket;
@@ -9898,6 +10277,11 @@ static BOOL handle_SSH2_window_adjust(PTInstVar pvar)
 	// 炸obt@ɕۑĂf[^𑗂
 	ssh2_channel_retry_send_bufchain(pvar, c);
 
+	// SCPMXbh remote_window ̉񕜂҂Ă΋N
+	if (c->type == TYPE_SCP && c->scp.window_event != NULL) {
+		SetEvent(c->scp.window_event);
+	}
+
 	return TRUE;
 }
 
@@ -113,6 +113,12 @@ enum channel_type {
 #define CHAN_X11_PACKET_DEFAULT (16*1024)
 #define CHAN_X11_WINDOW_DEFAULT (4*CHAN_X11_PACKET_DEFAULT)
 #endif
+/* MEBhEōL(KB)̊lBinit@CŕύXł */
+#define CHAN_SES_WINDOW_MAX_DEFAULT (2*1024)
+#define CHAN_TCP_WINDOW_MAX_DEFAULT (16*1024)
+#define CHAN_X11_WINDOW_MAX_DEFAULT (4*1024)
+#define CHAN_SCP_WINDOW_MAX_DEFAULT (16*1024)
+#define CHAN_WINDOW_MAX_LIMIT (1024*1024)	// 1GB
 
 
 /* SSH2 constants */
@@ -393,6 +399,16 @@ typedef struct {
 	long precompress_outbuflen;
 	/* this is the length of the packet data, including the type header */
 	long outgoing_packet_len;
+	/* While send_batch_level > 0, finished packets are collected here and
+	   sent with a single send() by end_send_batch(). */
+	unsigned char *batch_outbuf;
+	long batch_outbuflen;
+	long batch_outlen;
+	int send_batch_level;
+	/* The packet being built. This is outbuf, or the end of batch_outbuf
+	   while batching so that the packet is built and encrypted in place
+	   there. Same layout as outbuf: packet length at +7, payload at +12. */
+	unsigned char *packet_base;
 
 	/* This buffer is used by the SSH protocol processing to store decompressed
 	   packet data. User data is never streamed through here; it is decompressed
@@ -463,7 +479,10 @@ void SSH_get_server_ID_info(PTInstVar pvar, char *dest, int len);
 void SSH_get_protocol_version_info(PTInstVar pvar, char *dest, int len);
 void SSH_get_compression_info(PTInstVar pvar, char *dest, int len);
 void SSH_get_mac_info(PTInstVar pvar, char *dest, int len);
+void SSH_get_window_info(PTInstVar pvar, char *dest, int len);
 
+void SSH_begin_send_batch(PTInstVar pvar);
+void SSH_end_send_batch(PTInstVar pvar);
 /* len must be <= SSH_MAX_SEND_PACKET_SIZE */
 void SSH_channel_send(PTInstVar pvar, int channel_num,
                       uint32 remote_channel_num,
@@ -528,13 +547,18 @@ typedef struct bufchain {
 typedef struct PacketList {
 	char *buf;
 	unsigned int buflen;
+	unsigned int bufsize;    // allocated size of buf
 	struct PacketList *next;
 } PacketList_t;
 
+// SCPMŎMf[^܂Ƃ߂ăt@C֏ޒP
+#define SCPRCV_BLOCK_SIZE (256 * 1024)
+
 // SCPMɂt[臒l
-// Kp scp_t.filercvsize
-#define SCPRCV_HIGH_WATER_MARK (1 * 1024 * 1024)  // 1MB
-#define SCPRCV_LOW_WATER_MARK (0)  // 0MB
+// Kp scp_t.pktlist_cursize
+//   LOW ͋l߂Ăr̃ubNcĂĂ悤ABLOCK_SIZE ȏɂ
+#define SCPRCV_HIGH_WATER_MARK (4 * 1024 * 1024)  // 4MB
+#define SCPRCV_LOW_WATER_MARK (1 * 1024 * 1024)  // 1MB
 
 typedef struct scp {
 	enum scp_dir dir;              // transfer direction
@@ -547,6 +571,7 @@ typedef struct scp {
 	HWND progress_window;
 	HANDLE thread;
 	unsigned int thread_id;
+	HANDLE window_event;           // signaled on WINDOW_ADJUST (sending file)
 	PTInstVar pvar;
 	// for receiving file
 	long long filetotalsize;
@@ -558,6 +583,10 @@ typedef struct scp {
 	unsigned long pktlist_cursize;
 	struct {
 		uint64_t received_size;
+		HANDLE event;                // signaled when a block is ready to write
+		unsigned long max_queued;    // statistics
+		unsigned int suspend_count;
+		BOOL adjust_posted;          // WM_RECEIVE_WINDOW_ADJUST has been posted
 	} recv;
 } scp_t;
 
@@ -580,6 +609,11 @@ typedef struct sftp {
 	unsigned long long limit_kbps;
 	//struct bwlimit bwlimit_in, bwlimit_out;
 	char path[1024];
+	char cwd[1024];              // [g̃JgfBNg
+	buffer_t *recvbuf;           // Mr̃bZ[W
+	struct sftp_job *jobs;       // s҂̓]Wu
+	struct sftp_job *jobs_tail;
+	struct sftp_xfer *xfer;      // s̓]
 } sftp_t;
 
 typedef struct channel {
@@ -588,6 +622,11 @@ typedef struct channel {
 	int remote_id;
 	unsigned int local_window;
 	unsigned int local_window_max;
+	unsigned int local_window_limit;	// local_window_max L
+	DWORD local_window_tick;			// O WINDOW_ADJUST 𑗂(`lJ)
+	unsigned int local_window_stalls;	// MEBhEg؂Ă
+	DWORD rtt_probe_tick;				// Ԃ𑪂邽߂ WINDOW_ADJUST 𑗂B0͑ĂȂ
+	unsigned int rtt_probe_left;		// ̂ƂcĂEBhE(ĂrȂf[^)
 	unsigned int local_consumed;
 	unsigned int local_maxpacket;
 	unsigned int remote_window;
@@ -609,6 +648,7 @@ unsigned char *begin_send_packet(PTInstVar pvar, int type, int len);
 void finish_send_packet_special(PTInstVar pvar, int skip_compress);
 void SSH2_send_channel_data(PTInstVar pvar, Channel_t *c, unsigned char *buf, unsigned int buflen, int retry);
 Channel_t* ssh2_local_channel_lookup(int local_num);
+void SSH2_resume_channel_window(PTInstVar pvar, Channel_t *c);
 void normalize_generic_order(char *buf, char default_strings[], int default_strings_len);
 void choose_SSH2_proposal(char* server_proposal, char* my_proposal,char* dest, int dest_len);
 
@@ -0,0 +1,280 @@
+/*
+ * ed25519_test
+ *	Curve25519 (smult_curve25519_ref.c) and Ed25519 (ed25519.c) known answer
+ *	tests from RFC 7748 and RFC 8032, and a benchmark of the operations a
+ *	curve25519-sha256 / ssh-ed25519 key exchange needs
+ *
+ *	usage: ed25519_test.exe [N]   (iterations per benchmark, default 2000)
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <windows.h>
+
+#include "crypto_api.h"
+
+int crypto_scalarmult_curve25519(unsigned char *, const unsigned char *, const unsigned char *);
+
+static int errors;
+
+#define CHECK(cond) \
+	do { \
+		if (!(cond)) { \
+			printf("%s(%d): NG %s\n", __FILE__, __LINE__, #cond); \
+			errors++; \
+		} \
+	} while (0)
+
+/*
+ * randombytes() for crypto_sign_ed25519_keypair()
+ * returns the seed set in next_random, otherwise pseudo random bytes
+ */
+static const unsigned char *next_random;
+static unsigned int rand_state = 1;
+
+void arc4random_buf(void *buf, size_t n)
+{
+	unsigned char *p = (unsigned char *)buf;
+	size_t i;
+
+	if (next_random != NULL) {
+		memcpy(p, next_random, n);
+		next_random = NULL;
+		return;
+	}
+	for (i = 0; i < n; i++) {
+		rand_state = rand_state * 1103515245 + 12345;
+		p[i] = (unsigned char)(rand_state >> 16);
+	}
+}
+
+static void Unhex(unsigned char *out, const char *hex, size_t len)
+{
+	size_t i;
+	for (i = 0; i < len; i++) {
+		unsigned char hi = (unsigned char)hex[2 * i], lo = (unsigned char)hex[2 * i + 1];
+		hi = (hi <= '9') ? hi - '0' : hi - 'a' + 10;
+		lo = (lo <= '9') ? lo - '0' : lo - 'a' + 10;
+		out[i] = (unsigned char)((hi << 4) | lo);
+	}
+}
+
+/* RFC 7748 5.2 */
+static const struct {
+	const char *scalar;
+	const char *u;
+	const char *out;
+} x25519_vectors[] = {
+	{
+		"a546e36bf0527c9d3b16154b82465edd62144c0ac1fc5a18506a2244ba449ac4",
+		"e6db6867583030db3594c1a424b15f7c726624ec26b3353b10a903a6d0ab1c4c",
+		"c3da55379de9c6908e94ea4df28d084f32eccf03491c71f754b4075577a28552",
+	},
+	{
+		"4b66e9d4d1b4673c5ad22691957d6af5c11b6421e0ea01d42ca4169e7918ba0d",
+		"e5210f12786811d3f4b7959d0538ae2c31dbe7106fc03c3efc4cd549c715a493",
+		"95cbde9476e8907d7aade45cb4b873f88b595a68799fa152e6f8f7647aac7957",
+	},
+};
+
+/* RFC 7748 5.2, k = u = 9, k = X25519(k, u), u = old k */
+static const char x25519_iter1[] = "422c8e7a6227d7bca1350b3e2bb7279f7897b87bb6854b783c60e80311ae3079";
+static const char x25519_iter1000[] = "684cf59ba83309552800ef566f2f4d3c1c3887c49360e3875f2eb94d99532c51";
+
+/* RFC 7748 6.1 */
+static const char x25519_alice_priv[] = "77076d0a7318a57d3c16c17251b26645df4c2f87ebc0992ab177fba51db92c2a";
+static const char x25519_alice_pub[] = "8520f0098930a754748b7ddcb43ef75a0dbf3a0d26381af4eba4a98eaa9b4e6a";
+static const char x25519_bob_priv[] = "5dab087e624a8a4b79e17f8b83800ee66f3bb1292618b6fd1c2f8b27ff88e0eb";
+static const char x25519_bob_pub[] = "de9edb7d7b7dc1b4d35b61c2ece435373f8343c85b78674dadfc7e146f882b4f";
+static const char x25519_shared[] = "4a5d9d5ba4ce2de1728e3bf480350f25e07e21c947d19e3376f09b3c1e161742";
+
+/* RFC 8032 7.1 TEST 1 - 3 */
+static const struct {
+	const char *secret;
+	const char *pub;
+	const char *msg;
+	const char *sig;
+} ed25519_vectors[] = {
+	{
+		"9d61b19deffd5a60ba844af492ec2cc44449c5697b326919703bac031cae7f60",
+		"d75a980182b10ab7d54bfed3c964073a0ee172f3daa62325af021a68f707511a",
+		"",
+		"e5564300c360ac729086e2cc806e828a84877f1eb8e5d974d873e065224901555fb8821590a33bacc61e39701cf9b46bd25bf5f0595bbe24655141438e7a100b",
+	},
+	{
+		"4ccd089b28ff96da9db6c346ec114e0f5b8a319f35aba624da8cf6ed4fb8a6fb",
+		"3d4017c3e843895a92b70aa74d1b7ebc9c982ccf2ec4968cc0cd55f12af4660c",
+		"72",
+		"92a009a9f0d4cab8720e820b5f642540a2b27b5416503f8fb3762223ebdb69da085ac1e43e15996e458f3613d0f11d8c387b2eaeb4302aeeb00d291612bb0c00",
+	},
+	{
+		"c5aa8df43f9f837bedb7442f31dcb7b166d38535076f094b85ce3a2e0b4458f7",
+		"fc51cd8e6218a1a38da47ed00230f0580816ed13ba3303ac5deb911548908025",
+		"af82",
+		"6291d657deec24024827e69c3abe01a30ce548a284743a445e3680d7db5ac3ac18ff9b538d16f290ae67f760984dc6594a7c15e9716ed28dc027beceea1ec40a",
+	},
+};
+
+static void TestX25519(void)
+{
+	static const unsigned char basepoint[32] = {9};
+	unsigned char k[32], u[32], q[32], expect[32];
+	size_t i;
+
+	for (i = 0; i < sizeof(x25519_vectors) / sizeof(x25519_vectors[0]); i++) {
+		Unhex(k, x25519_vectors[i].scalar, 32);
+		Unhex(u, x25519_vectors[i].u, 32);
+		/*
+		 * this implementation takes the top bit of u as 2^255 (like the
+		 * original ref code), RFC 7748 says to ignore it
+		 */
+		u[31] &= 127;
+		Unhex(expect, x25519_vectors[i].out, 32);
+		crypto_scalarmult_curve25519(q, k, u);
+		CHECK(memcmp(q, expect, 32) == 0);
+	}
+
+	memcpy(k, basepoint, 32);
+	memcpy(u, basepoint, 32);
+	for (i = 1; i <= 1000; i++) {
+		crypto_scalarmult_curve25519(q, k, u);
+		memcpy(u, k, 32);
+		memcpy(k, q, 32);
+		if (i == 1) {
+			Unhex(expect, x25519_iter1, 32);
+			CHECK(memcmp(k, expect, 32) == 0);
+		}
+	}
+	Unhex(expect, x25519_iter1000, 32);
+	CHECK(memcmp(k, expect, 32) == 0);
+
+	/* key agreement: public keys and the shared secret */
+	Unhex(k, x25519_alice_priv, 32);
+	Unhex(expect, x25519_alice_pub, 32);
+	crypto_scalarmult_curve25519(q, k, basepoint);
+	CHECK(memcmp(q, expect, 32) == 0);
+	Unhex(u, x25519_bob_pub, 32);
+	Unhex(expect, x25519_shared, 32);
+	crypto_scalarmult_curve25519(q, k, u);
+	CHECK(memcmp(q, expect, 32) == 0);
+	Unhex(k, x25519_bob_priv, 32);
+	crypto_scalarmult_curve25519(q, k, basepoint);
+	CHECK(memcmp(q, u, 32) == 0);
+	Unhex(u, x25519_alice_pub, 32);
+	crypto_scalarmult_curve25519(q, k, u);
+	CHECK(memcmp(q, expect, 32) == 0);
+}
+
+static void TestEd25519(void)
+{
+	unsigned char seed[32], pk[32], sk[64], expect[64];
+	unsigned char msg[2], sm[64 + 2], m[64 + 2];
+	unsigned long long smlen, mlen;
+	size_t i, msglen;
+
+	for (i = 0; i < sizeof(ed25519_vectors) / sizeof(ed25519_vectors[0]); i++) {
+		/* public key from the secret key */
+		Unhex(seed, ed25519_vectors[i].secret, 32);
+		next_random = seed;
+		crypto_sign_ed25519_keypair(pk, sk);
+		Unhex(expect, ed25519_vectors[i].pub, 32);
+		CHECK(memcmp(pk, expect, 32) == 0);
+		CHECK(memcmp(sk, seed, 32) == 0 && memcmp(sk + 32, pk, 32) == 0);
+
+		/* sign */
+		msglen = strlen(ed25519_vectors[i].msg) / 2;
+		Unhex(msg, ed25519_vectors[i].msg, msglen);
+		crypto_sign_ed25519(sm, &smlen, msg, msglen, sk);
+		Unhex(expect, ed25519_vectors[i].sig, 64);
+		CHECK(smlen == 64 + msglen && memcmp(sm, expect, 64) == 0);
+
+		/* verify, a flipped bit must fail */
+		CHECK(crypto_sign_ed25519_open(m, &mlen, sm, smlen, pk) == 0);
+		CHECK(mlen == msglen && memcmp(m, msg, msglen) == 0);
+		sm[0] ^= 1;
+		CHECK(crypto_sign_ed25519_open(m, &mlen, sm, smlen, pk) != 0);
+		sm[0] ^= 1;
+		sm[63] ^= 0x10;
+		CHECK(crypto_sign_ed25519_open(m, &mlen, sm, smlen, pk) != 0);
+	}
+}
+
+static double Now(void)
+{
+	LARGE_INTEGER freq, count;
+	QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&count);
+	return (double)count.QuadPart / (double)freq.QuadPart;
+}
+
+/*
+ * curve25519-sha256 with an ssh-ed25519 host key, client side:
+ *	X25519 key pair, X25519 shared secret, Ed25519 verify of the exchange hash
+ * the server signs the exchange hash once per handshake
+ */
+static void Bench(int n)
+{
+	static const unsigned char basepoint[32] = {9};
+	unsigned char k[32], q[32], peer[32], shared[32];
+	unsigned char pk[32], sk[64], hash[32];
+	unsigned char sm[64 + 32], m[64 + 32];
+	unsigned long long smlen, mlen;
+	double t_keygen, t_shared, t_sign, t_verify;
+	int i;
+
+	arc4random_buf(k, sizeof(k));
+	crypto_scalarmult_curve25519(peer, k, basepoint);
+	crypto_sign_ed25519_keypair(pk, sk);
+	arc4random_buf(hash, sizeof(hash));
+
+	t_keygen = Now();
+	for (i = 0; i < n; i++) {
+		k[0] = (unsigned char)i;
+		crypto_scalarmult_curve25519(q, k, basepoint);
+	}
+	t_keygen = (Now() - t_keygen) / n;
+
+	t_shared = Now();
+	for (i = 0; i < n; i++) {
+		k[0] = (unsigned char)i;
+		crypto_scalarmult_curve25519(shared, k, peer);
+	}
+	t_shared = (Now() - t_shared) / n;
+
+	t_sign = Now();
+	for (i = 0; i < n; i++) {
+		hash[0] = (unsigned char)i;
+		crypto_sign_ed25519(sm, &smlen, hash, sizeof(hash), sk);
+	}
+	t_sign = (Now() - t_sign) / n;
+
+	t_verify = Now();
+	for (i = 0; i < n; i++) {
+		CHECK(crypto_sign_ed25519_open(m, &mlen, sm, smlen, pk) == 0);
+	}
+	t_verify = (Now() - t_verify) / n;
+
+	printf("X25519 key pair      %8.1f us\n", t_keygen * 1e6);
+	printf("X25519 shared secret %8.1f us\n", t_shared * 1e6);
+	printf("Ed25519 sign         %8.1f us\n", t_sign * 1e6);
+	printf("Ed25519 verify       %8.1f us\n", t_verify * 1e6);
+	printf("handshake (client)   %8.1f us, %.0f/s\n",
+		   (t_keygen + t_shared + t_verify) * 1e6, 1.0 / (t_keygen + t_shared + t_verify));
+}
+
+int main(int argc, char *argv[])
+{
+	int n = 2000;
+
+	if (argc > 1) {
+		n = atoi(argv[1]);
+	}
+
+	TestX25519();
+	TestEd25519();
+	printf("ed25519: %s\n", errors == 0 ? "OK" : "NG");
+
+	Bench(n);
+
+	return errors == 0 ? 0 : 1;
+}
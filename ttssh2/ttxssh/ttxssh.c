@@ -420,6 +420,15 @@ static void read_ssh_options(PTInstVar pvar, const wchar_t *fileName)
 
 	settings->MaxChannel = GetPrivateProfileInt("TTSSH", "MaxChannel", CHANNEL_MAX_DEFAULT, fileName);
 
+	settings->SessionWindowMax = GetPrivateProfileInt("TTSSH", "SessionWindowMax", CHAN_SES_WINDOW_MAX_DEFAULT, fileName);
+	settings->PortFwdWindowMax = GetPrivateProfileInt("TTSSH", "PortFwdWindowMax", CHAN_TCP_WINDOW_MAX_DEFAULT, fileName);
+	settings->X11WindowMax = GetPrivateProfileInt("TTSSH", "X11WindowMax", CHAN_X11_WINDOW_MAX_DEFAULT, fileName);
+	settings->ScpWindowMax = GetPrivateProfileInt("TTSSH", "ScpWindowMax", CHAN_SCP_WINDOW_MAX_DEFAULT, fileName);
+
+	settings->SftpBlockSize = GetPrivateProfileInt("TTSSH", "SftpBlockSize", DEFAULT_COPY_BUFLEN, fileName);
+	settings->SftpRequests = GetPrivateProfileInt("TTSSH", "SftpRequests", DEFAULT_NUM_REQUESTS, fileName);
+	settings->SftpLimitKbps = GetPrivateProfileInt("TTSSH", "SftpLimitKbps", 0, fileName);
+
 #ifdef _DEBUG
 	GetPrivateProfileStringW(L"TTSSH", L"KexKeyLogFile", L"", settings->KexKeyLogFile, _countof(settings->KexKeyLogFile), fileName);
 	if (settings->KexKeyLogFile[0] == 0) {
@@ -571,6 +580,27 @@ static void write_ssh_options(PTInstVar pvar, const wchar_t *fileName,
 	_itoa_s(settings->MaxChannel, buf, sizeof(buf), 10);
 	WritePrivateProfileString("TTSSH", "MaxChannel", buf, fileName);
 
+	_itoa_s(settings->SessionWindowMax, buf, sizeof(buf), 10);
+	WritePrivateProfileString("TTSSH", "SessionWindowMax", buf, fileName);
+
+	_itoa_s(settings->PortFwdWindowMax, buf, sizeof(buf), 10);
+	WritePrivateProfileString("TTSSH", "PortFwdWindowMax", buf, fileName);
+
+	_itoa_s(settings->X11WindowMax, buf, sizeof(buf), 10);
+	WritePrivateProfileString("TTSSH", "X11WindowMax", buf, fileName);
+
+	_itoa_s(settings->ScpWindowMax, buf, sizeof(buf), 10);
+	WritePrivateProfileString("TTSSH", "ScpWindowMax", buf, fileName);
+
+	_itoa_s(settings->SftpBlockSize, buf, sizeof(buf), 10);
+	WritePrivateProfileString("TTSSH", "SftpBlockSize", buf, fileName);
+
+	_itoa_s(settings->SftpRequests, buf, sizeof(buf), 10);
+	WritePrivateProfileString("TTSSH", "SftpRequests", buf, fileName);
+
+	_itoa_s(settings->SftpLimitKbps, buf, sizeof(buf), 10);
+	WritePrivateProfileString("TTSSH", "SftpLimitKbps", buf, fileName);
+
 #ifdef _DEBUG
 	WritePrivateProfileStringW(L"TTSSH", L"KexKeyLogFile", settings->KexKeyLogFile, fileName);
 	WritePrivateProfileString("TTSSH", "KexKeyLogging",
@@ -2089,6 +2119,13 @@ static void about_dlg_set_abouttext(PTInstVar pvar, HWND dlg, digest_algorithm d
 			strncat_s(buf2, sizeof(buf2), buf, _TRUNCATE);
 			strncat_s(buf2, sizeof(buf2), "\r\n", _TRUNCATE);
 
+			UTIL_get_lang_msgU8("DLG_ABOUT_WINDOW", pvar, "Receive window:");
+			strncat_s(buf2, sizeof(buf2), pvar->UIMsg, _TRUNCATE);
+			strncat_s(buf2, sizeof(buf2), " ", _TRUNCATE);
+			SSH_get_window_info(pvar, buf, sizeof(buf));
+			strncat_s(buf2, sizeof(buf2), buf, _TRUNCATE);
+			strncat_s(buf2, sizeof(buf2), "\r\n", _TRUNCATE);
+
 			UTIL_get_lang_msgU8("DLG_ABOUT_KEXKEY", pvar, "Key exchange keys:");
 			strncat_s(buf2, sizeof(buf2), pvar->UIMsg, _TRUNCATE);
 			strncat_s(buf2, sizeof(buf2), " ", _TRUNCATE);
@@ -3634,6 +3671,12 @@ __declspec(dllexport) int CALLBACK TTXScpReceivefile(char *remotefile, char *loc
 	return SSH_scp_transaction(pvar, remotefile, localfile, FROMREMOTE);
 }
 
+// }NR}h"sftpcmd"ĂяoBcmdline  SFTP R\[ƓR}h(UTF-8)B
+__declspec(dllexport) int CALLBACK TTXSftpCommand(char *cmdline)
+{
+	return sftp_command(pvar, cmdline);
+}
+
 
 /**
  * TTSSH̐ݒe(known hosts file)ԂB
@@ -221,6 +221,17 @@ typedef struct _TS_SSH {
 	char RSAPubkeySignAlgorithmOrder[RSA_PUBKEY_SIGN_ALGO_MAX+1];
 
 	int MaxChannel;
+
+	// MEBhEōL(KB)BlȉȂLȂ
+	int SessionWindowMax;
+	int PortFwdWindowMax;
+	int X11WindowMax;
+	int ScpWindowMax;
+
+	// SFTP  READ/WRITE 1̑傫(oCg)A҂ɑ鐔Aш搧(Kbit/s)
+	int SftpBlockSize;
+	int SftpRequests;
+	int SftpLimitKbps;
 } TS_SSH;
 
 typedef struct _TInstVar {
@@ -365,7 +376,6 @@ typedef struct _TInstVar {
 	struct {
 		BOOL suspended;  // SCPM̃t[p,TRUÊƂԂȂ
 		//BOOL timer_triggerd;
-		UINT_PTR timer_id;
 		BOOL data_finished;	// TRUÊƂ,f[^̎M͊
 		BOOL close_request;
 	} recv;
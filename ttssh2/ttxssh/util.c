@@ -271,6 +271,69 @@ BOOL UTIL_sock_buffered_write(PTInstVar pvar, UTILSockWriteBuf *buf,
 	}
 }
 
+/* \Pbg non-blocking őAȂ̓Oobt@ɗ߂B
+ * UTIL_sock_buffered_write() ƈႢAubLOM͌čsȂB
+ * obt@͕KvȂ傫̂ŁA܂肷Ȃ悤ɗʂî
+ * ĂяoōsB܂ FD_WRITE 󂯂 UTIL_sock_write_more() őB
+ *
+ * return TRUE: 
+ *        FALSE: MG[
+ */
+BOOL UTIL_sock_queued_write(PTInstVar pvar, UTILSockWriteBuf *buf,
+                            SOCKET socket, const char *data, int len)
+{
+	int first_copy_start;
+	int first_copy_amount;
+
+	/* Fast path case: buffer is empty, try nonblocking write */
+	if (buf->datalen == 0) {
+		int sent_amount = send_until_block(pvar, socket, data, len);
+
+		if (sent_amount < 0) {
+			return FALSE;
+		}
+		data += sent_amount;
+		len -= sent_amount;
+	}
+
+	if (len == 0) {
+		return TRUE;
+	}
+
+	// obt@Ȃ΍LB܂ԂĂ镔͌ւȂB
+	if (buf->buflen < buf->datalen + len) {
+		int curlen = buf->buflen;
+		int newlen = max(2 * curlen, buf->datalen + len);
+		int wrap_amount = buf->datastart + buf->datalen - curlen;
+		char *newbuf = realloc(buf->bufdata, newlen);
+
+		if (newbuf == NULL) {
+			return FALSE;
+		}
+		buf->bufdata = newbuf;
+		buf->buflen = newlen;
+
+		if (wrap_amount > 0) {
+			int wrap_to_copy = min(wrap_amount, newlen - curlen);
+
+			memmove(buf->bufdata + curlen, buf->bufdata, wrap_to_copy);
+			memmove(buf->bufdata, buf->bufdata + wrap_to_copy,
+					wrap_amount - wrap_to_copy);
+		}
+	}
+
+	first_copy_start = (buf->datastart + buf->datalen) % buf->buflen;
+	first_copy_amount = min(len, buf->buflen - first_copy_start);
+	memcpy(buf->bufdata + first_copy_start, data, first_copy_amount);
+	if (first_copy_amount < len) {
+		memcpy(buf->bufdata, data + first_copy_amount,
+			   len - first_copy_amount);
+	}
+	buf->datalen += len;
+
+	return TRUE;
+}
+
 BOOL UTIL_sock_write_more(PTInstVar pvar, UTILSockWriteBuf *buf,
 						  SOCKET socket)
 {
@@ -80,6 +80,8 @@ typedef BOOL (* UTILBlockingWriteCallback)(PTInstVar pvar,
 void UTIL_init_sock_write_buf(UTILSockWriteBuf *buf);
 BOOL UTIL_sock_buffered_write(PTInstVar pvar, UTILSockWriteBuf *buf,
   UTILBlockingWriteCallback blocking_write, SOCKET socket, const char *data, int len);
+BOOL UTIL_sock_queued_write(PTInstVar pvar, UTILSockWriteBuf *buf,
+  SOCKET socket, const char *data, int len);
 BOOL UTIL_sock_write_more(PTInstVar pvar, UTILSockWriteBuf *buf, SOCKET socket);
 void UTIL_destroy_sock_write_buf(UTILSockWriteBuf *buf);
 BOOL UTIL_is_sock_deeply_buffered(UTILSockWriteBuf *buf);